@@ -5,4 +5,6 @@ option(ENABLE_OPENMP "Enable OpenMP in some parts of the code" OFF)
 
 if (ENABLE_OPENMP)
   find_package(OpenMP COMPONENTS CXX)
+  set(CCE_LINEAR_SOLVE_NUM_THREADS 1 CACHE STRING
+    "Number of OpenMP threads used by the CCE radial linear solves")
 endif()
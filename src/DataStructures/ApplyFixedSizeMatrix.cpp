@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ApplyFixedSizeMatrix.hpp"
+
+#include <array>
+#include <cstddef>
+#include <utility>
+
+#include "DataStructures/Matrix.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <size_t Rows, size_t Columns>
+void apply_fixed_size_matrix_impl(double* const __restrict__ result,
+                                  const Matrix& matrix,
+                                  const double* const __restrict__ data,
+                                  const size_t stride,
+                                  const size_t number_of_slices) {
+  // Row-major copy of the matrix so all loops over it have compile-time bounds
+  std::array<double, Rows * Columns> m{};
+  for (size_t r = 0; r < Rows; ++r) {
+    for (size_t c = 0; c < Columns; ++c) {
+      gsl::at(m, r * Columns + c) = matrix(r, c);
+    }
+  }
+  // clang-tidy: pointer arithmetic
+  if (stride == 1) {
+    for (size_t s = 0; s < number_of_slices; ++s) {
+      const double* const in = data + s * Columns;  // NOLINT
+      double* const out = result + s * Rows;        // NOLINT
+      for (size_t r = 0; r < Rows; ++r) {
+        double sum = m[r * Columns] * in[0];  // NOLINT
+        for (size_t c = 1; c < Columns; ++c) {
+          sum += m[r * Columns + c] * in[c];  // NOLINT
+        }
+        out[r] = sum;  // NOLINT
+      }
+    }
+  } else {
+    for (size_t s = 0; s < number_of_slices; ++s) {
+      const double* const in = data + s * Columns * stride;  // NOLINT
+      double* const out = result + s * Rows * stride;        // NOLINT
+      for (size_t r = 0; r < Rows; ++r) {
+        double* const out_stripe = out + r * stride;  // NOLINT
+        const double first_coef = m[r * Columns];     // NOLINT
+        for (size_t i = 0; i < stride; ++i) {
+          out_stripe[i] = first_coef * in[i];  // NOLINT
+        }
+        for (size_t c = 1; c < Columns; ++c) {
+          const double coef = m[r * Columns + c];           // NOLINT
+          const double* const in_stripe = in + c * stride;  // NOLINT
+          for (size_t i = 0; i < stride; ++i) {
+            out_stripe[i] += coef * in_stripe[i];  // NOLINT
+          }
+        }
+      }
+    }
+  }
+}
+
+using Kernel = void (*)(double*, const Matrix&, const double*, size_t, size_t);
+constexpr size_t number_of_sizes =
+    apply_fixed_size_matrix_max_size - apply_fixed_size_matrix_min_size + 1;
+
+template <size_t Rows, size_t... ColumnOffsets>
+constexpr std::array<Kernel, number_of_sizes> make_kernels_for_rows(
+    std::index_sequence<ColumnOffsets...> /*meta*/) {
+  return {{&apply_fixed_size_matrix_impl<
+      Rows, apply_fixed_size_matrix_min_size + ColumnOffsets>...}};
+}
+
+template <size_t... RowOffsets>
+constexpr std::array<std::array<Kernel, number_of_sizes>, number_of_sizes>
+make_kernels(std::index_sequence<RowOffsets...> /*meta*/) {
+  return {{make_kernels_for_rows<apply_fixed_size_matrix_min_size +
+                                 RowOffsets>(
+      std::make_index_sequence<number_of_sizes>{})...}};
+}
+
+constexpr auto kernels =
+    make_kernels(std::make_index_sequence<number_of_sizes>{});
+}  // namespace
+
+bool apply_fixed_size_matrix(const gsl::not_null<double*> result,
+                             const Matrix& matrix, const double* const data,
+                             const size_t stride,
+                             const size_t number_of_slices) {
+  const size_t rows = matrix.rows();
+  const size_t columns = matrix.columns();
+  if (rows < apply_fixed_size_matrix_min_size or
+      rows > apply_fixed_size_matrix_max_size or
+      columns < apply_fixed_size_matrix_min_size or
+      columns > apply_fixed_size_matrix_max_size) {
+    return false;
+  }
+  gsl::at(gsl::at(kernels, rows - apply_fixed_size_matrix_min_size),
+          columns - apply_fixed_size_matrix_min_size)(
+      result.get(), matrix, data, stride, number_of_slices);
+  return true;
+}
@@ -0,0 +1,64 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines function apply_fixed_size_matrix
+
+#pragma once
+
+#include <cstddef>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+class Matrix;
+/// \endcond
+
+/// The smallest number of rows and columns of a matrix supported by
+/// `apply_fixed_size_matrix`
+constexpr size_t apply_fixed_size_matrix_min_size = 2;
+/// The largest number of rows and columns of a matrix supported by
+/// `apply_fixed_size_matrix`
+constexpr size_t apply_fixed_size_matrix_max_size = 12;
+/// The largest number of rows and columns of a matrix for which
+/// `apply_fixed_size_matrix` is used instead of BLAS when the caller doesn't
+/// request a specific algorithm, i.e. by `apply_matrices` and by
+/// `LogicalDerivativeAlgorithm::Automatic`.
+///
+/// Larger matrices are still supported by the kernels, but for them BLAS
+/// amortizes its transposes. Re-tune this value with the
+/// `bench_logical_derivatives` benchmark, which times both implementations for
+/// every size the kernels support.
+constexpr size_t apply_fixed_size_matrix_preferred_max_size = 8;
+
+/*!
+ * \ingroup NumericalAlgorithmsGroup
+ * \brief Multiply the stripes of `data` along one dimension by `matrix`,
+ * using a kernel specialized on the size of the matrix.
+ *
+ * \details The `data` is interpreted as `number_of_slices` contiguous blocks of
+ * `matrix.columns()` stripes, where each stripe holds `stride` contiguous
+ * values. This is the layout of a tensor-product grid (with any number of
+ * components stacked) when multiplying along a dimension whose points are
+ * `stride` values apart, i.e. `stride` is the product of the extents of all
+ * faster-varying dimensions. The `result` is laid out the same way, with
+ * `matrix.rows()` stripes per block:
+ *
+ * \f{align*}{
+ * \mathrm{result}[i + \mathrm{stride} (r + R s)] =
+ * \sum_c M_{rc}\, \mathrm{data}[i + \mathrm{stride} (c + C s)]
+ * \f}
+ *
+ * Unlike a BLAS matrix multiplication, this doesn't require the multiplied
+ * dimension to vary fastest, so no transposes are needed. The matrix is copied
+ * to the stack and the loops over it are fully unrolled, which is faster than
+ * BLAS for the small matrices typical of spectral elements.
+ *
+ * Returns `false` without touching `result` if the number of rows or columns of
+ * `matrix` is outside the range [`apply_fixed_size_matrix_min_size`,
+ * `apply_fixed_size_matrix_max_size`], in which case the caller has to fall
+ * back to a general implementation. `result` and `data` must not overlap.
+ */
+bool apply_fixed_size_matrix(gsl::not_null<double*> result,
+                             const Matrix& matrix, const double* data,
+                             size_t stride, size_t number_of_slices);
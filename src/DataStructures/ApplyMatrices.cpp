@@ -3,18 +3,24 @@
 
 #include "DataStructures/ApplyMatrices.hpp"
 
+#include <algorithm>
 #include <array>
 #include <complex>
 #include <cstddef>
 #include <memory>
 
+#include "DataStructures/ApplyFixedSizeMatrix.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Index.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "Utilities/Blas.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
 
 namespace {
 void multiply_in_first_dimension(const gsl::not_null<double*> result,
@@ -88,6 +94,86 @@ std::array<size_t, Dim> matrix_rows(const std::array<MatrixType, Dim>& matrices,
   }
   return result;
 }
+// Applies the matrices one dimension at a time with the kernels specialized on
+// the matrix size, which work along any dimension so no transposes are needed.
+// Empty matrices are skipped. Returns false without touching `result` if a
+// matrix that has to be applied is larger than
+// `apply_fixed_size_matrix_preferred_max_size` or not supported by the kernels.
+template <typename ElementType, typename MatrixType, size_t Dim>
+bool apply_fixed_size(const gsl::not_null<ElementType*> result,
+                      const std::array<MatrixType, Dim>& matrices,
+                      const ElementType* const data, const Index<Dim>& extents,
+                      const size_t number_of_independent_components) {
+  // Complex values are processed as pairs of doubles.
+  constexpr size_t doubles_per_element = sizeof(ElementType) / sizeof(double);
+  std::array<size_t, Dim> dimensions_to_apply{};
+  size_t number_of_dimensions_to_apply = 0;
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, d));
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    if (matrix.rows() < apply_fixed_size_matrix_min_size or
+        matrix.rows() > apply_fixed_size_matrix_preferred_max_size or
+        matrix.columns() < apply_fixed_size_matrix_min_size or
+        matrix.columns() > apply_fixed_size_matrix_preferred_max_size) {
+      return false;
+    }
+    gsl::at(dimensions_to_apply, number_of_dimensions_to_apply) = d;
+    ++number_of_dimensions_to_apply;
+  }
+
+  size_t data_size = number_of_independent_components * extents.product();
+  if (number_of_dimensions_to_apply == 0) {
+    // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+    std::copy(data, data + data_size, result.get());
+    return true;
+  }
+  data_size *= doubles_per_element;
+
+  // Intermediate results alternate between the two halves of the scratch
+  // buffer, and the last matrix writes directly into `result`.
+  std::array<size_t, Dim> current_extents = extents.indices();
+  size_t scratch_size = 0;
+  {
+    size_t size = data_size;
+    for (size_t i = 0; i + 1 < number_of_dimensions_to_apply; ++i) {
+      const Matrix& matrix = dereference_wrapper(
+          gsl::at(matrices, gsl::at(dimensions_to_apply, i)));
+      size = size / matrix.columns() * matrix.rows();
+      scratch_size = std::max(scratch_size, size);
+    }
+  }
+  ScratchArena::Scope scratch_scope{};
+  double* const scratch =
+      scratch_size > 0 ? scratch_scope.allocate<double>(2 * scratch_size)
+                       : nullptr;
+
+  const double* source = reinterpret_cast<const double*>(data);
+  for (size_t i = 0; i < number_of_dimensions_to_apply; ++i) {
+    const size_t dim = gsl::at(dimensions_to_apply, i);
+    const Matrix& matrix = dereference_wrapper(gsl::at(matrices, dim));
+    size_t stride = doubles_per_element;
+    for (size_t d = 0; d < dim; ++d) {
+      stride *= gsl::at(current_extents, d);
+    }
+    double* const destination =
+        i + 1 == number_of_dimensions_to_apply
+            ? reinterpret_cast<double*>(result.get())
+            // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+            : scratch + (i % 2) * scratch_size;
+    const bool applied = apply_fixed_size_matrix(
+        make_not_null(destination), matrix, source, stride,
+        data_size / (stride * matrix.columns()));
+    ASSERT(applied, "Unsupported matrix size " << matrix.rows() << "x"
+                                               << matrix.columns());
+    (void)applied;
+    data_size = data_size / matrix.columns() * matrix.rows();
+    gsl::at(current_extents, dim) = matrix.rows();
+    source = destination;
+  }
+  return true;
+}
 }  // namespace
 
 namespace apply_matrices_detail {
@@ -97,6 +183,14 @@ void Impl<ElementType, Dim, DimensionIsIdentity...>::apply(
     const gsl::not_null<ElementType*> result,
     const std::array<MatrixType, Dim>& matrices, const ElementType* const data,
     const Index<Dim>& extents, const size_t number_of_independent_components) {
+  if constexpr (sizeof...(DimensionIsIdentity) == 0) {
+    // Small matrices are applied with kernels specialized on their size,
+    // falling back to BLAS below for larger or 1x1 matrices.
+    if (apply_fixed_size(result, matrices, data, extents,
+                         number_of_independent_components)) {
+      return;
+    }
+  }
   if (dereference_wrapper(matrices[sizeof...(DimensionIsIdentity)]) ==
       Matrix{}) {
     Impl<ElementType, Dim, DimensionIsIdentity..., true>::apply(
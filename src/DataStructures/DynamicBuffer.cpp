@@ -3,8 +3,10 @@
 
 #include "DataStructures/DynamicBuffer.hpp"
 
+#include <algorithm>
 #include <pup_stl.h>
 
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 
@@ -30,35 +32,65 @@ DynamicBuffer<T>::DynamicBuffer(const size_t number_of_vectors,
 }
 
 template <typename T>
-DynamicBuffer<T>::DynamicBuffer(const DynamicBuffer<T>& other)
-    : number_of_grid_points_(other.number_of_grid_points_) {
+DynamicBuffer<T>::DynamicBuffer(
+    const size_t number_of_vectors, const size_t number_of_grid_points,
+    const gsl::not_null<ScratchArena::Scope*> scratch)
+    : number_of_grid_points_(number_of_grid_points), data_(number_of_vectors) {
   if constexpr (is_data_vector_type) {
-    data_.resize(other.size());
-    buffer_ = other.buffer_;
-    set_references();
+    set_references(
+        scratch->allocate<double>(number_of_vectors * number_of_grid_points));
   } else {
-    data_ = other.data_;
+    (void)scratch;
+    if (number_of_grid_points != 1) {
+      ERROR(
+          "DynamicBuffer must have number_of_grid_points == 1 when T is a "
+          "fundamental type but has number_of_grid_points = "
+          << number_of_grid_points_);
+    }
   }
 }
 
+template <typename T>
+DynamicBuffer<T>::DynamicBuffer(const DynamicBuffer<T>& other)
+    : number_of_grid_points_(other.number_of_grid_points_) {
+  copy_from(other);
+}
+
 template <typename T>
 DynamicBuffer<T>& DynamicBuffer<T>::operator=(const DynamicBuffer& other) {
   if (this == &other) {
     return *this;
   }
   number_of_grid_points_ = other.number_of_grid_points_;
+  copy_from(other);
+  return *this;
+}
+
+template <typename T>
+void DynamicBuffer<T>::copy_from(const DynamicBuffer& other) {
   if constexpr (is_data_vector_type) {
     data_.resize(other.size());
-    buffer_ = other.buffer_;
+    if (other.buffer_.size() == other.size() * number_of_grid_points_) {
+      buffer_ = other.buffer_;
+    } else {
+      // The memory of `other` is in a ScratchArena
+      buffer_.resize(other.size() * number_of_grid_points_);
+      for (size_t i = 0; i < other.size(); ++i) {
+        std::copy(other.data_[i].begin(), other.data_[i].end(),
+                  &buffer_[number_of_grid_points_ * i]);
+      }
+    }
     set_references();
   } else {
     data_ = other.data_;
   }
-  return *this;
 }
 
 template <typename T>
 void DynamicBuffer<T>::pup(PUP::er& p) {
+  ASSERT(not is_data_vector_type or
+             buffer_.size() == size() * number_of_grid_points_,
+         "Can't serialize a DynamicBuffer whose memory is in a ScratchArena.");
   p | number_of_grid_points_;
   p | buffer_;
   if constexpr (is_data_vector_type) {
@@ -72,12 +104,17 @@ void DynamicBuffer<T>::pup(PUP::er& p) {
 }
 
 template <typename T>
-void DynamicBuffer<T>::set_references() {
+void DynamicBuffer<T>::set_references(double* scratch_data) {
   if constexpr (is_data_vector_type) {
+    double* const data =
+        scratch_data == nullptr ? buffer_.data() : scratch_data;
     for (size_t i = 0; i < size(); ++i) {
-      data_[i].set_data_ref(&buffer_[number_of_grid_points_ * i],
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+      data_[i].set_data_ref(data + number_of_grid_points_ * i,
                             number_of_grid_points_);
     }
+  } else {
+    (void)scratch_data;
   }
 }
 
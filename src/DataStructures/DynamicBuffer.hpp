@@ -8,6 +8,8 @@
 #include <vector>
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
+#include "Utilities/Gsl.hpp"
 
 /// \cond
 namespace PUP {
@@ -45,6 +47,15 @@ class DynamicBuffer {
    * fundamental type.
    */
   DynamicBuffer(size_t number_of_vectors, size_t number_of_grid_points);
+
+  /*!
+   * Constructs a `DynamicBuffer` whose `DataVector`s point into memory taken
+   * from `scratch`, so no heap allocation is needed. The buffer must not be
+   * used after `scratch` goes out of scope. Copies of the buffer own their
+   * memory.
+   */
+  DynamicBuffer(size_t number_of_vectors, size_t number_of_grid_points,
+                gsl::not_null<ScratchArena::Scope*> scratch);
   ~DynamicBuffer() = default;
   DynamicBuffer(DynamicBuffer&& other) = default;
   DynamicBuffer& operator=(DynamicBuffer&& other) = default;
@@ -69,8 +80,12 @@ class DynamicBuffer {
   void pup(PUP::er& p);
 
  private:
-  // sets data references for all `data_` into `buffer_`
-  void set_references();
+  // sets data references for all `data_` into `buffer_`, or into
+  // `scratch_data` if given
+  void set_references(double* scratch_data = nullptr);
+
+  // copies the data of `other` into `buffer_`
+  void copy_from(const DynamicBuffer& other);
 
   template <typename LocalT>
   // NOLINTNEXTLINE(readability-redundant-declaration)
@@ -81,7 +96,8 @@ class DynamicBuffer {
   // vector of non-owning DataVectors pointing into `buffer_`. In case of
   // fundamental type T the data is saved in `data_` directly.
   std::vector<T> data_;
-  // memory buffer for all DataVectors. Unused in case of fundamental type T.
+  // memory buffer for all DataVectors. Unused in case of fundamental type T
+  // and if the memory is taken from a `ScratchArena`.
   std::vector<double> buffer_;
 };
 
@@ -0,0 +1,104 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "DataStructures/ScratchArena.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MemoryHelpers.hpp"
+
+ScratchArena& ScratchArena::thread_local_arena() {
+  thread_local ScratchArena arena{};
+  return arena;
+}
+
+void ScratchArena::release(const Mark& mark) {
+  ASSERT(mark.block < current_block_ or
+             (mark.block == current_block_ and mark.offset <= offset_),
+         "Scratch memory must be released in the reverse order of its "
+         "allocation.");
+  current_block_ = mark.block;
+  offset_ = mark.offset;
+  bytes_in_previous_blocks_ = mark.bytes_in_previous_blocks;
+  if (bytes_in_use() == 0 and blocks_.size() > 1) {
+    // Merge the blocks so the next round of allocations fits into a single
+    // block
+    const size_t total_capacity = capacity();
+    blocks_.clear();
+    add_block(total_capacity);
+  }
+}
+
+size_t ScratchArena::capacity() const {
+  size_t result = 0;
+  for (const auto& block : blocks_) {
+    result += block.size;
+  }
+  return result;
+}
+
+void ScratchArena::reset_statistics() {
+  peak_bytes_in_use_ = bytes_in_use();
+  number_of_heap_allocations_ = 0;
+}
+
+void* ScratchArena::allocate_bytes(const size_t number_of_bytes,
+                                   const size_t value_alignment) {
+  if (number_of_bytes == 0) {
+    return nullptr;
+  }
+  const size_t allocation_alignment = std::max(value_alignment, alignment);
+  for (;;) {
+    if (not blocks_.empty()) {
+      const Block& block = blocks_[current_block_];
+      const size_t aligned_offset =
+          (offset_ + allocation_alignment - 1) / allocation_alignment *
+          allocation_alignment;
+      if (aligned_offset + number_of_bytes <= block.size) {
+        offset_ = aligned_offset + number_of_bytes;
+        peak_bytes_in_use_ = std::max(peak_bytes_in_use_, bytes_in_use());
+        // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+        return block.data + aligned_offset;
+      }
+      if (current_block_ + 1 < blocks_.size()) {
+        // The rest of this block stays unused until the memory is released
+        bytes_in_previous_blocks_ += block.size;
+        ++current_block_;
+        offset_ = 0;
+        continue;
+      }
+    }
+    add_block(number_of_bytes + allocation_alignment);
+  }
+}
+
+void ScratchArena::add_block(const size_t minimum_size) {
+  // Grow geometrically so the number of blocks stays small
+  const size_t requested_size =
+      std::max({minimum_size, capacity(), minimum_block_size});
+  const size_t size = (requested_size + alignment - 1) / alignment * alignment;
+  Block block{cpp20::make_unique_for_overwrite<std::byte[]>(size + alignment),
+              nullptr, size};
+  void* data = block.memory.get();
+  size_t space = size + alignment;
+  block.data =
+      static_cast<std::byte*>(std::align(alignment, size, data, space));
+  if (UNLIKELY(block.data == nullptr)) {
+    ERROR("Failed to align a scratch memory block of " << size << " bytes.");
+  }
+  if (not blocks_.empty()) {
+    bytes_in_previous_blocks_ += blocks_[current_block_].size;
+    ++current_block_;
+  } else {
+    current_block_ = 0;
+  }
+  offset_ = 0;
+  blocks_.push_back(std::move(block));
+  ++number_of_heap_allocations_;
+}
@@ -0,0 +1,162 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <algorithm>
+#include <complex>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <vector>
+
+#include "Utilities/MakeSignalingNan.hpp"
+#include "Utilities/TypeTraits/IsA.hpp"
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief A bump allocator for short-lived scratch memory.
+ *
+ * \details Algorithms like the DG time derivative and the partial derivatives
+ * need several temporary buffers every time they are called. Allocating them
+ * on the heap every time is expensive when there are many small elements.
+ * Instead, the buffers can be taken from a `ScratchArena`, which hands out
+ * memory by bumping an offset into large blocks that are kept around between
+ * calls.
+ *
+ * Memory is handed out through a `ScratchArena::Scope`, which releases all
+ * memory allocated through it when it goes out of scope. Scopes can be nested,
+ * but must be released in the reverse order of their creation, which is
+ * automatic when they are local variables. Once all memory is released and the
+ * arena had to grow into more than one block, the blocks are merged into a
+ * single block so that subsequent calls don't allocate anymore.
+ *
+ * Each thread has its own arena, `ScratchArena::thread_local_arena()`, which
+ * is used by default. The memory is not initialized, except that floating
+ * point values are set to signaling NaN in Debug builds.
+ *
+ * The statistics `peak_bytes_in_use()` and `number_of_heap_allocations()` can
+ * be used to monitor how much scratch memory is needed.
+ */
+class ScratchArena {
+ public:
+  /// All allocations are aligned to this many bytes
+  static constexpr size_t alignment = 64;
+  /// Blocks are at least this large
+  static constexpr size_t minimum_block_size = 65536;
+
+  class Scope;
+
+  /// The position in the arena at which a `Scope` started
+  struct Mark {
+    size_t block;
+    size_t offset;
+    size_t bytes_in_previous_blocks;
+  };
+
+  ScratchArena() = default;
+  ScratchArena(const ScratchArena&) = delete;
+  ScratchArena& operator=(const ScratchArena&) = delete;
+  ScratchArena(ScratchArena&&) = default;
+  ScratchArena& operator=(ScratchArena&&) = default;
+  ~ScratchArena() = default;
+
+  /// The arena of the calling thread
+  static ScratchArena& thread_local_arena();
+
+  /// \brief Allocate uninitialized memory for `number_of_values` values of
+  /// type `T`.
+  ///
+  /// Prefer allocating through a `ScratchArena::Scope`, which releases the
+  /// memory automatically.
+  template <typename T>
+  T* allocate(size_t number_of_values);
+
+  /// The current position in the arena, see `release()`
+  Mark mark() const {
+    return {current_block_, offset_, bytes_in_previous_blocks_};
+  }
+
+  /// Release all memory allocated after `mark` was taken.
+  void release(const Mark& mark);
+
+  /// Bytes currently handed out, including padding for alignment
+  size_t bytes_in_use() const { return bytes_in_previous_blocks_ + offset_; }
+  /// The largest value of `bytes_in_use()` since the last call to
+  /// `reset_statistics()`
+  size_t peak_bytes_in_use() const { return peak_bytes_in_use_; }
+  /// Total size of all blocks
+  size_t capacity() const;
+  /// The number of blocks allocated on the heap since the last call to
+  /// `reset_statistics()`
+  size_t number_of_heap_allocations() const {
+    return number_of_heap_allocations_;
+  }
+  void reset_statistics();
+
+ private:
+  struct Block {
+    std::unique_ptr<std::byte[]> memory;
+    std::byte* data;
+    size_t size;
+  };
+
+  void* allocate_bytes(size_t number_of_bytes, size_t value_alignment);
+  void add_block(size_t minimum_size);
+
+  std::vector<Block> blocks_{};
+  size_t current_block_{0};
+  size_t offset_{0};
+  size_t bytes_in_previous_blocks_{0};
+  size_t peak_bytes_in_use_{0};
+  size_t number_of_heap_allocations_{0};
+};
+
+/*!
+ * \brief Allocates from a `ScratchArena` and releases everything it allocated
+ * when it goes out of scope.
+ *
+ * Pointers obtained from a `Scope` must not be used after the `Scope` is
+ * destroyed.
+ */
+class ScratchArena::Scope {
+ public:
+  /// Allocate from the arena of the calling thread
+  Scope() : Scope(ScratchArena::thread_local_arena()) {}
+  explicit Scope(ScratchArena& arena) : arena_(arena), mark_(arena.mark()) {}
+
+  Scope(const Scope&) = delete;
+  Scope& operator=(const Scope&) = delete;
+  Scope(Scope&&) = delete;
+  Scope& operator=(Scope&&) = delete;
+  ~Scope() { arena_.release(mark_); }
+
+  template <typename T>
+  T* allocate(const size_t number_of_values) {
+    return arena_.template allocate<T>(number_of_values);
+  }
+
+  ScratchArena& arena() { return arena_; }
+
+ private:
+  ScratchArena& arena_;
+  Mark mark_;
+};
+
+template <typename T>
+T* ScratchArena::allocate(const size_t number_of_values) {
+  static_assert(std::is_trivially_copyable_v<T> and
+                    std::is_trivially_destructible_v<T>,
+                "ScratchArena only provides memory for trivial types, since "
+                "it neither constructs nor destroys the values.");
+  static_assert(alignof(T) <= alignment);
+  auto* const result = static_cast<T*>(
+      allocate_bytes(number_of_values * sizeof(T), alignof(T)));
+#if defined(SPECTRE_DEBUG) || defined(SPECTRE_NAN_INIT)
+  if constexpr (std::is_floating_point_v<T> or
+                tt::is_a_v<std::complex, T>) {
+    std::fill(result, result + number_of_values, make_signaling_NaN<T>());
+  }
+#endif  // SPECTRE_DEBUG
+  return result;
+}
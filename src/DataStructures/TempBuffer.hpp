@@ -4,8 +4,11 @@
 #pragma once
 
 #include <cstddef>
+#include <type_traits>
 
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
 
@@ -41,3 +44,38 @@ template <typename TagList>
 struct TempBuffer<TagList, false> : Variables<TagList> {
   using Variables<TagList>::Variables;
 };
+
+namespace TempBuffer_detail {
+template <typename T>
+struct is_variables_buffer : std::false_type {};
+
+template <typename TagList>
+struct is_variables_buffer<Variables<TagList>> : std::true_type {};
+
+template <typename TagList>
+struct is_variables_buffer<TempBuffer<TagList, false>> : std::true_type {};
+}  // namespace TempBuffer_detail
+
+/*!
+ * \ingroup DataStructuresGroup
+ * \brief Create a `Variables` or `TempBuffer` with `number_of_grid_points`
+ * grid points whose memory is taken from `scratch`.
+ *
+ * The returned object is non-owning, so it can't be resized and must not be
+ * used after `scratch` goes out of scope. A `TempBuffer` of fundamental types
+ * doesn't allocate, so it is constructed as usual.
+ */
+template <typename BufferType>
+BufferType make_scratch_buffer(
+    const gsl::not_null<ScratchArena::Scope*> scratch,
+    const size_t number_of_grid_points) {
+  if constexpr (TempBuffer_detail::is_variables_buffer<BufferType>::value) {
+    const size_t size =
+        number_of_grid_points * BufferType::number_of_independent_components;
+    return BufferType{
+        scratch->allocate<typename BufferType::value_type>(size), size};
+  } else {
+    (void)scratch;
+    return BufferType{number_of_grid_points};
+  }
+}
@@ -3,19 +3,28 @@
 
 #include "Domain/BlockLogicalCoordinates.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
+#include <limits>
+#include <numeric>
+#include <type_traits>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/IdPair.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/Block.hpp"
+#include "Domain/BlockSpatialIndex.hpp"
 #include "Domain/Domain.hpp"  // IWYU pragma: keep
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
 #include "Domain/Structure/BlockId.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 template <size_t Dim, typename Frame>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
@@ -133,37 +142,227 @@ block_logical_coordinates_single_point(
   return logical_point;
 }
 
+namespace {
+// Clamps logical coordinates to [-1, 1] within roundoff and marks points
+// outside the block as invalid, see `block_logical_coordinates_single_point`.
+template <size_t Dim>
+void clamp_logical_coordinates(
+    const gsl::not_null<tnsr::I<DataVector, Dim, ::Frame::BlockLogical>*>
+        logical_points,
+    const gsl::not_null<std::vector<bool>*> is_valid) {
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if (not(*is_valid)[s]) {
+      continue;
+    }
+    for (size_t d = 0; d < Dim; ++d) {
+      double& logical_coord = logical_points->get(d)[s];
+      if (equal_within_roundoff(logical_coord, 1.0)) {
+        logical_coord = 1.0;
+      } else if (equal_within_roundoff(logical_coord, -1.0)) {
+        logical_coord = -1.0;
+      } else if (abs(logical_coord) > 1.0) {
+        (*is_valid)[s] = false;
+        break;
+      }
+    }
+  }
+}
+
+// Batched version of `block_logical_coordinates_single_point`: maps all
+// `input_points` to the logical frame of `block` at once. On return
+// `is_valid[s]` is `true` only for points inside the block.
 template <size_t Dim, typename Frame>
-std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
-    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
-    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+void block_logical_coordinates_in_block(
+    const gsl::not_null<tnsr::I<DataVector, Dim, ::Frame::BlockLogical>*>
+        logical_points,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const tnsr::I<DataVector, Dim, Frame>& input_points,
+    const Block<Dim>& block, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  const size_t num_points = get<0>(input_points).size();
+  if (block.is_time_dependent()) {
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial> or
+                  std::is_same_v<Frame, ::Frame::Distorted>) {
+      tnsr::I<DataVector, Dim, ::Frame::Grid> grid_points{};
+      std::vector<bool> grid_is_valid{};
+      if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+        block.moving_mesh_grid_to_inertial_map().inverse(
+            make_not_null(&grid_points), make_not_null(&grid_is_valid),
+            input_points, time, functions_of_time);
+      } else {
+        // See `block_logical_coordinates_single_point` for why blocks
+        // without a distorted frame are skipped.
+        if (not block.has_distorted_frame()) {
+          is_valid->assign(num_points, false);
+          return;
+        }
+        block.moving_mesh_grid_to_distorted_map().inverse(
+            make_not_null(&grid_points), make_not_null(&grid_is_valid),
+            input_points, time, functions_of_time);
+      }
+      // logical to grid map is time-independent. Only the points that the
+      // grid map could invert are passed on, because the grid coordinates
+      // of the others are unspecified.
+      const size_t num_grid_valid = static_cast<size_t>(
+          std::count(grid_is_valid.begin(), grid_is_valid.end(), true));
+      if (num_grid_valid == num_points) {
+        block.moving_mesh_logical_to_grid_map().inverse(
+            logical_points, is_valid, grid_points);
+      } else {
+        for (size_t d = 0; d < Dim; ++d) {
+          logical_points->get(d).destructive_resize(num_points);
+        }
+        is_valid->assign(num_points, false);
+        if (num_grid_valid > 0) {
+          tnsr::I<DataVector, Dim, ::Frame::Grid> valid_grid_points(
+              num_grid_valid);
+          for (size_t s = 0, valid_s = 0; s < num_points; ++s) {
+            if (grid_is_valid[s]) {
+              for (size_t d = 0; d < Dim; ++d) {
+                valid_grid_points.get(d)[valid_s] = grid_points.get(d)[s];
+              }
+              ++valid_s;
+            }
+          }
+          tnsr::I<DataVector, Dim, ::Frame::BlockLogical>
+              valid_logical_points{};
+          std::vector<bool> valid_is_valid{};
+          block.moving_mesh_logical_to_grid_map().inverse(
+              make_not_null(&valid_logical_points),
+              make_not_null(&valid_is_valid), valid_grid_points);
+          for (size_t s = 0, valid_s = 0; s < num_points; ++s) {
+            if (grid_is_valid[s]) {
+              for (size_t d = 0; d < Dim; ++d) {
+                logical_points->get(d)[s] =
+                    valid_logical_points.get(d)[valid_s];
+              }
+              (*is_valid)[s] = valid_is_valid[valid_s];
+              ++valid_s;
+            }
+          }
+        }
+      }
+    } else {
+      (void)time;
+      static_assert(std::is_same_v<Frame, ::Frame::Grid>,
+                    "Cannot convert from given frame to Grid frame");
+      block.moving_mesh_logical_to_grid_map().inverse(logical_points, is_valid,
+                                                      input_points);
+    }
+  } else {  // not block.is_time_dependent()
+    if constexpr (std::is_same_v<Frame, ::Frame::Inertial>) {
+      block.stationary_map().inverse(logical_points, is_valid, input_points);
+    } else {
+      // If the map is time-independent, then the grid, distorted, and
+      // inertial frames are the same.
+      static_assert(std::is_same_v<Frame, ::Frame::Grid> or
+                        std::is_same_v<Frame, ::Frame::Distorted>,
+                    "Cannot convert from given frame to Inertial frame");
+      tnsr::I<DataVector, Dim, ::Frame::Inertial> x_inertial{};
+      for (size_t d = 0; d < Dim; ++d) {
+        x_inertial.get(d) = input_points.get(d);
+      }
+      block.stationary_map().inverse(logical_points, is_valid, x_inertial);
+    }
+  }
+
+  clamp_logical_coordinates(logical_points, is_valid);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates_impl(
+    const Domain<Dim>& domain,
+    const domain::BlockSpatialIndex<Dim>* const spatial_index,
+    const tnsr::I<DataVector, Dim, Frame>& x, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
   const size_t num_pts = get<0>(x).size();
   std::vector<BlockLogicalCoords<Dim>> block_coord_holders(num_pts);
-  for (size_t s = 0; s < num_pts; ++s) {
-    tnsr::I<double, Dim, Frame> x_frame(0.0);
+  // Indices into `x` of the points that have not been found in a block yet.
+  // All candidate points are mapped through each block's inverse at once, so
+  // maps with a batched inverse are evaluated with vectorized math.
+  std::vector<size_t> remaining_points(num_pts);
+  std::iota(remaining_points.begin(), remaining_points.end(), 0_st);
+  constexpr size_t found = std::numeric_limits<size_t>::max();
+  // Indices into `remaining_points` of the points that may be in the block
+  std::vector<size_t> candidates{};
+  candidates.reserve(num_pts);
+  std::array<double, Dim> point{};
+  tnsr::I<DataVector, Dim, Frame> x_candidates{};
+  tnsr::I<DataVector, Dim, ::Frame::BlockLogical> x_logical{};
+  std::vector<bool> is_valid{};
+  // Check which block each point is in. Each point will be in one
+  // and only one block, unless it is on a shared boundary.  In that
+  // case, choose the first matching block (and this block will have
+  // the smallest block_id).
+  for (const auto& block : domain.blocks()) {
+    if (remaining_points.empty()) {
+      break;
+    }
+    candidates.clear();
+    for (size_t i = 0; i < remaining_points.size(); ++i) {
+      if (spatial_index != nullptr) {
+        for (size_t d = 0; d < Dim; ++d) {
+          gsl::at(point, d) = x.get(d)[remaining_points[i]];
+        }
+        if (not spatial_index->template may_contain<Frame>(block.id(), point,
+                                                           time)) {
+          continue;
+        }
+      }
+      candidates.push_back(i);
+    }
+    if (candidates.empty()) {
+      continue;
+    }
+    const size_t num_candidates = candidates.size();
     for (size_t d = 0; d < Dim; ++d) {
-      x_frame.get(d) = x.get(d)[s];
+      x_candidates.get(d).destructive_resize(num_candidates);
+      for (size_t j = 0; j < num_candidates; ++j) {
+        x_candidates.get(d)[j] = x.get(d)[remaining_points[candidates[j]]];
+      }
     }
-    // Check which block this point is in. Each point will be in one
-    // and only one block, unless it is on a shared boundary.  In that
-    // case, choose the first matching block (and this block will have
-    // the smallest block_id).
-    for (const auto& block : domain.blocks()) {
-      std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>> x_logical =
-          block_logical_coordinates_single_point(x_frame, block, time,
-                                                 functions_of_time);
-
-      if (x_logical.has_value()) {
+    block_logical_coordinates_in_block(make_not_null(&x_logical),
+                                       make_not_null(&is_valid), x_candidates,
+                                       block, time, functions_of_time);
+
+    for (size_t j = 0; j < num_candidates; ++j) {
+      if (is_valid[j]) {
         // Point is in this block.  Don't bother checking subsequent
         // blocks.
-        block_coord_holders[s] = make_id_pair(domain::BlockId(block.id()),
-                                              std::move(x_logical.value()));
-        break;
+        tnsr::I<double, Dim, ::Frame::BlockLogical> logical_point{};
+        for (size_t d = 0; d < Dim; ++d) {
+          logical_point.get(d) = x_logical.get(d)[j];
+        }
+        block_coord_holders[remaining_points[candidates[j]]] = make_id_pair(
+            domain::BlockId(block.id()), std::move(logical_point));
+        remaining_points[candidates[j]] = found;
       }
     }
+    remaining_points.erase(std::remove(remaining_points.begin(),
+                                       remaining_points.end(), found),
+                           remaining_points.end());
   }
   return block_coord_holders;
 }
+}  // namespace
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
+    const double time, const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl(domain, nullptr, x, time,
+                                        functions_of_time);
+}
+
+template <size_t Dim, typename Frame>
+std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
+    const Domain<Dim>& domain,
+    const domain::BlockSpatialIndex<Dim>& spatial_index,
+    const tnsr::I<DataVector, Dim, Frame>& x, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  return block_logical_coordinates_impl(domain, &spatial_index, x, time,
+                                        functions_of_time);
+}
 
 // Explicit instantiations
 #define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
@@ -179,6 +378,12 @@ std::vector<BlockLogicalCoords<Dim>> block_logical_coordinates(
   block_logical_coordinates(                                                   \
       const Domain<DIM(data)>& domain,                                         \
       const tnsr::I<DataVector, DIM(data), FRAME(data)>& x, const double time, \
+      const domain::FunctionsOfTimeMap& functions_of_time);                    \
+  template std::vector<BlockLogicalCoords<DIM(data)>>                          \
+  block_logical_coordinates(                                                   \
+      const Domain<DIM(data)>& domain,                                         \
+      const domain::BlockSpatialIndex<DIM(data)>& spatial_index,               \
+      const tnsr::I<DataVector, DIM(data), FRAME(data)>& x, const double time, \
       const domain::FunctionsOfTimeMap& functions_of_time);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
@@ -21,6 +21,10 @@ template <size_t VolumeDim>
 class Domain;
 template <size_t VolumeDim>
 class Block;
+namespace domain {
+template <size_t Dim>
+class BlockSpatialIndex;
+}  // namespace domain
 /// \endcond
 
 template <size_t Dim>
@@ -62,6 +66,14 @@ using BlockLogicalCoords = std::optional<
 /// typical use cases.  This means that `block_logical_coordinates`
 /// does not assume that grid and distorted frames are equal in
 /// `Block`s that lack a distorted frame.
+///
+/// The overload taking a `domain::BlockSpatialIndex` only inverts the maps of
+/// a `Block` for the points that lie in the bounding box of that `Block`. This
+/// avoids most of the failing map inverses on domains with many `Block`s.
+/// Build the index once per `Domain`, and call
+/// `domain::BlockSpatialIndex::update` at `time` if the maps are
+/// time-dependent and `x` is not in the grid frame (otherwise no bounding
+/// boxes are used for the time-dependent `Block`s).
 template <size_t Dim, typename Frame>
 auto block_logical_coordinates(
     const Domain<Dim>& domain, const tnsr::I<DataVector, Dim, Frame>& x,
@@ -69,6 +81,15 @@ auto block_logical_coordinates(
     const domain::FunctionsOfTimeMap& functions_of_time = {})
     -> std::vector<BlockLogicalCoords<Dim>>;
 
+template <size_t Dim, typename Frame>
+auto block_logical_coordinates(
+    const Domain<Dim>& domain,
+    const domain::BlockSpatialIndex<Dim>& spatial_index,
+    const tnsr::I<DataVector, Dim, Frame>& x,
+    double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {})
+    -> std::vector<BlockLogicalCoords<Dim>>;
+
 template <size_t Dim, typename Frame>
 std::optional<tnsr::I<double, Dim, ::Frame::BlockLogical>>
 block_logical_coordinates_single_point(
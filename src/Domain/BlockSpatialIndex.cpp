@@ -0,0 +1,230 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/BlockSpatialIndex.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <type_traits>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/Block.hpp"
+#include "Domain/Domain.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+namespace domain {
+namespace {
+template <size_t Dim>
+tnsr::I<DataVector, Dim, Frame::BlockLogical> logical_lattice(
+    const size_t number_of_samples_per_dim) {
+  size_t num_points = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    num_points *= number_of_samples_per_dim;
+  }
+  tnsr::I<DataVector, Dim, Frame::BlockLogical> result{num_points};
+  const double spacing =
+      2.0 / static_cast<double>(number_of_samples_per_dim - 1);
+  for (size_t i = 0; i < num_points; ++i) {
+    size_t stride = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      const size_t index = (i / stride) % number_of_samples_per_dim;
+      result.get(d)[i] = -1.0 + spacing * static_cast<double>(index);
+      stride *= number_of_samples_per_dim;
+    }
+  }
+  return result;
+}
+
+template <size_t Dim, typename Frame>
+typename BlockSpatialIndex<Dim>::BoundingBox bounding_box(
+    const tnsr::I<DataVector, Dim, Frame>& samples,
+    const size_t number_of_samples_per_dim) {
+  typename BlockSpatialIndex<Dim>::BoundingBox result{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(result.lower_corner, d) = min(samples.get(d));
+    gsl::at(result.upper_corner, d) = max(samples.get(d));
+  }
+  // Pad by the largest distance between neighboring samples so the box also
+  // encloses the image of the block between the samples.
+  const size_t num_points = get<0>(samples).size();
+  double max_square_spacing = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    size_t stride = 1;
+    for (size_t d = 0; d < Dim; ++d) {
+      if ((i / stride) % number_of_samples_per_dim + 1 <
+          number_of_samples_per_dim) {
+        double square_spacing = 0.0;
+        for (size_t k = 0; k < Dim; ++k) {
+          square_spacing +=
+              square(samples.get(k)[i + stride] - samples.get(k)[i]);
+        }
+        max_square_spacing = std::max(max_square_spacing, square_spacing);
+      }
+      stride *= number_of_samples_per_dim;
+    }
+  }
+  const double padding = sqrt(max_square_spacing);
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(result.lower_corner, d) -= padding;
+    gsl::at(result.upper_corner, d) += padding;
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim>
+bool BlockSpatialIndex<Dim>::BoundingBox::contains(
+    const std::array<double, Dim>& point) const {
+  for (size_t d = 0; d < Dim; ++d) {
+    if (gsl::at(point, d) < gsl::at(lower_corner, d) or
+        gsl::at(point, d) > gsl::at(upper_corner, d)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+template <size_t Dim>
+void BlockSpatialIndex<Dim>::BoundingBox::pup(PUP::er& p) {
+  p | lower_corner;
+  p | upper_corner;
+}
+
+template <size_t Dim>
+BlockSpatialIndex<Dim>::BlockSpatialIndex(
+    const Domain<Dim>& domain, const size_t number_of_samples_per_dim)
+    : number_of_samples_per_dim_(number_of_samples_per_dim) {
+  ASSERT(number_of_samples_per_dim_ >= 2,
+         "Need at least 2 samples per dimension to bound a block, not "
+             << number_of_samples_per_dim_);
+  const auto logical_samples = logical_lattice<Dim>(number_of_samples_per_dim_);
+  const size_t num_blocks = domain.blocks().size();
+  grid_boxes_.reserve(num_blocks);
+  grid_samples_.resize(num_blocks);
+  inertial_boxes_.resize(num_blocks);
+  distorted_boxes_.resize(num_blocks);
+  for (const auto& block : domain.blocks()) {
+    ASSERT(block.id() == grid_boxes_.size(),
+           "Expected blocks to be ordered by id, but block "
+               << block.id() << " is at position " << grid_boxes_.size());
+    if (block.is_time_dependent()) {
+      auto grid_samples =
+          block.moving_mesh_logical_to_grid_map()(logical_samples);
+      grid_boxes_.push_back(
+          bounding_box(grid_samples, number_of_samples_per_dim_));
+      grid_samples_[block.id()] = std::move(grid_samples);
+    } else {
+      grid_boxes_.push_back(bounding_box(
+          block.stationary_map()(logical_samples), number_of_samples_per_dim_));
+    }
+  }
+}
+
+template <size_t Dim>
+void BlockSpatialIndex<Dim>::update(
+    const Domain<Dim>& domain, const double time,
+    const domain::FunctionsOfTimeMap& functions_of_time) {
+  ASSERT(domain.blocks().size() == grid_boxes_.size(),
+         "The BlockSpatialIndex was built for a domain with "
+             << grid_boxes_.size() << " blocks, but the domain has "
+             << domain.blocks().size());
+  for (const auto& block : domain.blocks()) {
+    if (not block.is_time_dependent()) {
+      continue;
+    }
+    const auto& grid_samples = grid_samples_[block.id()];
+    ASSERT(grid_samples.has_value(),
+           "Block " << block.id()
+                    << " is time-dependent, but was time-independent when the "
+                       "BlockSpatialIndex was built.");
+    inertial_boxes_[block.id()] = bounding_box(
+        block.moving_mesh_grid_to_inertial_map()(*grid_samples, time,
+                                                 functions_of_time),
+        number_of_samples_per_dim_);
+    if (block.has_distorted_frame()) {
+      distorted_boxes_[block.id()] = bounding_box(
+          block.moving_mesh_grid_to_distorted_map()(*grid_samples, time,
+                                                    functions_of_time),
+          number_of_samples_per_dim_);
+    } else {
+      distorted_boxes_[block.id()] = std::nullopt;
+    }
+  }
+  time_ = time;
+}
+
+template <size_t Dim>
+template <typename Frame>
+bool BlockSpatialIndex<Dim>::may_contain(const size_t block_id,
+                                         const std::array<double, Dim>& point,
+                                         const double time) const {
+  ASSERT(block_id < grid_boxes_.size(),
+         "Block id " << block_id << " is out of range for a domain with "
+                     << grid_boxes_.size() << " blocks.");
+  const bool block_is_time_dependent = grid_samples_[block_id].has_value();
+  if constexpr (std::is_same_v<Frame, ::Frame::Grid>) {
+    (void)time;
+    (void)block_is_time_dependent;
+    return grid_boxes_[block_id].contains(point);
+  } else {
+    static_assert(std::is_same_v<Frame, ::Frame::Inertial> or
+                      std::is_same_v<Frame, ::Frame::Distorted>,
+                  "BlockSpatialIndex only supports the grid, distorted and "
+                  "inertial frames.");
+    if (not block_is_time_dependent) {
+      return grid_boxes_[block_id].contains(point);
+    }
+    // The boxes of time-dependent blocks are only known at `time_`. Check for
+    // NaN first so a signaling NaN is never compared.
+    if (std::isnan(time) or std::isnan(time_) or time != time_) {
+      return true;
+    }
+    const auto& box = std::is_same_v<Frame, ::Frame::Inertial>
+                          ? inertial_boxes_[block_id]
+                          : distorted_boxes_[block_id];
+    return not box.has_value() or box->contains(point);
+  }
+}
+
+template <size_t Dim>
+void BlockSpatialIndex<Dim>::pup(PUP::er& p) {
+  p | number_of_samples_per_dim_;
+  p | grid_boxes_;
+  p | grid_samples_;
+  p | inertial_boxes_;
+  p | distorted_boxes_;
+  p | time_;
+}
+
+#define DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+#define FRAME(data) BOOST_PP_TUPLE_ELEM(1, data)
+
+#define INSTANTIATE(_, data) template class BlockSpatialIndex<DIM(data)>;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3))
+
+#undef INSTANTIATE
+
+#define INSTANTIATE(_, data)                                            \
+  template bool BlockSpatialIndex<DIM(data)>::may_contain<FRAME(data)>( \
+      size_t block_id, const std::array<double, DIM(data)>& point,      \
+      double time) const;
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 2, 3),
+                        (::Frame::Grid, ::Frame::Distorted, ::Frame::Inertial))
+
+#undef INSTANTIATE
+#undef FRAME
+#undef DIM
+}  // namespace domain
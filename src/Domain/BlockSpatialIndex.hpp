@@ -0,0 +1,101 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+
+/// \cond
+template <size_t VolumeDim>
+class Domain;
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace domain {
+/*!
+ * \ingroup ComputationalDomainGroup
+ * \brief Axis-aligned bounding boxes of all `Block`s of a `Domain`, used to
+ * skip blocks that cannot contain a point before inverting their maps.
+ *
+ * \details The bounding box of a block is computed by mapping a uniform lattice
+ * of `number_of_samples_per_dim` points per dimension in the block logical
+ * frame through the block's maps. The box is padded by the largest distance
+ * between neighboring mapped lattice points so that it also encloses the image
+ * of the block between the samples. This assumes that the maps don't vary
+ * wildly on the scale of the lattice spacing, which is the case for all maps
+ * used in practice.
+ *
+ * - For time-independent blocks the box is computed once, in the inertial
+ *   frame (which is the same as the grid and distorted frames).
+ * - For time-dependent blocks the box in the grid frame is computed once,
+ *   because the logical to grid map is time-independent. The boxes in the
+ *   inertial and distorted frames depend on the FunctionsOfTime and are
+ *   recomputed by `update()`. The grid-frame samples are kept so an update
+ *   only has to evaluate the time-dependent maps.
+ *
+ * `may_contain()` is conservative: it returns `true` whenever no box is known
+ * for the requested frame and time.
+ */
+template <size_t Dim>
+class BlockSpatialIndex {
+ public:
+  struct BoundingBox {
+    std::array<double, Dim> lower_corner{};
+    std::array<double, Dim> upper_corner{};
+
+    bool contains(const std::array<double, Dim>& point) const;
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  BlockSpatialIndex() = default;
+
+  explicit BlockSpatialIndex(const Domain<Dim>& domain,
+                             size_t number_of_samples_per_dim = 5);
+
+  /// Recompute the inertial- and distorted-frame bounding boxes of all
+  /// time-dependent blocks at `time`.
+  void update(const Domain<Dim>& domain, double time,
+              const domain::FunctionsOfTimeMap& functions_of_time);
+
+  /// Returns `false` only if the `point`, given in `Frame` at `time`, is
+  /// certainly not inside the block with id `block_id`.
+  template <typename Frame>
+  bool may_contain(
+      size_t block_id, const std::array<double, Dim>& point,
+      double time = std::numeric_limits<double>::signaling_NaN()) const;
+
+  /// The time at which the boxes of the time-dependent blocks were last
+  /// computed by `update()`, or NaN if they haven't been computed.
+  double time() const { return time_; }
+
+  size_t number_of_blocks() const { return grid_boxes_.size(); }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  size_t number_of_samples_per_dim_{0};
+  // Boxes in the grid frame of all blocks. For time-independent blocks this
+  // is also the box in the inertial and distorted frames.
+  std::vector<BoundingBox> grid_boxes_{};
+  // Lattice samples in the grid frame. Only set for time-dependent blocks.
+  std::vector<std::optional<tnsr::I<DataVector, Dim, Frame::Grid>>>
+      grid_samples_{};
+  // Boxes of time-dependent blocks at `time_`
+  std::vector<std::optional<BoundingBox>> inertial_boxes_{};
+  std::vector<std::optional<BoundingBox>> distorted_boxes_{};
+  double time_{std::numeric_limits<double>::quiet_NaN()};
+};
+}  // namespace domain
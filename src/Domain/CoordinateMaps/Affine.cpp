@@ -37,6 +37,14 @@ std::optional<std::array<double, 1>> Affine::inverse(
             length_of_range_}}};
 }
 
+void Affine::inverse(
+    const gsl::not_null<std::array<DataVector, 1>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> /*is_valid*/) const {
+  (*target_coords)[0] =
+      (length_of_domain_ * (*target_coords)[0] - a_ * B_ + b_ * A_) /
+      length_of_range_;
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 1, Frame::NoFrame> Affine::jacobian(
     const std::array<T, 1>& source_coords) const {
@@ -0,0 +1,115 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines function domain::CoordinateMaps::batched_inverse
+
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TypeTraits/CreateIsCallable.hpp"
+
+namespace domain::CoordinateMaps {
+namespace batched_inverse_detail {
+CREATE_IS_CALLABLE(inverse)
+CREATE_IS_CALLABLE_V(inverse)
+}  // namespace batched_inverse_detail
+
+/// \ingroup CoordinateMapsGroup
+/// \brief Check if the coordinate map `Map` provides a batched inverse, i.e.
+/// a member function
+///
+/// \code
+/// void inverse(gsl::not_null<std::array<DataVector, dim>*> target_coords,
+///              gsl::not_null<std::vector<bool>*> is_valid) const;
+/// \endcode
+///
+/// (with additional `time` and `functions_of_time` arguments if the map is
+/// time-dependent) that maps all points in `target_coords` in place.
+template <typename Map>
+constexpr bool has_batched_inverse_v =
+    is_map_time_dependent_v<Map>
+        ? batched_inverse_detail::is_inverse_callable_v<
+              const Map&, gsl::not_null<std::array<DataVector, Map::dim>*>,
+              gsl::not_null<std::vector<bool>*>, double,
+              const std::unordered_map<
+                  std::string,
+                  std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&>
+        : batched_inverse_detail::is_inverse_callable_v<
+              const Map&, gsl::not_null<std::array<DataVector, Map::dim>*>,
+              gsl::not_null<std::vector<bool>*>>;
+
+/*!
+ * \ingroup CoordinateMapsGroup
+ * \brief Apply the inverse of `map` to many points at once, in place.
+ *
+ * \details On entry `coords` holds the target-frame coordinates and on exit it
+ * holds the source-frame coordinates. Only points with `is_valid[s] == true`
+ * are inverted, and `is_valid[s]` is set to `false` for every point at which
+ * the inverse fails. The values of `coords` at invalid points are unspecified
+ * on exit.
+ *
+ * If `Map` provides a batched inverse (see
+ * `domain::CoordinateMaps::has_batched_inverse_v`) it is used, so the inverse
+ * is evaluated with vectorized `DataVector` math. Otherwise the scalar inverse
+ * of the map is called point by point.
+ */
+template <typename Map>
+void batched_inverse(
+    const gsl::not_null<std::array<DataVector, Map::dim>*> coords,
+    const gsl::not_null<std::vector<bool>*> is_valid, const Map& map,
+    [[maybe_unused]] const double time =
+        std::numeric_limits<double>::signaling_NaN(),
+    [[maybe_unused]] const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time = {}) {
+  constexpr size_t dim = Map::dim;
+  ASSERT(is_valid->size() == (*coords)[0].size(),
+         "The validity mask has size " << is_valid->size()
+                                       << " but the coordinates have size "
+                                       << (*coords)[0].size());
+  if constexpr (has_batched_inverse_v<Map>) {
+    if constexpr (is_map_time_dependent_v<Map>) {
+      map.inverse(coords, is_valid, time, functions_of_time);
+    } else {
+      map.inverse(coords, is_valid);
+    }
+  } else {
+    std::array<double, dim> target_point{};
+    std::optional<std::array<double, dim>> source_point{};
+    for (size_t s = 0; s < is_valid->size(); ++s) {
+      if (not(*is_valid)[s]) {
+        continue;
+      }
+      for (size_t d = 0; d < dim; ++d) {
+        gsl::at(target_point, d) = gsl::at(*coords, d)[s];
+      }
+      if constexpr (is_map_time_dependent_v<Map>) {
+        source_point = map.inverse(target_point, time, functions_of_time);
+      } else {
+        source_point = map.inverse(target_point);
+      }
+      if (source_point.has_value()) {
+        for (size_t d = 0; d < dim; ++d) {
+          gsl::at(*coords, d)[s] = gsl::at(source_point.value(), d);
+        }
+      } else {
+        (*is_valid)[s] = false;
+      }
+    }
+  }
+}
+}  // namespace domain::CoordinateMaps
@@ -3,8 +3,10 @@
 
 #include "Domain/CoordinateMaps/Composition.hpp"
 
+#include <algorithm>
 #include <tuple>
 #include <type_traits>
+#include <vector>
 
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
@@ -81,6 +83,81 @@ Composition<Frames, Dim, std::index_sequence<Is...>>::inverse(
   return inverse_impl(std::move(target_point), time, functions_of_time);
 }
 
+template <typename Frames, size_t Dim, size_t... Is>
+void Composition<Frames, Dim, std::index_sequence<Is...>>::inverse(
+    const gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_point,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const tnsr::I<DataVector, Dim, TargetFrame>& target_point,
+    const double time, const FuncOfTimeMap& functions_of_time) const {
+  const size_t num_points = get<0>(target_point).size();
+  is_valid->assign(num_points, true);
+  size_t num_valid = num_points;
+  std::vector<bool> map_is_valid{};
+  std::tuple<tnsr::I<DataVector, Dim, tmpl::at<frames, tmpl::size_t<Is>>>...,
+             tnsr::I<DataVector, Dim, TargetFrame>>
+      points{};
+  get<num_frames - 1>(points) = target_point;
+  const auto apply_inverse = [&points, &is_valid, &num_valid, &map_is_valid,
+                              &num_points, &time, &functions_of_time,
+                              this](const auto index_v) {
+    constexpr size_t index = decltype(index_v)::value;
+    // index runs from 0 to num_frames - 2. We evaluate maps in reverse order.
+    const auto& local_target_point = get<num_frames - index - 1>(points);
+    auto& local_source_point = get<num_frames - index - 2>(points);
+    const auto& map = *get<num_frames - index - 2>(maps_);
+    if (UNLIKELY(map.is_identity())) {
+      for (size_t d = 0; d < Dim; ++d) {
+        local_source_point.get(d) = local_target_point.get(d);
+      }
+    } else if (num_valid == num_points) {
+      map.inverse(make_not_null(&local_source_point),
+                  make_not_null(&map_is_valid), local_target_point, time,
+                  functions_of_time);
+      for (size_t s = 0; s < num_points; ++s) {
+        (*is_valid)[s] = map_is_valid[s];
+      }
+    } else {
+      // Only the points that the previous maps could invert are passed on,
+      // because the coordinates of the others are unspecified. The
+      // coordinates of the invalid points stay unspecified.
+      for (size_t d = 0; d < Dim; ++d) {
+        local_source_point.get(d).destructive_resize(num_points);
+      }
+      if (num_valid == 0) {
+        return '0';
+      }
+      std::decay_t<decltype(local_target_point)> valid_target_point(
+          num_valid);
+      for (size_t s = 0, valid_s = 0; s < num_points; ++s) {
+        if ((*is_valid)[s]) {
+          for (size_t d = 0; d < Dim; ++d) {
+            valid_target_point.get(d)[valid_s] = local_target_point.get(d)[s];
+          }
+          ++valid_s;
+        }
+      }
+      std::decay_t<decltype(local_source_point)> valid_source_point{};
+      map.inverse(make_not_null(&valid_source_point),
+                  make_not_null(&map_is_valid), valid_target_point, time,
+                  functions_of_time);
+      for (size_t s = 0, valid_s = 0; s < num_points; ++s) {
+        if ((*is_valid)[s]) {
+          for (size_t d = 0; d < Dim; ++d) {
+            local_source_point.get(d)[s] = valid_source_point.get(d)[valid_s];
+          }
+          (*is_valid)[s] = map_is_valid[valid_s];
+          ++valid_s;
+        }
+      }
+    }
+    num_valid = static_cast<size_t>(
+        std::count(is_valid->begin(), is_valid->end(), true));
+    return '0';
+  };
+  EXPAND_PACK_LEFT_TO_RIGHT(apply_inverse(tmpl::size_t<Is>{}));
+  *source_point = std::move(get<0>(points));
+}
+
 template <typename Frames, size_t Dim, size_t... Is>
 InverseJacobian<double, Dim, tmpl::front<Frames>, tmpl::back<Frames>>
 Composition<Frames, Dim, std::index_sequence<Is...>>::inv_jacobian(
@@ -22,6 +22,7 @@
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -134,6 +135,27 @@ class CoordinateMapBase : public PUP::able {
       const = 0;
   /// @}
 
+  /// Apply the inverse `Maps` to many points at once.
+  ///
+  /// On return `is_valid[s]` is `false` for each point `s` at which the
+  /// single-point `inverse` would return an invalid std::optional, and
+  /// `source_point` holds the inverse-mapped coordinates of all other points.
+  /// The values of `source_point` at invalid points are unspecified. Maps that
+  /// provide a batched inverse are evaluated with vectorized math over all
+  /// points (see `domain::CoordinateMaps::batched_inverse`).
+  virtual void inverse(
+      gsl::not_null<tnsr::I<DataVector, Dim, SourceFrame>*> source_point,
+      gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, Dim, TargetFrame>& target_point,
+      double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const = 0;
+
   /// @{
   /// Compute the inverse Jacobian of the `Maps` at the point(s)
   /// `source_point`
@@ -345,6 +367,22 @@ class CoordinateMap
     return inverse_impl(std::move(target_point), time, functions_of_time,
                         std::make_index_sequence<sizeof...(Maps)>{});
   }
+  void inverse(
+      const gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_point,
+      const gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, dim, TargetFrame>& target_point,
+      const double time = std::numeric_limits<double>::signaling_NaN(),
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time = std::unordered_map<
+              std::string,
+              std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>{})
+      const override {
+    batched_inverse_impl(source_point, is_valid, target_point, time,
+                         functions_of_time,
+                         std::make_index_sequence<sizeof...(Maps)>{});
+  }
   /// @}
 
   /// @{
@@ -535,6 +573,17 @@ class CoordinateMap
           functions_of_time,
       std::index_sequence<Is...> /*meta*/) const;
 
+  template <size_t... Is>
+  void batched_inverse_impl(
+      gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_point,
+      gsl::not_null<std::vector<bool>*> is_valid,
+      const tnsr::I<DataVector, dim, TargetFrame>& target_point, double time,
+      const std::unordered_map<
+          std::string,
+          std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+          functions_of_time,
+      std::index_sequence<Is...> /*meta*/) const;
+
   template <typename T>
   InverseJacobian<T, dim, SourceFrame, TargetFrame> inv_jacobian_impl(
       tnsr::I<T, dim, SourceFrame>&& source_point, double time,
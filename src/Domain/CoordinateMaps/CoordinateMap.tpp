@@ -21,8 +21,10 @@
 #include <utility>
 #include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Identity.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/BatchedInverse.hpp"
 #include "Domain/CoordinateMaps/CoordinateMapHelpers.hpp"
 #include "Domain/CoordinateMaps/TimeDependentHelpers.hpp"
 #include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
@@ -217,6 +219,52 @@ CoordinateMap<SourceFrame, TargetFrame, Maps...>::inverse_impl(
              : std::optional<tnsr::I<T, dim, SourceFrame>>{};
 }
 
+template <typename SourceFrame, typename TargetFrame, typename... Maps>
+template <size_t... Is>
+void CoordinateMap<SourceFrame, TargetFrame, Maps...>::batched_inverse_impl(
+    const gsl::not_null<tnsr::I<DataVector, dim, SourceFrame>*> source_point,
+    const gsl::not_null<std::vector<bool>*> is_valid,
+    const tnsr::I<DataVector, dim, TargetFrame>& target_point,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time,
+    std::index_sequence<Is...> /*meta*/) const {
+  check_functions_of_time(functions_of_time);
+  is_valid->assign(get<0>(target_point).size(), true);
+  std::array<DataVector, dim> mapped_point{};
+  for (size_t d = 0; d < dim; ++d) {
+    gsl::at(mapped_point, d) = target_point.get(d);
+  }
+
+  EXPAND_PACK_LEFT_TO_RIGHT(
+      [&is_valid](const auto& the_map, std::array<DataVector, dim>& point,
+                  const double t,
+                  const std::unordered_map<
+                      std::string,
+                      std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+                      funcs_of_time) {
+        if constexpr (domain::is_map_time_dependent_t<decltype(the_map)>{}) {
+          CoordinateMaps::batched_inverse(make_not_null(&point), is_valid,
+                                          the_map, t, funcs_of_time);
+        } else {
+          (void)t;
+          (void)funcs_of_time;
+          if (LIKELY(not the_map.is_identity())) {
+            CoordinateMaps::batched_inverse(make_not_null(&point), is_valid,
+                                            the_map);
+          }
+        }
+        // this is the inverse function, so the iterator sequence below is
+        // reversed
+      }(std::get<sizeof...(Maps) - 1 - Is>(maps_), mapped_point, time,
+        functions_of_time));
+
+  for (size_t d = 0; d < dim; ++d) {
+    source_point->get(d) = std::move(gsl::at(mapped_point, d));
+  }
+}
+
 namespace detail {
 template <typename T, typename Map, size_t Dim>
 void get_jacobian(
@@ -47,6 +47,16 @@ std::optional<std::array<double, 1>> Equiangular::inverse(
                             (-a_ - b_ + 2.0 * target_coords[0])))}}};
 }
 
+void Equiangular::inverse(
+    const gsl::not_null<std::array<DataVector, 1>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> /*is_valid*/) const {
+  (*target_coords)[0] =
+      0.5 * (A_ + B_ +
+             length_of_domain_over_m_pi_4_ *
+                 atan(one_over_length_of_range_ *
+                      (-a_ - b_ + 2.0 * (*target_coords)[0])));
+}
+
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, 1, Frame::NoFrame> Equiangular::jacobian(
     const std::array<T, 1>& source_coords) const {
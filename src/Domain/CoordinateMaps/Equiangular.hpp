@@ -10,11 +10,14 @@
 #include <cmath>
 #include <cstddef>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -74,6 +77,11 @@ class Equiangular {
   std::optional<std::array<double, 1>> inverse(
       const std::array<double, 1>& target_coords) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place. The
+  /// map is invertible everywhere, so `is_valid` is left unchanged.
+  void inverse(gsl::not_null<std::array<DataVector, 1>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid) const;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, 1, Frame::NoFrame> jacobian(
       const std::array<T, 1>& source_coords) const;
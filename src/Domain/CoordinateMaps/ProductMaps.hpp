@@ -11,14 +11,17 @@
 #include <functional>
 #include <optional>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -55,6 +58,12 @@ class ProductOf2Maps {
   std::optional<std::array<double, dim>> inverse(
       const std::array<double, dim>& target_coords) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place,
+  /// forwarding the coordinates of each factor to that map's batched inverse
+  /// (see `domain::CoordinateMaps::batched_inverse`).
+  void inverse(gsl::not_null<std::array<DataVector, dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid) const;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, dim, Frame::NoFrame> inv_jacobian(
       const std::array<T, dim>& source_coords) const;
@@ -104,6 +113,12 @@ class ProductOf3Maps {
   std::optional<std::array<double, dim>> inverse(
       const std::array<double, dim>& target_coords) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place,
+  /// forwarding the coordinates of each factor to that map's batched inverse
+  /// (see `domain::CoordinateMaps::batched_inverse`).
+  void inverse(gsl::not_null<std::array<DataVector, dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid) const;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, dim, Frame::NoFrame> inv_jacobian(
       const std::array<T, dim>& source_coords) const;
@@ -11,8 +11,11 @@
 #include <optional>
 #include <pup.h>
 #include <utility>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/CoordinateMaps/BatchedInverse.hpp"
 #include "Utilities/DereferenceWrapper.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -119,6 +122,25 @@ ProductOf2Maps<Map1, Map2>::inverse(
       std::make_index_sequence<Map2::dim>{});
 }
 
+template <typename Map1, typename Map2>
+void ProductOf2Maps<Map1, Map2>::inverse(
+    const gsl::not_null<std::array<DataVector, dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid) const {
+  // Non-owning views into the coordinates handled by each of the maps
+  std::array<DataVector, Map1::dim> map1_coords{};
+  std::array<DataVector, Map2::dim> map2_coords{};
+  for (size_t d = 0; d < Map1::dim; ++d) {
+    gsl::at(map1_coords, d)
+        .set_data_ref(make_not_null(&gsl::at(*target_coords, d)));
+  }
+  for (size_t d = 0; d < Map2::dim; ++d) {
+    gsl::at(map2_coords, d)
+        .set_data_ref(make_not_null(&gsl::at(*target_coords, Map1::dim + d)));
+  }
+  batched_inverse(make_not_null(&map1_coords), is_valid, map1_);
+  batched_inverse(make_not_null(&map2_coords), is_valid, map2_);
+}
+
 template <typename Map1, typename Map2>
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, ProductOf2Maps<Map1, Map2>::dim,
@@ -206,6 +228,22 @@ ProductOf3Maps<Map1, Map2, Map3>::inverse(
   }
 }
 
+template <typename Map1, typename Map2, typename Map3>
+void ProductOf3Maps<Map1, Map2, Map3>::inverse(
+    const gsl::not_null<std::array<DataVector, dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid) const {
+  // Non-owning views into the coordinates handled by each of the maps
+  std::array<DataVector, 1> c1{};
+  std::array<DataVector, 1> c2{};
+  std::array<DataVector, 1> c3{};
+  c1[0].set_data_ref(make_not_null(&(*target_coords)[0]));
+  c2[0].set_data_ref(make_not_null(&(*target_coords)[1]));
+  c3[0].set_data_ref(make_not_null(&(*target_coords)[2]));
+  batched_inverse(make_not_null(&c1), is_valid, map1_);
+  batched_inverse(make_not_null(&c2), is_valid, map2_);
+  batched_inverse(make_not_null(&c3), is_valid, map3_);
+}
+
 template <typename Map1, typename Map2, typename Map3>
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, ProductOf3Maps<Map1, Map2, Map3>::dim,
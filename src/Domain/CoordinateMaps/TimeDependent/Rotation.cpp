@@ -68,6 +68,29 @@ std::optional<std::array<double, Dim>> Rotation<Dim>::inverse(
   return result;
 }
 
+template <size_t Dim>
+void Rotation<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> /*is_valid*/, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  const Matrix rot_matrix =
+      rotation_matrix<Dim>(time, *(functions_of_time.at(f_of_t_name_)));
+
+  // Same as the scalar inverse, applying the transpose of the rotation matrix
+  std::array<DataVector, Dim> result{};
+  for (size_t i = 0; i < Dim; i++) {
+    gsl::at(result, i) = rot_matrix(0, i) * (*target_coords)[0];
+    for (size_t j = 1; j < Dim; j++) {
+      gsl::at(result, i) += rot_matrix(j, i) * gsl::at(*target_coords, j);
+    }
+  }
+  for (size_t i = 0; i < Dim; i++) {
+    gsl::at(*target_coords, i) = std::move(gsl::at(result, i));
+  }
+}
+
 template <size_t Dim>
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, Dim> Rotation<Dim>::frame_velocity(
@@ -10,11 +10,14 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace domain {
 namespace FunctionsOfTime {
 class FunctionOfTime;
@@ -186,6 +189,15 @@ class Rotation {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place. The
+  /// map is invertible everywhere, so `is_valid` is left unchanged.
+  void inverse(gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid, double time,
+               const std::unordered_map<
+                   std::string,
+                   std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+                   functions_of_time) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, Dim> frame_velocity(
       const std::array<T, Dim>& source_coords, double time,
@@ -180,6 +180,45 @@ std::optional<std::array<double, Dim>> Translation<Dim>::inverse(
     return result;
   }
 }
+
+template <size_t Dim>
+void Translation<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid, const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) const {
+  if (not inner_radius_.has_value() and f_of_r_ == nullptr) {
+    const DataVector function_of_time =
+        functions_of_time.at(f_of_t_name_)->func(time)[0];
+    ASSERT(function_of_time.size() == Dim,
+           "The dimension of the function of time ("
+               << function_of_time.size()
+               << ") does not match the dimension of the translation map ("
+               << Dim << ").");
+    for (size_t i = 0; i < Dim; i++) {
+      gsl::at(*target_coords, i) -= function_of_time[i];
+    }
+    return;
+  }
+  std::array<double, Dim> target_point{};
+  for (size_t s = 0; s < is_valid->size(); ++s) {
+    if (not(*is_valid)[s]) {
+      continue;
+    }
+    for (size_t i = 0; i < Dim; i++) {
+      gsl::at(target_point, i) = gsl::at(*target_coords, i)[s];
+    }
+    const auto source_point = inverse(target_point, time, functions_of_time);
+    if (source_point.has_value()) {
+      for (size_t i = 0; i < Dim; i++) {
+        gsl::at(*target_coords, i)[s] = gsl::at(source_point.value(), i);
+      }
+    } else {
+      (*is_valid)[s] = false;
+    }
+  }
+}
 template <size_t Dim>
 template <typename T>
 std::array<tt::remove_cvref_wrap_t<T>, Dim> Translation<Dim>::frame_velocity(
@@ -10,12 +10,15 @@
 #include <string>
 #include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "PointwiseFunctions/MathFunctions/MathFunction.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace domain::FunctionsOfTime {
 class FunctionOfTime;
 }  // namespace domain::FunctionsOfTime
@@ -191,6 +194,17 @@ class Translation {
           std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
           functions_of_time) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place. A
+  /// uniform translation is applied with vectorized math, while the piecewise
+  /// and radial MathFunction translations invert each valid point with the
+  /// scalar `inverse`.
+  void inverse(gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid, double time,
+               const std::unordered_map<
+                   std::string,
+                   std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+                   functions_of_time) const;
+
   template <typename T>
   std::array<tt::remove_cvref_wrap_t<T>, Dim> frame_velocity(
       const std::array<T, Dim>& source_coords, double time,
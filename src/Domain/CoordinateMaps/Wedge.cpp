@@ -6,7 +6,9 @@
 #include <cmath>
 #include <cstddef>
 #include <pup.h>
+#include <vector>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Determinant.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
@@ -246,6 +248,98 @@ std::optional<std::array<double, Dim>> Wedge<Dim>::inverse(
   return logical_coords;
 }
 
+template <size_t Dim>
+void Wedge<Dim>::inverse(
+    const gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+    const gsl::not_null<std::vector<bool>*> is_valid) const {
+  std::array<DataVector, Dim> physical_coords =
+      discrete_rotation(orientation_of_wedge_.inverse_map(), *target_coords);
+  const size_t num_points = physical_coords[0].size();
+
+  // Points that fail the inverse are replaced by a point on the wedge axis so
+  // that the vectorized math below never divides by zero at those points.
+  const auto invalidate_point = [&physical_coords,
+                                 &is_valid](const size_t s) {
+    (*is_valid)[s] = false;
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(physical_coords, d)[s] = d == radial_coord ? 1.0 : 0.0;
+    }
+  };
+  for (size_t s = 0; s < num_points; ++s) {
+    if (not(*is_valid)[s] or physical_coords[radial_coord][s] < 0.0 or
+        equal_within_roundoff(physical_coords[radial_coord][s], 0.0)) {
+      invalidate_point(s);
+    }
+  }
+
+  DataVector radius = square(physical_coords[0]);
+  for (size_t d = 1; d < Dim; ++d) {
+    radius += square(gsl::at(physical_coords, d));
+  }
+  radius = sqrt(radius);
+
+  // Radial coordinate
+  const DataVector& physical_z = physical_coords[radial_coord];
+  DataVector zeta{};
+  if (radial_distribution_ == Distribution::Linear) {
+    DataVector zeta_coefficient =
+        scaled_frustum_rate_ + sphere_rate_ * physical_z / radius;
+    // See the scalar inverse for the cone on which the map is singular.
+    for (size_t s = 0; s < num_points; ++s) {
+      if (not(*is_valid)[s]) {
+        continue;
+      }
+      if ((scaled_frustum_rate_ > 0.0 and
+           scaled_frustum_rate_ < -sphere_rate_ and
+           zeta_coefficient[s] > 0.0) or
+          (scaled_frustum_rate_ < 0.0 and
+           scaled_frustum_rate_ > -sphere_rate_ and
+           zeta_coefficient[s] < 0.0) or
+          equal_within_roundoff(zeta_coefficient[s], 0.0)) {
+        (*is_valid)[s] = false;
+        zeta_coefficient[s] = 1.0;
+      }
+    }
+    zeta = (physical_z -
+            (scaled_frustum_zero_ + sphere_zero_ * physical_z / radius)) /
+           zeta_coefficient;
+  } else if (radial_distribution_ == Distribution::Logarithmic) {
+    zeta = (log(radius) - sphere_zero_) / sphere_rate_;
+  } else {
+    zeta = (radius_inner_ * (radius_outer_ / radius - 1.0) +
+            radius_outer_ * (radius_inner_ / radius - 1.0)) /
+           (radius_inner_ - radius_outer_);
+  }
+
+  // Polar angle
+  DataVector xi = physical_coords[polar_coord] / physical_z;
+  if (with_equiangular_map_) {
+    xi = 2.0 *
+         atan(tan(0.5 * opening_angles_distribution_[0]) /
+              tan(0.5 * opening_angles_[0]) * xi) /
+         opening_angles_distribution_[0];
+  }
+  if (halves_to_use_ == WedgeHalves::UpperOnly) {
+    xi *= 2.0;
+    xi -= 1.0;
+  } else if (halves_to_use_ == WedgeHalves::LowerOnly) {
+    xi *= 2.0;
+    xi += 1.0;
+  }
+  if constexpr (Dim == 3) {
+    DataVector& eta = (*target_coords)[azimuth_coord];
+    eta = physical_coords[azimuth_coord] / physical_z;
+    if (with_equiangular_map_) {
+      eta = 2.0 *
+            atan(tan(0.5 * opening_angles_distribution_[1]) /
+                 tan(0.5 * opening_angles_[1]) * eta) /
+            opening_angles_distribution_[1];
+    }
+  }
+  (*target_coords)[radial_coord] = std::move(zeta);
+  (*target_coords)[polar_coord] = std::move(xi);
+}
+
 template <size_t Dim>
 template <typename T>
 tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> Wedge<Dim>::jacobian(
@@ -7,13 +7,16 @@
 #include <cstddef>
 #include <limits>
 #include <optional>
+#include <vector>
 
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "Domain/CoordinateMaps/Distribution.hpp"
 #include "Domain/Structure/OrientationMap.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/TypeTraits/RemoveReferenceWrapper.hpp"
 
 /// \cond
+class DataVector;
 namespace PUP {
 class er;
 }  // namespace PUP
@@ -342,6 +345,12 @@ class Wedge {
   std::optional<std::array<double, Dim>> inverse(
       const std::array<double, Dim>& target_coords) const;
 
+  /// Batched inverse that maps all points in `target_coords` in place.
+  /// `is_valid` is set to `false` for all points where the scalar `inverse`
+  /// would return invalid.
+  void inverse(gsl::not_null<std::array<DataVector, Dim>*> target_coords,
+               gsl::not_null<std::vector<bool>*> is_valid) const;
+
   template <typename T>
   tnsr::Ij<tt::remove_cvref_wrap_t<T>, Dim, Frame::NoFrame> jacobian(
       const std::array<T, Dim>& source_coords) const;
@@ -3,6 +3,7 @@
 
 #include "Domain/ElementDistribution.hpp"
 
+#include <algorithm>
 #include <array>
 #include <cmath>
 #include <cstddef>
@@ -22,7 +23,9 @@
 #include "Domain/Structure/CreateInitialMesh.hpp"
 #include "Domain/Structure/Element.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/HilbertCurve.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -90,6 +93,17 @@ std::ostream& operator<<(std::ostream& os, ElementWeight weight) {
   }
 }
 
+std::ostream& operator<<(std::ostream& os, SpaceFillingCurve curve) {
+  switch (curve) {
+    case SpaceFillingCurve::ZCurve:
+      return os << "ZCurve";
+    case SpaceFillingCurve::HilbertCurve:
+      return os << "HilbertCurve";
+    default:
+      ERROR("Unknown SpaceFillingCurve type");
+  }
+}
+
 template <size_t Dim>
 std::unordered_map<ElementId<Dim>, double> get_element_costs(
     const std::vector<Block<Dim>>& blocks,
@@ -131,6 +145,134 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
   return element_costs;
 }
 
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, double> measured_element_costs(
+    const std::unordered_map<ElementId<Dim>, double>& estimated_costs,
+    const std::unordered_map<ElementId<Dim>, double>& measured_costs) {
+  double total_measured_cost = 0.0;
+  double total_estimated_cost_of_measured = 0.0;
+  for (const auto& [element_id, estimated_cost] : estimated_costs) {
+    const auto measured_cost = measured_costs.find(element_id);
+    if (measured_cost != measured_costs.end() and measured_cost->second > 0.0) {
+      total_measured_cost += measured_cost->second;
+      total_estimated_cost_of_measured += estimated_cost;
+    }
+  }
+  if (total_measured_cost == 0.0 or total_estimated_cost_of_measured == 0.0) {
+    return estimated_costs;
+  }
+  const double estimate_to_measured =
+      total_measured_cost / total_estimated_cost_of_measured;
+
+  std::unordered_map<ElementId<Dim>, double> element_costs{};
+  for (const auto& [element_id, estimated_cost] : estimated_costs) {
+    const auto measured_cost = measured_costs.find(element_id);
+    if (measured_cost != measured_costs.end() and measured_cost->second > 0.0) {
+      element_costs.insert({element_id, measured_cost->second});
+    } else {
+      element_costs.insert({element_id, estimated_cost * estimate_to_measured});
+    }
+  }
+  return element_costs;
+}
+
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> partition_elements_by_cost(
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    const size_t number_of_procs_with_elements,
+    const std::unordered_set<size_t>& global_procs_to_ignore,
+    const SpaceFillingCurve space_filling_curve) {
+  ASSERT(
+      number_of_procs_with_elements > 0,
+      "Must have a non-zero number of processors to distribute elements to.");
+
+  std::unordered_map<size_t, size_t> finest_level_by_block{};
+  for (const auto& [element_id, cost] : element_costs) {
+    size_t& finest_level = finest_level_by_block[element_id.block_id()];
+    for (const auto& segment_id : element_id.segment_ids()) {
+      finest_level = std::max(finest_level, segment_id.refinement_level());
+    }
+  }
+
+  // Order the elements by block, then along the space-filling curve through
+  // the finest grid of the block
+  struct ElementOrder {
+    size_t block_id;
+    size_t curve_index;
+    ElementId<Dim> element_id;
+    double cost;
+  };
+  std::vector<ElementOrder> ordered_elements{};
+  ordered_elements.reserve(element_costs.size());
+  double total_cost = 0.0;
+  for (const auto& [element_id, cost] : element_costs) {
+    const size_t finest_level =
+        finest_level_by_block.at(element_id.block_id());
+    std::array<SegmentId, Dim> finest_segment_ids = element_id.segment_ids();
+    for (size_t d = 0; d < Dim; ++d) {
+      const SegmentId segment_id = gsl::at(finest_segment_ids, d);
+      gsl::at(finest_segment_ids, d) =
+          SegmentId{finest_level,
+                    segment_id.index()
+                        << (finest_level - segment_id.refinement_level())};
+    }
+    const ElementId<Dim> finest_element_id{element_id.block_id(),
+                                           finest_segment_ids};
+    ordered_elements.push_back(
+        {element_id.block_id(),
+         space_filling_curve == SpaceFillingCurve::HilbertCurve
+             ? hilbert_curve_index(finest_element_id)
+             : z_curve_index(finest_element_id),
+         element_id, cost});
+    total_cost += cost;
+  }
+  alg::sort(ordered_elements,
+            [](const ElementOrder& lhs, const ElementOrder& rhs) {
+              return lhs.block_id != rhs.block_id
+                         ? lhs.block_id < rhs.block_id
+                         : lhs.curve_index < rhs.curve_index;
+            });
+
+  std::vector<size_t> procs_with_elements(number_of_procs_with_elements);
+  size_t global_proc_number = 0;
+  for (size_t& proc : procs_with_elements) {
+    while (global_procs_to_ignore.count(global_proc_number) != 0) {
+      ++global_proc_number;
+    }
+    proc = global_proc_number;
+    ++global_proc_number;
+  }
+
+  std::unordered_map<ElementId<Dim>, size_t> result{};
+  size_t proc_number = 0;
+  double cost_remaining = total_cost;
+  double target_cost_per_proc =
+      total_cost / static_cast<double>(number_of_procs_with_elements);
+  double cost_spent_on_proc = 0.0;
+  bool proc_has_elements = false;
+  for (const auto& element : ordered_elements) {
+    // As in `BlockZCurveProcDistribution`, every proc gets at least one
+    // element, we move on to the next proc once adding the element would take
+    // the proc further away from its target cost, and the target cost is
+    // updated for each proc. The last proc gets all remaining elements.
+    if (proc_has_elements and
+        proc_number + 1 < number_of_procs_with_elements and
+        abs(target_cost_per_proc - cost_spent_on_proc) <=
+            abs(target_cost_per_proc - (cost_spent_on_proc + element.cost))) {
+      ++proc_number;
+      target_cost_per_proc =
+          cost_remaining /
+          static_cast<double>(number_of_procs_with_elements - proc_number);
+      cost_spent_on_proc = 0.0;
+    }
+    result.insert({element.element_id, procs_with_elements[proc_number]});
+    cost_spent_on_proc += element.cost;
+    cost_remaining -= element.cost;
+    proc_has_elements = true;
+  }
+  return result;
+}
+
 template <size_t Dim>
 BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     const std::unordered_map<ElementId<Dim>, double>& element_costs,
@@ -138,7 +280,9 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     const std::vector<Block<Dim>>& blocks,
     const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
     const std::vector<std::array<size_t, Dim>>& initial_extents,
-    const std::unordered_set<size_t>& global_procs_to_ignore) {
+    const std::unordered_set<size_t>& global_procs_to_ignore,
+    const SpaceFillingCurve space_filling_curve)
+    : space_filling_curve_(space_filling_curve) {
   const size_t num_blocks = blocks.size();
 
   ASSERT(
@@ -174,8 +318,8 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
     initial_element_ids_by_block[i] =
         initial_element_ids(blocks[i].id(), initial_refinement_levels[i]);
     alg::sort(initial_element_ids_by_block[i],
-              [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
-                return z_curve_index(lhs) < z_curve_index(rhs);
+              [this](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
+                return curve_index(lhs) < curve_index(rhs);
               });
   }
 
@@ -302,7 +446,7 @@ BlockZCurveProcDistribution<Dim>::BlockZCurveProcDistribution(
 template <size_t Dim>
 size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
     const ElementId<Dim>& element_id) const {
-  const size_t element_order_index = z_curve_index(element_id);
+  const size_t element_order_index = curve_index(element_id);
   size_t total_so_far = 0;
   for (const std::pair<size_t, size_t>& element_info :
        gsl::at(block_element_distribution_, element_id.block_id())) {
@@ -317,6 +461,14 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
       "of BlockZCurveProcDistribution.");
 }
 
+template <size_t Dim>
+size_t BlockZCurveProcDistribution<Dim>::curve_index(
+    const ElementId<Dim>& element_id) const {
+  return space_filling_curve_ == SpaceFillingCurve::HilbertCurve
+             ? hilbert_curve_index(element_id)
+             : z_curve_index(element_id);
+}
+
 #define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
 
 #define INSTANTIATION(r, data)                                               \
@@ -335,7 +487,20 @@ size_t BlockZCurveProcDistribution<Dim>::get_proc_for_element(
           initial_refinement_levels,                                         \
       const std::vector<std::array<size_t, GET_DIM(data)>>& initial_extents, \
       ElementWeight element_weight,                                          \
-      const std::optional<Spectral::Quadrature>& quadrature);
+      const std::optional<Spectral::Quadrature>& quadrature);                \
+  template std::unordered_map<ElementId<GET_DIM(data)>, double>              \
+  measured_element_costs(                                                    \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          estimated_costs,                                                   \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          measured_costs);                                                   \
+  template std::unordered_map<ElementId<GET_DIM(data)>, size_t>              \
+  partition_elements_by_cost(                                                \
+      const std::unordered_map<ElementId<GET_DIM(data)>, double>&            \
+          element_costs,                                                     \
+      size_t number_of_procs_with_elements,                                  \
+      const std::unordered_set<size_t>& global_procs_to_ignore,              \
+      SpaceFillingCurve space_filling_curve);
 
 GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
 
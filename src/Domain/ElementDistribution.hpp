@@ -48,6 +48,18 @@ enum class ElementWeight {
 
 std::ostream& operator<<(std::ostream& os, ElementWeight weight);
 
+/// The space-filling curve used to order the `Element`s within each `Block`
+/// when distributing them to processors (see `BlockZCurveProcDistribution`)
+enum class SpaceFillingCurve {
+  /// Order `Element`s along a Morton curve (see `domain::z_curve_index`)
+  ZCurve,
+  /// Order `Element`s along a Hilbert curve (see
+  /// `domain::hilbert_curve_index`)
+  HilbertCurve
+};
+
+std::ostream& operator<<(std::ostream& os, SpaceFillingCurve curve);
+
 /// \brief Get the cost of each `Element` in a list of `Block`s where
 /// `element_weight` specifies which weight distribution scheme to use
 ///
@@ -63,16 +75,64 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
     ElementWeight element_weight,
     const std::optional<Spectral::Quadrature>& quadrature);
 
+/*!
+ * \brief Combine measured costs of `Element`s with estimated costs.
+ *
+ * \details The `measured_costs` are typically the wall time spent on each
+ * `Element` during a part of the run, and the `estimated_costs` are computed
+ * with `get_element_costs()`. The result has a cost for every `Element` in
+ * `estimated_costs`. `Element`s with a positive measured cost get that cost.
+ * All other `Element`s, e.g. ones that were created after the measurement, get
+ * their estimated cost rescaled by the ratio of total measured to total
+ * estimated cost of the measured `Element`s, so measured and estimated costs
+ * are comparable. If nothing was measured the estimated costs are returned.
+ *
+ * `Parallel::Actions::MigrateElementsByMeasuredCost` uses this to redistribute
+ * the `Element`s during a run, including `Element`s created by AMR.
+ */
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, double> measured_element_costs(
+    const std::unordered_map<ElementId<Dim>, double>& estimated_costs,
+    const std::unordered_map<ElementId<Dim>, double>& measured_costs);
+
+/*!
+ * \brief Assign `Element`s with arbitrary refinement to processors, balancing
+ * the total cost per processor.
+ *
+ * \details This is the same algorithm as `BlockZCurveProcDistribution`, but
+ * works for any set of `Element`s, e.g. after AMR has changed the refinement
+ * of parts of a `Block`, so it can be used to redistribute the `Element`s
+ * during a run based on measured costs (see `measured_element_costs()`). The
+ * `Element`s are ordered by `Block` and within each `Block` along the
+ * `space_filling_curve`. To order `Element`s with different refinement
+ * levels, each `Element` is represented by the cell at the lowest corner of
+ * the `Element` on a uniform grid at the finest refinement level of its
+ * `Block`. The `Element`s are then traversed in this order and assigned to
+ * processors in order, adjusting the target cost per processor as described
+ * in `BlockZCurveProcDistribution`.
+ *
+ * Returns the processor for each `Element` in `element_costs`. Processors in
+ * `global_procs_to_ignore` are skipped.
+ */
+template <size_t Dim>
+std::unordered_map<ElementId<Dim>, size_t> partition_elements_by_cost(
+    const std::unordered_map<ElementId<Dim>, double>& element_costs,
+    size_t number_of_procs_with_elements,
+    const std::unordered_set<size_t>& global_procs_to_ignore = {},
+    SpaceFillingCurve space_filling_curve = SpaceFillingCurve::ZCurve);
+
 /*!
  * \brief Distribution strategy for assigning elements to CPUs using a
- * Morton ('Z-order') space-filling curve to determine placement within each
- * block, where `Element`s are distributed across CPUs
+ * Morton ('Z-order') or Hilbert space-filling curve to determine placement
+ * within each block, where `Element`s are distributed across CPUs
  *
  * \details The element distribution attempts to assign a balanced total
  * computational cost to each processor that is allowed to have `Element`s.
  * First, each `Block`'s `Element`s are ordered by their Z-curve index (see more
- * below). `Element`s are traversed in this order and assigned to CPUs in order,
- * moving onto the next CPU once the target cost per CPU is met. The target cost
+ * below), or by their Hilbert-curve index if `SpaceFillingCurve::HilbertCurve`
+ * is requested. `Element`s are traversed in this order and assigned to CPUs in
+ * order, moving onto the next CPU once the target cost per CPU is met. The
+ * target cost
  * per CPU is defined as the remaining cost to distribute divided by the
  * remaining number of CPUs to distribute to. This is an important distinction
  * from simply having one constant target cost per CPU defined as the total cost
@@ -112,10 +172,15 @@ std::unordered_map<ElementId<Dim>, double> get_element_costs(
  * -- usually, for approximately even distributions, it will ensure that
  * elements are assigned in large volume chunks, and the structure of the Morton
  * curve ensures that for a given processor and block, the elements will be
- * assigned in no more than two orthogonally connected clusters. In principle, a
- * Hilbert curve could potentially improve upon the gains obtained by this class
- * by guaranteeing that all elements within each block form a single
- * orthogonally connected cluster.
+ * assigned in no more than two orthogonally connected clusters. The Hilbert
+ * curve (see `domain::hilbert_curve_index`) improves upon this by guaranteeing
+ * that all elements of a processor within each block form a single
+ * orthogonally connected cluster, at least for isotropic refinement.
+ *
+ * The `element_costs` can be static estimates (see `get_element_costs()`) or
+ * costs measured during a run (see `measured_element_costs()`), which capture
+ * cost variations between elements that static estimates miss, e.g. from
+ * switching to a subcell solver.
  *
  * The assignment of portions of blocks to processors may use partial blocks,
  * and/or multiple blocks to ensure an even distribution of elements to
@@ -152,11 +217,12 @@ struct BlockZCurveProcDistribution {
       const std::vector<Block<Dim>>& blocks,
       const std::vector<std::array<size_t, Dim>>& initial_refinement_levels,
       const std::vector<std::array<size_t, Dim>>& initial_extents,
-      const std::unordered_set<size_t>& global_procs_to_ignore = {});
+      const std::unordered_set<size_t>& global_procs_to_ignore = {},
+      SpaceFillingCurve space_filling_curve = SpaceFillingCurve::ZCurve);
 
   /// Gets the suggested processor number for a particular `ElementId`,
-  /// determined by the Morton curve weighted element assignment described in
-  /// detail in the parent class documentation.
+  /// determined by the space-filling curve weighted element assignment
+  /// described in detail in the parent class documentation.
   size_t get_proc_for_element(const ElementId<Dim>& element_id) const;
 
   const std::vector<std::vector<std::pair<size_t, size_t>>>&
@@ -165,6 +231,9 @@ struct BlockZCurveProcDistribution {
   }
 
  private:
+  size_t curve_index(const ElementId<Dim>& element_id) const;
+
+  SpaceFillingCurve space_filling_curve_{SpaceFillingCurve::ZCurve};
   // in this nested data structure:
   // - The block id is the first index
   // - There is an arbitrary number of CPUs per block, each with an element
@@ -206,3 +275,18 @@ struct Options::create_from_yaml<domain::ElementWeight> {
                 "'NumGridPointsAndGridSpacing'");
   }
 };
+
+template <>
+struct Options::create_from_yaml<domain::SpaceFillingCurve> {
+  template <typename Metavariables>
+  static domain::SpaceFillingCurve create(const Options::Option& options) {
+    const auto curve = options.parse_as<std::string>();
+    if (curve == "ZCurve") {
+      return domain::SpaceFillingCurve::ZCurve;
+    } else if (curve == "HilbertCurve") {
+      return domain::SpaceFillingCurve::HilbertCurve;
+    }
+    PARSE_ERROR(options.context(),
+                "SpaceFillingCurve must be 'ZCurve' or 'HilbertCurve'");
+  }
+};
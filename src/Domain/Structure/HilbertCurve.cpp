@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Domain/Structure/HilbertCurve.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <limits>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace domain {
+namespace {
+// Index of the point with integer coordinates `coords` on the Hilbert curve
+// through a grid of 2^number_of_bits points in each of the first
+// `number_of_dims` dimensions.
+//
+// This uses the algorithm of J. Skilling, "Programming the Hilbert curve", AIP
+// Conference Proceedings 707, 381 (2004): the coordinates are transformed in
+// place into the "transposed" Hilbert index, whose bits are then interleaved
+// into a single integer.
+template <size_t Dim>
+size_t hilbert_index(std::array<size_t, Dim> coords,
+                     const size_t number_of_dims,
+                     const size_t number_of_bits) {
+  if (number_of_bits == 0) {
+    return 0;
+  }
+  const size_t highest_bit = two_to_the(number_of_bits - 1);
+  // Undo the excess rotations and reflections of the subcubes
+  for (size_t q = highest_bit; q > 1; q >>= 1) {
+    const size_t lower_bits = q - 1;
+    for (size_t i = 0; i < number_of_dims; ++i) {
+      if ((gsl::at(coords, i) & q) != 0) {
+        coords[0] ^= lower_bits;
+      } else {
+        const size_t swap = (coords[0] ^ gsl::at(coords, i)) & lower_bits;
+        coords[0] ^= swap;
+        gsl::at(coords, i) ^= swap;
+      }
+    }
+  }
+  // Gray encode
+  for (size_t i = 1; i < number_of_dims; ++i) {
+    gsl::at(coords, i) ^= gsl::at(coords, i - 1);
+  }
+  size_t flip = 0;
+  for (size_t q = highest_bit; q > 1; q >>= 1) {
+    if ((gsl::at(coords, number_of_dims - 1) & q) != 0) {
+      flip ^= q - 1;
+    }
+  }
+  for (size_t i = 0; i < number_of_dims; ++i) {
+    gsl::at(coords, i) ^= flip;
+  }
+  // Interleave the bits of the transposed index, most significant first
+  size_t result = 0;
+  for (size_t bit = number_of_bits; bit-- > 0;) {
+    for (size_t i = 0; i < number_of_dims; ++i) {
+      result = (result << 1) | ((gsl::at(coords, i) >> bit) & 1);
+    }
+  }
+  return result;
+}
+}  // namespace
+
+template <size_t Dim>
+size_t hilbert_curve_index(const ElementId<Dim>& element_id) {
+  // Collect the dimensions with nonzero refinement and find the lowest
+  // refinement level among them, which is the level of the Hilbert curve.
+  std::array<size_t, Dim> levels{};
+  std::array<size_t, Dim> indices{};
+  size_t number_of_dims = 0;
+  size_t curve_level = std::numeric_limits<size_t>::max();
+  for (size_t d = 0; d < Dim; ++d) {
+    const auto& segment_id = element_id.segment_id(d);
+    if (segment_id.refinement_level() == 0) {
+      continue;
+    }
+    gsl::at(levels, number_of_dims) = segment_id.refinement_level();
+    gsl::at(indices, number_of_dims) = segment_id.index();
+    curve_level = std::min(curve_level, segment_id.refinement_level());
+    ++number_of_dims;
+  }
+  if (number_of_dims == 0) {
+    return 0;
+  }
+
+  // Split the segment indices into the index of the cell on the Hilbert curve
+  // and the index of the element within the cell
+  std::array<size_t, Dim> cell_coords{};
+  size_t index_in_cell = 0;
+  size_t number_of_bits_in_cell = 0;
+  for (size_t i = 0; i < number_of_dims; ++i) {
+    const size_t extra_bits = gsl::at(levels, i) - curve_level;
+    gsl::at(cell_coords, i) = gsl::at(indices, i) >> extra_bits;
+    index_in_cell |= (gsl::at(indices, i) & (two_to_the(extra_bits) - 1))
+                     << number_of_bits_in_cell;
+    number_of_bits_in_cell += extra_bits;
+  }
+  return (hilbert_index(cell_coords, number_of_dims, curve_level)
+          << number_of_bits_in_cell) |
+         index_in_cell;
+}
+
+#define GET_DIM(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATION(r, data)         \
+  template size_t hilbert_curve_index( \
+      const ElementId<GET_DIM(data)>& element_id);
+
+GENERATE_INSTANTIATIONS(INSTANTIATION, (1, 2, 3))
+
+#undef GET_DIM
+#undef INSTANTIATION
+}  // namespace domain
@@ -0,0 +1,41 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+
+template <size_t Dim>
+class ElementId;
+
+namespace domain {
+/// \brief Computes the Hilbert-curve index of a given `ElementId`
+///
+/// \details Like `domain::z_curve_index`, the index enumerates all elements of
+/// a block with the same refinement levels densely from zero to the number of
+/// elements minus one. Consecutive elements on a Hilbert curve are always
+/// face neighbors, so a contiguous range of indices forms a single
+/// orthogonally connected cluster of elements. Here is a sketch of a 2D block
+/// with 4x4 elements and the resulting Hilbert curve:
+///
+/// \code
+///        x-->
+///        0   1   2   3
+/// y  0 |  0   1  14  15
+/// |  1 |  3   2  13  12
+/// v  2 |  4   7   8  11
+///    3 |  5   6   9  10
+/// \endcode
+///
+/// A Hilbert curve is only defined on a grid with the same number of elements
+/// in every dimension. For anisotropic refinement the elements are grouped
+/// into cells at the lowest nonzero refinement level of the element. The cells
+/// are ordered along a Hilbert curve through all dimensions with nonzero
+/// refinement, and the elements within a cell are ordered lexicographically.
+/// Dimensions with refinement level zero are ignored.
+///
+/// \param element_id the `ElementId` for which to compute the Hilbert-curve
+/// index
+template <size_t Dim>
+size_t hilbert_curve_index(const ElementId<Dim>& element_id);
+}  // namespace domain
@@ -32,6 +32,17 @@ struct ElementDistribution {
       "RoundRobin to just place each element on the next core."};
   using group = Parallel::OptionTags::Parallelization;
 };
+
+/// \ingroup OptionTagsGroup
+/// \ingroup ComputationalDomainGroup
+struct ElementOrdering {
+  using type = SpaceFillingCurve;
+  static constexpr Options::String help = {
+      "Space-filling curve to order the elements within each block along when "
+      "distributing them. Only used if the ElementDistribution is not "
+      "RoundRobin."};
+  using group = Parallel::OptionTags::Parallelization;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -53,5 +64,19 @@ struct ElementDistribution : db::SimpleTag {
     return element_distribution;
   }
 };
+
+/// \ingroup DataBoxTagsGroup
+/// \ingroup ComputationalDomainGroup
+/// Tag that holds the space-filling curve used to order the elements within
+/// each block when distributing them on the given resources.
+struct ElementOrdering : db::SimpleTag {
+  using type = SpaceFillingCurve;
+  using option_tags = tmpl::list<OptionTags::ElementOrdering>;
+
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const type& element_ordering) {
+    return element_ordering;
+  }
+};
 }  // namespace Tags
 }  // namespace domain
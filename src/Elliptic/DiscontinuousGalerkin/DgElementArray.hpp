@@ -94,6 +94,8 @@ struct DefaultElementsAllocator
 
     const std::optional<domain::ElementWeight>& element_weight =
         get<domain::Tags::ElementDistribution>(local_cache);
+    const domain::SpaceFillingCurve element_ordering =
+        get<domain::Tags::ElementOrdering>(local_cache);
 
     domain::BlockZCurveProcDistribution<Dim> element_distribution{};
     if (element_weight.has_value()) {
@@ -104,7 +106,8 @@ struct DefaultElementsAllocator
       element_distribution = domain::BlockZCurveProcDistribution<Dim>{
           element_costs,   num_of_procs_to_use,
           blocks,          initial_refinement_levels,
-          initial_extents, procs_to_ignore};
+          initial_extents, procs_to_ignore,
+          element_ordering};
     }
 
     // Will be used to print domain diagnostic info
@@ -192,8 +195,10 @@ struct DgElementArray {
   using phase_dependent_action_list = PhaseDepActionList;
   using array_index = ElementId<volume_dim>;
 
-  using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>,
-                                             domain::Tags::ElementDistribution>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<volume_dim>,
+                 domain::Tags::ElementDistribution,
+                 domain::Tags::ElementOrdering>;
 
   using array_allocation_tags =
       typename ElementsAllocator::template array_allocation_tags<
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <optional>
 #include <tuple>
+#include <utility>
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -16,8 +17,11 @@
 #include "ParallelAlgorithms/EventsAndDenseTriggers/Tags.hpp"
 #include "ParallelAlgorithms/Initialization/MutateAssign.hpp"
 #include "Time/EvolutionOrdering.hpp"
+#include "Time/Tags/DenseOutputCache.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Time/Tags/Time.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
 #include "Time/TimeSteppers/TimeStepper.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/TMPL.hpp"
@@ -61,18 +65,28 @@ namespace evolution::Actions {
 /// provided for convenience to provide an `is_ready` function when a
 /// pure mutate-apply is desired.
 ///
+/// The dense output is computed once per trigger time and shared by
+/// all events triggered at that time.  If the DataBox contains
+/// `Tags::DenseOutputCache<variables_tag>`, the dense output is
+/// stored there when a postprocessor is not ready, and reused when
+/// the action is retried at the same time.  The cache is emptied when
+/// the action is retried, so the copy of the variables is only held
+/// while waiting for the postprocessors.
+///
 /// At the end of the action, the values of the time, evolved
 /// variables, and anything appearing in the `return_tags` of the \p
 /// Postprocessors will be restored to their initial values.
 ///
 /// Uses:
-/// - DataBox: EventsAndDenseTriggers and as required by events,
-///   triggers, and postprocessors
+/// - DataBox: EventsAndDenseTriggers, optionally
+///   `Tags::DenseOutputCache<variables_tag>`, and as required by
+///   events, triggers, and postprocessors
 ///
 /// DataBox changes:
 /// - Adds: nothing
 /// - Removes: nothing
-/// - Modifies: as performed by the postprocessor `is_ready` functions
+/// - Modifies: `Tags::DenseOutputCache<variables_tag>` (if present) and
+///   as performed by the postprocessor `is_ready` functions
 template <typename Postprocessors>
 struct RunEventsAndDenseTriggers {
  private:
@@ -180,6 +194,80 @@ struct RunEventsAndDenseTriggers {
     using type = typename T::return_tags;
   };
 
+  template <typename VariablesTag, typename DbTags>
+  static constexpr bool has_dense_output_cache =
+      db::tag_is_retrievable_v<::Tags::DenseOutputCache<VariablesTag>,
+                               db::DataBox<DbTags>>;
+
+  // Sets the variables to their values at `time`, reusing a cached
+  // result if one is available.  Returns false if another step must
+  // be taken first.  Any cached result is consumed.
+  template <typename VariablesTag, typename DbTags>
+  static bool dense_output(const gsl::not_null<db::DataBox<DbTags>*> box,
+                           const double time) {
+    using cache_tag = ::Tags::DenseOutputCache<VariablesTag>;
+    if constexpr (has_dense_output_cache<VariablesTag, DbTags>) {
+      if (db::get<cache_tag>(*box).has_value()) {
+        bool used_cache = false;
+        db::mutate<VariablesTag, cache_tag>(
+            [&time, &used_cache](
+                const gsl::not_null<typename VariablesTag::type*> vars,
+                const gsl::not_null<typename cache_tag::type*> cache,
+                const TimeStepId& time_step_id, const TimeDelta& time_step) {
+              if ((*cache)->time == time and
+                  (*cache)->time_step_id == time_step_id and
+                  (*cache)->time_step == time_step) {
+                *vars = std::move((*cache)->value);
+                used_cache = true;
+              }
+              cache->reset();
+            },
+            box, db::get<::Tags::TimeStepId>(*box),
+            db::get<::Tags::TimeStep>(*box));
+        if (used_cache) {
+          return true;
+        }
+      }
+    }
+
+    using history_tag = ::Tags::HistoryEvolvedVariables<VariablesTag>;
+    bool dense_output_succeeded = false;
+    db::mutate<VariablesTag>(
+        [&dense_output_succeeded, &time](
+            const gsl::not_null<typename VariablesTag::type*> vars,
+            const TimeStepper& stepper,
+            const typename history_tag::type& history) {
+          *vars = *history.complete_step_start().value;
+          dense_output_succeeded = stepper.dense_update_u(vars, history, time);
+        },
+        box, db::get<::Tags::TimeStepper<TimeStepper>>(*box),
+        db::get<history_tag>(*box));
+    return dense_output_succeeded;
+  }
+
+  // Stores the current (dense output) values of the variables so a
+  // retry of the action does not have to recompute them.
+  template <typename VariablesTag, typename DbTags>
+  static void cache_dense_output(const gsl::not_null<db::DataBox<DbTags>*> box,
+                                 const double time) {
+    if constexpr (has_dense_output_cache<VariablesTag, DbTags>) {
+      using cache_tag = ::Tags::DenseOutputCache<VariablesTag>;
+      db::mutate<cache_tag>(
+          [&time](const gsl::not_null<typename cache_tag::type*> cache,
+                  const typename VariablesTag::type& vars,
+                  const TimeStepId& time_step_id, const TimeDelta& time_step) {
+            *cache = typename cache_tag::type::value_type{time_step_id,
+                                                          time_step, time,
+                                                          vars};
+          },
+          box, db::get<VariablesTag>(*box), db::get<::Tags::TimeStepId>(*box),
+          db::get<::Tags::TimeStep>(*box));
+    } else {
+      (void)box;
+      (void)time;
+    }
+  }
+
  public:
   template <typename DbTags, typename... InboxTags, typename Metavariables,
             typename ArrayIndex, typename ActionList,
@@ -245,21 +333,9 @@ struct RunEventsAndDenseTriggers {
         case TriggeringState::NotReady:
           return {Parallel::AlgorithmExecution::Retry, std::nullopt};
         case TriggeringState::NeedsEvolvedVariables: {
-          using history_tag = ::Tags::HistoryEvolvedVariables<variables_tag>;
-          bool dense_output_succeeded = false;
           variables_restorer.save();
-          db::mutate<variables_tag>(
-              [&dense_output_succeeded, &next_trigger](
-                  gsl::not_null<typename variables_tag::type*> vars,
-                  const TimeStepper& stepper,
-                  const typename history_tag::type& history) {
-                *vars = *history.complete_step_start().value;
-                dense_output_succeeded =
-                    stepper.dense_update_u(vars, history, next_trigger);
-              },
-              make_not_null(&box),
-              db::get<::Tags::TimeStepper<TimeStepper>>(box),
-              db::get<history_tag>(box));
+          const bool dense_output_succeeded =
+              dense_output<variables_tag>(make_not_null(&box), next_trigger);
           if (not dense_output_succeeded) {
             // Need to take another time step
             return {Parallel::AlgorithmExecution::Continue, std::nullopt};
@@ -277,6 +353,10 @@ struct RunEventsAndDenseTriggers {
             }
           });
           if (not ready) {
+            // The action will be rerun with the same dense output time
+            // once the data is available.
+            cache_dense_output<variables_tag>(make_not_null(&box),
+                                              next_trigger);
             return {Parallel::AlgorithmExecution::Retry, std::nullopt};
           }
 
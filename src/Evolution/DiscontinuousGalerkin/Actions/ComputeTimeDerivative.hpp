@@ -3,7 +3,6 @@
 
 #pragma once
 
-#include <limits>
 #include <optional>
 #include <tuple>
 #include <type_traits>
@@ -14,6 +13,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Variables.hpp"
 #include "DataStructures/VariablesTag.hpp"
@@ -498,11 +498,10 @@ ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers, LocalTimeStepping>::
       (VarsFaceTemporaries::number_of_independent_components +
        DgPackagedDataVarsOnFace::number_of_independent_components) *
           num_face_temporary_grid_points;
-  auto buffer = cpp20::make_unique_for_overwrite<double[]>(buffer_size);
-#ifdef SPECTRE_DEBUG
-  std::fill(&buffer[0], &buffer[buffer_size],
-            std::numeric_limits<double>::signaling_NaN());
-#endif
+  // The buffer is taken from the thread's scratch arena so that the memory is
+  // reused between calls instead of being allocated every time.
+  ScratchArena::Scope scratch{};
+  double* const buffer = scratch.allocate<double>(buffer_size);
   VarsTemporaries temporaries{
       &buffer[0], VarsTemporaries::number_of_independent_components *
                       number_of_grid_points};
@@ -850,10 +849,22 @@ void ComputeTimeDerivative<Dim, EvolutionSystem, DgStepChoosers,
                          << " because the unordered map has not been "
                             "initialized "
                             "to have the mortar id.");
-              boundary_data_history->at(mortar_id).local().insert(
-                  time_step_id, integration_order,
-                  std::move(mortar_data->at(mortar_id)));
-              mortar_data->at(mortar_id) = MortarData<Dim>{};
+              // Hand the mortar data over to the history and continue with
+              // the data of a step that was removed from the history, so the
+              // memory on the mortar is reused instead of being reallocated
+              // every step.
+              const auto local_history =
+                  boundary_data_history->at(mortar_id).local();
+              std::optional<MortarData<Dim>> removed_mortar_data =
+                  local_history.take_removed_data();
+              local_history.insert(time_step_id, integration_order,
+                                   std::move(mortar_data->at(mortar_id)));
+              if (removed_mortar_data.has_value()) {
+                removed_mortar_data->reset_keeping_allocations();
+                mortar_data->at(mortar_id) = std::move(*removed_mortar_data);
+              } else {
+                mortar_data->at(mortar_id) = MortarData<Dim>{};
+              }
             }
           }
         },
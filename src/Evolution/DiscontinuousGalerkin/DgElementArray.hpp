@@ -51,7 +51,8 @@ CREATE_HAS_STATIC_MEMBER_VARIABLE_V(local_time_stepping)
  * `PhaseDepActionList`.
  *
  * The element assignment to processors is performed by
- * `domain::BlockZCurveProcDistribution` (using a Morton space-filling curve),
+ * `domain::BlockZCurveProcDistribution` (using the Morton or Hilbert
+ * space-filling curve selected by `domain::Tags::ElementOrdering`),
  * unless `static constexpr bool use_z_order_distribution = false;` is specified
  * in the `Metavariables`, in which case elements are assigned to processors via
  * round-robin assignment. In both cases, an unordered set of `size_t`s can be
@@ -73,8 +74,10 @@ struct DgElementArray {
   using phase_dependent_action_list = PhaseDepActionList;
   using array_index = ElementId<volume_dim>;
 
-  using const_global_cache_tags = tmpl::list<domain::Tags::Domain<volume_dim>,
-                                             domain::Tags::ElementDistribution>;
+  using const_global_cache_tags =
+      tmpl::list<domain::Tags::Domain<volume_dim>,
+                 domain::Tags::ElementDistribution,
+                 domain::Tags::ElementOrdering>;
 
   using simple_tags_from_options = Parallel::get_simple_tags_from_options<
       Parallel::get_initialization_actions_list<phase_dependent_action_list>>;
@@ -121,6 +124,8 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
       get<evolution::dg::Tags::Quadrature>(initialization_items);
   const std::optional<domain::ElementWeight>& element_weight =
       Parallel::get<domain::Tags::ElementDistribution>(local_cache);
+  const domain::SpaceFillingCurve element_ordering =
+      Parallel::get<domain::Tags::ElementOrdering>(local_cache);
 
   const size_t number_of_procs = Parallel::number_of_procs<size_t>(local_cache);
   const size_t number_of_nodes = Parallel::number_of_nodes<size_t>(local_cache);
@@ -139,7 +144,7 @@ void DgElementArray<Metavariables, PhaseDepActionList>::allocate_array(
                                   quadrature);
     element_distribution = domain::BlockZCurveProcDistribution<volume_dim>{
         element_costs,   num_of_procs_to_use, blocks, initial_refinement_levels,
-        initial_extents, procs_to_ignore};
+        initial_extents, procs_to_ignore,     element_ordering};
   }
 
   // Will be used to print domain diagnostic info
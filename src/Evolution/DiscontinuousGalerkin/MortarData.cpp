@@ -23,12 +23,7 @@
 namespace evolution::dg {
 template <size_t Dim>
 MortarData<Dim>::MortarData(const size_t number_of_buffers)
-    : number_of_buffers_(number_of_buffers) {
-  time_step_id_.resize(number_of_buffers_);
-  local_mortar_data_.resize(number_of_buffers_);
-  neighbor_mortar_data_.resize(number_of_buffers_);
-  mortar_index_ = 0;
-}
+    : buffers_(number_of_buffers) {}
 
 template <size_t Dim>
 void MortarData<Dim>::insert_local_mortar_data(
@@ -36,18 +31,18 @@ void MortarData<Dim>::insert_local_mortar_data(
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
     DataVector local_mortar_vars) {
   // clang-tidy can't figure out that `vars` is moved below
-  ASSERT(not local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(not local_mortar_data().has_value(),
          "Already received local data at " << time_step_id
                                            << " with interface mesh "
                                            << local_interface_mesh);
-  ASSERT(not neighbor_mortar_data_[mortar_index_].has_value() or
-             time_step_id == time_step_id_[mortar_index_],
+  ASSERT(not neighbor_mortar_data().has_value() or
+             time_step_id == buffers_[mortar_index_].time_step_id,
          "Received local data at " << time_step_id
                                    << ", but already have neighbor data at "
-                                   << time_step_id_[mortar_index_]);
+                                   << buffers_[mortar_index_].time_step_id);
   // NOLINTNEXTLINE(performance-move-const-arg)
-  time_step_id_[mortar_index_] = std::move(time_step_id);
-  local_mortar_data_[mortar_index_] =
+  buffers_[mortar_index_].time_step_id = std::move(time_step_id);
+  local_mortar_data() =
       std::pair{std::move(local_interface_mesh), std::move(local_mortar_vars)};
 }
 
@@ -57,18 +52,18 @@ void MortarData<Dim>::insert_neighbor_mortar_data(
     // NOLINTNEXTLINE(performance-unnecessary-value-param)
     DataVector neighbor_mortar_vars) {
   // clang-tidy can't figure out that `vars` is moved below
-  ASSERT(not neighbor_mortar_data_[mortar_index_].has_value(),
+  ASSERT(not neighbor_mortar_data().has_value(),
          "Already received neighbor data at " << time_step_id
                                               << " with interface mesh "
                                               << neighbor_interface_mesh);
-  ASSERT(not local_mortar_data_[mortar_index_].has_value() or
-             time_step_id == time_step_id_[mortar_index_],
+  ASSERT(not local_mortar_data().has_value() or
+             time_step_id == buffers_[mortar_index_].time_step_id,
          "Received neighbor data at " << time_step_id
                                       << ", but already have local data at "
-                                      << time_step_id_[mortar_index_]);
+                                      << buffers_[mortar_index_].time_step_id);
   // NOLINTNEXTLINE(performance-move-const-arg)
-  time_step_id_[mortar_index_] = std::move(time_step_id);
-  neighbor_mortar_data_[mortar_index_] = std::pair{
+  buffers_[mortar_index_].time_step_id = std::move(time_step_id);
+  neighbor_mortar_data() = std::pair{
       std::move(neighbor_interface_mesh), std::move(neighbor_mortar_vars)};
 }
 
@@ -77,7 +72,7 @@ void MortarData<Dim>::insert_local_geometric_quantities(
     const Scalar<DataVector>& local_volume_det_inv_jacobian,
     const Scalar<DataVector>& local_face_det_jacobian,
     const Scalar<DataVector>& local_face_normal_magnitude) {
-  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(local_mortar_data().has_value(),
          "Must set local mortar data before setting the geometric quantities.");
   ASSERT(local_face_det_jacobian[0].size() ==
              local_face_normal_magnitude[0].size(),
@@ -121,7 +116,7 @@ void MortarData<Dim>::insert_local_geometric_quantities(
 template <size_t Dim>
 void MortarData<Dim>::insert_local_face_normal_magnitude(
     const Scalar<DataVector>& local_face_normal_magnitude) {
-  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(local_mortar_data().has_value(),
          "Must set local mortar data before setting the local face normal.");
   ASSERT(not using_volume_and_face_jacobians_,
          "The face normal magnitude cannot be inserted if the face normal, "
@@ -140,7 +135,7 @@ template <size_t Dim>
 void MortarData<Dim>::get_local_volume_det_inv_jacobian(
     const gsl::not_null<Scalar<DataVector>*> local_volume_det_inv_jacobian)
     const {
-  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(local_mortar_data().has_value(),
          "Must set local mortar data before getting the local volume inverse "
          "Jacobian determinant.");
   ASSERT(
@@ -168,7 +163,7 @@ void MortarData<Dim>::get_local_volume_det_inv_jacobian(
 template <size_t Dim>
 void MortarData<Dim>::get_local_face_det_jacobian(
     const gsl::not_null<Scalar<DataVector>*> local_face_det_jacobian) const {
-  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(local_mortar_data().has_value(),
          "Must set local mortar data before getting the local face Jacobian "
          "determinant.");
   ASSERT(local_geometric_quantities_.size() >
@@ -197,7 +192,7 @@ template <size_t Dim>
 void MortarData<Dim>::get_local_face_normal_magnitude(
     const gsl::not_null<Scalar<DataVector>*> local_face_normal_magnitude)
     const {
-  ASSERT(local_mortar_data_[mortar_index_].has_value(),
+  ASSERT(local_mortar_data().has_value(),
          "Must set local mortar data before getting the local face normal "
          "magnitude.");
   const size_t num_face_points =
@@ -220,25 +215,35 @@ std::pair<std::pair<Mesh<Dim - 1>, DataVector>,
           std::pair<Mesh<Dim - 1>, DataVector>>
 MortarData<Dim>::extract() {
   ASSERT(
-      local_mortar_data_[mortar_index_].has_value() and
-          neighbor_mortar_data_[mortar_index_].has_value(),
+      local_mortar_data().has_value() and
+          neighbor_mortar_data().has_value(),
       "Tried to extract boundary data, but do not have "
-          << (local_mortar_data_[mortar_index_].has_value()
+          << (local_mortar_data().has_value()
                   ? "neighbor"
-                  : neighbor_mortar_data_[mortar_index_].has_value() ? "local"
+                  : neighbor_mortar_data().has_value() ? "local"
                                                                      : "any")
           << " data.");
-  auto result = std::pair{std::move(*local_mortar_data_[mortar_index_]),
-                          std::move(*neighbor_mortar_data_[mortar_index_])};
-  local_mortar_data_[mortar_index_].reset();
-  neighbor_mortar_data_[mortar_index_].reset();
+  auto result = std::pair{std::move(*local_mortar_data()),
+                          std::move(*neighbor_mortar_data())};
+  local_mortar_data().reset();
+  neighbor_mortar_data().reset();
   return result;
 }
 
+template <size_t Dim>
+void MortarData<Dim>::reset_keeping_allocations() {
+  for (auto& buffer : buffers_) {
+    buffer.time_step_id = TimeStepId{};
+    buffer.neighbor_mortar_data.reset();
+  }
+  mortar_index_ = 0;
+  using_volume_and_face_jacobians_ = false;
+  using_only_face_normal_magnitude_ = false;
+}
+
 template <size_t Dim>
 void MortarData<Dim>::next_buffer() {
-  mortar_index_ =
-      mortar_index_ + 1 == number_of_buffers_ ? 0 : mortar_index_ + 1;
+  mortar_index_ = mortar_index_ + 1 == buffers_.size() ? 0 : mortar_index_ + 1;
 }
 
 template <size_t Dim>
@@ -248,16 +253,20 @@ size_t MortarData<Dim>::current_buffer_index() const {
 
 template <size_t Dim>
 size_t MortarData<Dim>::total_number_of_buffers() const {
-  return number_of_buffers_;
+  return buffers_.size();
+}
+
+template <size_t Dim>
+void MortarData<Dim>::MortarBuffer::pup(PUP::er& p) {
+  p | time_step_id;
+  p | local_mortar_data;
+  p | neighbor_mortar_data;
 }
 
 template <size_t Dim>
 void MortarData<Dim>::pup(PUP::er& p) {
-  p | number_of_buffers_;
+  p | buffers_;
   p | mortar_index_;
-  p | time_step_id_;
-  p | local_mortar_data_;
-  p | neighbor_mortar_data_;
   p | local_geometric_quantities_;
   p | using_volume_and_face_jacobians_;
   p | using_only_face_normal_magnitude_;
@@ -270,13 +279,13 @@ std::string MortarData<Dim>::pretty_print_current_buffer_no_data(
   ss << std::scientific << std::setprecision(16);
   const std::string pad(padding_size, ' ');
   ss << pad << "Current buffer: " << mortar_index_
-     << ", time = " << time_step_id_[mortar_index_] << "\n";
+     << ", time = " << time_step_id() << "\n";
   return ss.str();
 }
 
 template <size_t Dim>
 bool operator==(const MortarData<Dim>& lhs, const MortarData<Dim>& rhs) {
-  return lhs.number_of_buffers_ == rhs.number_of_buffers_ and
+  return lhs.buffers_.size() == rhs.buffers_.size() and
          lhs.mortar_index_ == rhs.mortar_index_ and
          lhs.time_step_id() == rhs.time_step_id() and
          lhs.local_mortar_data() == rhs.local_mortar_data() and
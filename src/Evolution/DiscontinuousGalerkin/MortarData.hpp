@@ -9,6 +9,7 @@
 #include <pup.h>
 #include <string>
 #include <utility>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
@@ -148,6 +149,18 @@ class MortarData {
   auto extract() -> std::pair<std::pair<Mesh<Dim - 1>, DataVector>,
                               std::pair<Mesh<Dim - 1>, DataVector>>;
 
+  /*!
+   * \brief Reset the data so that new data can be inserted, but keep the
+   * memory of the local mortar data and the local geometric quantities.
+   *
+   * The local mortar data remains set, though its values are unspecified, so
+   * that the next step can write into it without allocating as long as the
+   * number of grid points on the mortar doesn't change. This is used to reuse
+   * the `MortarData` of steps that were removed from the boundary history
+   * with local time stepping.
+   */
+  void reset_keeping_allocations();
+
   /// Move to the next internal mortar buffer
   void next_buffer();
 
@@ -159,29 +172,29 @@ class MortarData {
   size_t total_number_of_buffers() const;
 
   const TimeStepId& time_step_id() const {
-    return time_step_id_[mortar_index_];
+    return buffers_[mortar_index_].time_step_id;
   }
 
-  TimeStepId& time_step_id() { return time_step_id_[mortar_index_]; }
+  TimeStepId& time_step_id() { return buffers_[mortar_index_].time_step_id; }
 
   auto local_mortar_data() const
       -> const std::optional<std::pair<Mesh<Dim - 1>, DataVector>>& {
-    return local_mortar_data_[mortar_index_];
+    return buffers_[mortar_index_].local_mortar_data;
   }
 
   auto neighbor_mortar_data() const
       -> const std::optional<std::pair<Mesh<Dim - 1>, DataVector>>& {
-    return neighbor_mortar_data_[mortar_index_];
+    return buffers_[mortar_index_].neighbor_mortar_data;
   }
 
   auto local_mortar_data()
       -> std::optional<std::pair<Mesh<Dim - 1>, DataVector>>& {
-    return local_mortar_data_[mortar_index_];
+    return buffers_[mortar_index_].local_mortar_data;
   }
 
   auto neighbor_mortar_data()
       -> std::optional<std::pair<Mesh<Dim - 1>, DataVector>>& {
-    return neighbor_mortar_data_[mortar_index_];
+    return buffers_[mortar_index_].neighbor_mortar_data;
   }
 
   // NOLINTNEXTLINE(google-runtime-references)
@@ -195,10 +208,18 @@ class MortarData {
   friend bool operator==(const MortarData<LocalDim>& lhs,
                          const MortarData<LocalDim>& rhs);
 
-  size_t number_of_buffers_{1};
-  std::vector<TimeStepId> time_step_id_{};
-  std::vector<MortarType> local_mortar_data_{};
-  std::vector<MortarType> neighbor_mortar_data_{};
+  // All data of one buffer is stored together so that constructing a
+  // `MortarData` needs only a single allocation.
+  struct MortarBuffer {
+    TimeStepId time_step_id{};
+    MortarType local_mortar_data{};
+    MortarType neighbor_mortar_data{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p);
+  };
+
+  std::vector<MortarBuffer> buffers_{};
   size_t mortar_index_{0};
   DataVector local_geometric_quantities_{};
   bool using_volume_and_face_jacobians_{false};
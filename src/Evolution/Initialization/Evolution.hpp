@@ -30,6 +30,7 @@
 #include "Time/Slab.hpp"
 #include "Time/StepChoosers/StepChooser.hpp"
 #include "Time/Tags/AdaptiveSteppingDiagnostics.hpp"
+#include "Time/Tags/DenseOutputCache.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Time/Tags/StepChoosers.hpp"
 #include "Time/Tags/Time.hpp"
@@ -269,6 +270,7 @@ struct ProjectTimeStepping : tt::ConformsTo<amr::protocols::Projector> {
 /// - Adds:
 ///   * `db::add_tag_prefix<Tags::dt, variables_tag>`
 ///   * `Tags::HistoryEvolvedVariables<variables_tag, dt_variables_tag>`
+///   * `Tags::DenseOutputCache<variables_tag>`
 /// - Removes: nothing
 /// - Modifies: nothing
 ///
@@ -284,12 +286,16 @@ struct TimeStepperHistory {
   using simple_tags_from_options = tmpl::list<>;
   using simple_tags =
       tmpl::list<dt_variables_tag,
-                 ::Tags::HistoryEvolvedVariables<variables_tag>>;
+                 ::Tags::HistoryEvolvedVariables<variables_tag>,
+                 ::Tags::DenseOutputCache<variables_tag>>;
   using compute_tags = tmpl::list<>;
 
   using argument_tags =
       tmpl::list<::Tags::TimeStepper<TimeStepper>, domain::Tags::Mesh<dim>>;
-  using return_tags = simple_tags;
+  // The dense output cache starts out empty.
+  using return_tags =
+      tmpl::list<dt_variables_tag,
+                 ::Tags::HistoryEvolvedVariables<variables_tag>>;
 
   static void apply(
       const gsl::not_null<typename dt_variables_tag::type*> dt_vars,
@@ -3,19 +3,29 @@
 
 #include "Evolution/Systems/Cce/BoundaryData.hpp"
 
+#include <algorithm>
+#include <array>
+#include <complex>
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
 #include "DataStructures/Variables.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCoefficients.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshDerivatives.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/CaptureForError.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
 #include "Utilities/SetNumberOfGridPoints.hpp"
 
@@ -99,17 +109,118 @@ void cartesian_to_spherical_coordinates_and_jacobians(
   get<2, 2>(*inverse_cartesian_to_spherical_jacobian) = 0.0;
 }
 
+namespace detail {
+template <size_t N>
+void batched_real_inverse_swsh_transform(
+    const std::array<DataVector*, N>& collocations,
+    const std::array<const ComplexModalVector*, N>& coefficients,
+    const size_t l_max) {
+  const size_t number_of_coefficients =
+      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+
+  ScratchArena::Scope scratch{};
+  SpinWeighted<ComplexModalVector, 0> stacked_coefficients{};
+  stacked_coefficients.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_coefficients),
+      N * number_of_coefficients);
+  SpinWeighted<ComplexDataVector, 0> stacked_collocations{};
+  stacked_collocations.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_angular_points),
+      N * number_of_angular_points);
+
+  for (size_t i = 0; i < N; ++i) {
+    ASSERT(gsl::at(coefficients, i)->size() == number_of_coefficients,
+           "Expected " << number_of_coefficients << " coefficients for l_max "
+                       << l_max << ", but received "
+                       << gsl::at(coefficients, i)->size());
+    std::copy(gsl::at(coefficients, i)->begin(),
+              gsl::at(coefficients, i)->end(),
+              stacked_coefficients.data().begin() + i * number_of_coefficients);
+  }
+  Spectral::Swsh::inverse_swsh_transform(
+      l_max, N, make_not_null(&stacked_collocations), stacked_coefficients);
+  for (size_t i = 0; i < N; ++i) {
+    const ComplexDataVector collocation_view{
+        stacked_collocations.data().data() + i * number_of_angular_points,
+        number_of_angular_points};
+    *gsl::at(collocations, i) = real(collocation_view);
+  }
+}
+
+template <size_t N>
+void batched_real_angular_derivatives(
+    const std::array<DataVector*, N>& theta_derivatives,
+    const std::array<DataVector*, N>& phi_derivatives,
+    const std::array<const DataVector*, N>& values, const size_t l_max) {
+  const size_t number_of_coefficients =
+      Spectral::Swsh::size_of_libsharp_coefficient_vector(l_max);
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+
+  ScratchArena::Scope scratch{};
+  SpinWeighted<ComplexDataVector, 0> stacked_values{};
+  stacked_values.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_angular_points),
+      N * number_of_angular_points);
+  SpinWeighted<ComplexDataVector, 1> stacked_eth_values{};
+  stacked_eth_values.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_angular_points),
+      N * number_of_angular_points);
+  SpinWeighted<ComplexModalVector, 0> value_modes{};
+  value_modes.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_coefficients),
+      N * number_of_coefficients);
+  SpinWeighted<ComplexModalVector, 1> eth_value_modes{};
+  eth_value_modes.set_data_ref(
+      scratch.allocate<std::complex<double>>(N * number_of_coefficients),
+      N * number_of_coefficients);
+
+  for (size_t i = 0; i < N; ++i) {
+    ComplexDataVector value_view{
+        stacked_values.data().data() + i * number_of_angular_points,
+        number_of_angular_points};
+    value_view = std::complex<double>(1.0, 0.0) * *gsl::at(values, i);
+  }
+  Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
+      l_max, N, make_not_null(&eth_value_modes), make_not_null(&value_modes),
+      make_not_null(&stacked_eth_values), stacked_values);
+  for (size_t i = 0; i < N; ++i) {
+    const ComplexDataVector eth_value_view{
+        stacked_eth_values.data().data() + i * number_of_angular_points,
+        number_of_angular_points};
+    *gsl::at(theta_derivatives, i) = -real(eth_value_view);
+    *gsl::at(phi_derivatives, i) = -imag(eth_value_view);
+  }
+}
+
+#define GET_SIZE(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data)                                                \
+  template void batched_real_inverse_swsh_transform(                        \
+      const std::array<DataVector*, GET_SIZE(data)>& collocations,         \
+      const std::array<const ComplexModalVector*, GET_SIZE(data)>&          \
+          coefficients,                                                     \
+      size_t l_max);                                                        \
+  template void batched_real_angular_derivatives(                           \
+      const std::array<DataVector*, GET_SIZE(data)>& theta_derivatives,    \
+      const std::array<DataVector*, GET_SIZE(data)>& phi_derivatives,      \
+      const std::array<const DataVector*, GET_SIZE(data)>& values,          \
+      size_t l_max);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (1, 3, 6, 9, 18))
+
+#undef INSTANTIATE
+#undef GET_SIZE
+}  // namespace detail
+
 void cartesian_spatial_metric_and_derivatives_from_modes(
     const gsl::not_null<tnsr::ii<DataVector, 3>*> cartesian_spatial_metric,
     const gsl::not_null<tnsr::II<DataVector, 3>*>
         inverse_cartesian_spatial_metric,
     const gsl::not_null<tnsr::ijj<DataVector, 3>*> d_cartesian_spatial_metric,
     const gsl::not_null<tnsr::ii<DataVector, 3>*> dt_cartesian_spatial_metric,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::ii<ComplexModalVector, 3>& spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dr_spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dt_spatial_metric_coefficients,
@@ -120,60 +231,50 @@ void cartesian_spatial_metric_and_derivatives_from_modes(
   set_number_of_grid_points(d_cartesian_spatial_metric, size);
   set_number_of_grid_points(dt_cartesian_spatial_metric, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
-
   // Allocation
   SphericaliCartesianjj spherical_d_cartesian_spatial_metric{size};
 
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  std::array<DataVector*, 18> collocations{};
+  std::array<const ComplexModalVector*, 18> coefficients{};
+  size_t component = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // copy the modes to a spin-weighted type for interpolation
-      get(*interpolation_modal_buffer).data() =
-          spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dt_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      dt_cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dr_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      spherical_d_cartesian_spatial_metric.get(0, i, j) =
-          real(get(*interpolation_buffer).data());
+      gsl::at(collocations, component) = &cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, component) = &spatial_metric_coefficients.get(i, j);
+      gsl::at(collocations, component + 6) =
+          &dt_cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, component + 6) =
+          &dt_spatial_metric_coefficients.get(i, j);
+      gsl::at(collocations, component + 12) =
+          &spherical_d_cartesian_spatial_metric.get(0, i, j);
+      gsl::at(coefficients, component + 12) =
+          &dr_spatial_metric_coefficients.get(i, j);
+      ++component;
     }
   }
+  detail::batched_real_inverse_swsh_transform(collocations, coefficients,
+                                              l_max);
 
   *inverse_cartesian_spatial_metric =
       determinant_and_inverse(*cartesian_spatial_metric).second;
 
+  std::array<DataVector*, 6> theta_derivatives{};
+  std::array<DataVector*, 6> phi_derivatives{};
+  std::array<const DataVector*, 6> values{};
+  component = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // reusing the interpolation buffer for taking the angular derivatives
-      get(*interpolation_buffer) =
-          std::complex<double>(1.0, 0.0) * cartesian_spatial_metric->get(i, j);
-      Spectral::Swsh::angular_derivatives<
-          tmpl::list<Spectral::Swsh::Tags::Eth>>(
-          l_max, 1, make_not_null(&get(*eth_buffer)),
-          get(*interpolation_buffer));
-      spherical_d_cartesian_spatial_metric.get(1, i, j) =
-          -real(get(*eth_buffer).data());
-      spherical_d_cartesian_spatial_metric.get(2, i, j) =
-          -imag(get(*eth_buffer).data());
+      gsl::at(theta_derivatives, component) =
+          &spherical_d_cartesian_spatial_metric.get(1, i, j);
+      gsl::at(phi_derivatives, component) =
+          &spherical_d_cartesian_spatial_metric.get(2, i, j);
+      gsl::at(values, component) = &cartesian_spatial_metric->get(i, j);
+      ++component;
     }
   }
+  detail::batched_real_angular_derivatives(theta_derivatives, phi_derivatives,
+                                           values, l_max);
 
   // convert derivatives to cartesian form
   for (size_t i = 0; i < 3; ++i) {
@@ -196,11 +297,6 @@ void cartesian_shift_and_derivatives_from_modes(
     const gsl::not_null<tnsr::I<DataVector, 3>*> cartesian_shift,
     const gsl::not_null<tnsr::iJ<DataVector, 3>*> d_cartesian_shift,
     const gsl::not_null<tnsr::I<DataVector, 3>*> dt_cartesian_shift,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::I<ComplexModalVector, 3>& shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dr_shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dt_shift_coefficients,
@@ -211,44 +307,33 @@ void cartesian_shift_and_derivatives_from_modes(
   set_number_of_grid_points(d_cartesian_shift, size);
   set_number_of_grid_points(dt_cartesian_shift, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
-
   // Allocation
   SphericaliCartesianJ spherical_d_cartesian_shift{size};
 
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  std::array<DataVector*, 9> collocations{};
+  std::array<const ComplexModalVector*, 9> coefficients{};
   for (size_t i = 0; i < 3; ++i) {
-    // copy the modes to a spin-weighted type for interpolation
-    get(*interpolation_modal_buffer).data() = shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dt_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    dt_cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dr_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    spherical_d_cartesian_shift.get(0, i) =
-        real(get(*interpolation_buffer).data());
-  }
-
-  for (size_t i = 0; i < 3; ++i) {
-    // reusing the interpolation buffer for taking the angular derivatives
-    get(*interpolation_buffer) =
-        std::complex<double>(1.0, 0.0) * cartesian_shift->get(i);
-    Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-        l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-    spherical_d_cartesian_shift.get(1, i) = -real(get(*eth_buffer).data());
-    spherical_d_cartesian_shift.get(2, i) = -imag(get(*eth_buffer).data());
+    gsl::at(collocations, i) = &cartesian_shift->get(i);
+    gsl::at(coefficients, i) = &shift_coefficients.get(i);
+    gsl::at(collocations, i + 3) = &dt_cartesian_shift->get(i);
+    gsl::at(coefficients, i + 3) = &dt_shift_coefficients.get(i);
+    gsl::at(collocations, i + 6) = &spherical_d_cartesian_shift.get(0, i);
+    gsl::at(coefficients, i + 6) = &dr_shift_coefficients.get(i);
   }
+  detail::batched_real_inverse_swsh_transform(collocations, coefficients,
+                                              l_max);
+
+  detail::batched_real_angular_derivatives<3>(
+      {{&spherical_d_cartesian_shift.get(1, 0),
+        &spherical_d_cartesian_shift.get(1, 1),
+        &spherical_d_cartesian_shift.get(1, 2)}},
+      {{&spherical_d_cartesian_shift.get(2, 0),
+        &spherical_d_cartesian_shift.get(2, 1),
+        &spherical_d_cartesian_shift.get(2, 2)}},
+      {{&get<0>(*cartesian_shift), &get<1>(*cartesian_shift),
+        &get<2>(*cartesian_shift)}},
+      l_max);
 
   // convert derivatives to cartesian form
   for (size_t i = 0; i < 3; ++i) {
@@ -269,11 +354,6 @@ void cartesian_lapse_and_derivatives_from_modes(
     const gsl::not_null<Scalar<DataVector>*> cartesian_lapse,
     const gsl::not_null<tnsr::i<DataVector, 3>*> d_cartesian_lapse,
     const gsl::not_null<Scalar<DataVector>*> dt_cartesian_lapse,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const Scalar<ComplexModalVector>& lapse_coefficients,
     const Scalar<ComplexModalVector>& dr_lapse_coefficients,
     const Scalar<ComplexModalVector>& dt_lapse_coefficients,
@@ -284,38 +364,20 @@ void cartesian_lapse_and_derivatives_from_modes(
   set_number_of_grid_points(d_cartesian_lapse, size);
   set_number_of_grid_points(dt_cartesian_lapse, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
-
   // Allocation
   tnsr::i<DataVector, 3> spherical_d_cartesian_lapse{size};
-  // copy the modes to a spin-weighted type for interpolation
-  get(*interpolation_modal_buffer).data() = get(lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dt_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*dt_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dr_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get<0>(spherical_d_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  // reusing the interpolation buffer for taking the angular derivatives
-  get(*interpolation_buffer) =
-      std::complex<double>(1.0, 0.0) * get(*cartesian_lapse);
-  Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-      l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-  spherical_d_cartesian_lapse.get(1) = -real(get(*eth_buffer).data());
-  spherical_d_cartesian_lapse.get(2) = -imag(get(*eth_buffer).data());
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  detail::batched_real_inverse_swsh_transform<3>(
+      {{&get(*cartesian_lapse), &get(*dt_cartesian_lapse),
+        &get<0>(spherical_d_cartesian_lapse)}},
+      {{&get(lapse_coefficients), &get(dt_lapse_coefficients),
+        &get(dr_lapse_coefficients)}},
+      l_max);
+
+  detail::batched_real_angular_derivatives<1>(
+      {{&get<1>(spherical_d_cartesian_lapse)}},
+      {{&get<2>(spherical_d_cartesian_lapse)}}, {{&get(*cartesian_lapse)}},
+      l_max);
 
   // convert derivatives to cartesian form
   for (size_t k = 0; k < 3; ++k) {
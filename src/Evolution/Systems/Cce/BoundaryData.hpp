@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataBox/DataBox.hpp"
@@ -83,6 +84,31 @@ void cartesian_to_spherical_coordinates_and_jacobians(
     const Scalar<DataVector>& sin_phi, const Scalar<DataVector>& sin_theta,
     double extraction_radius);
 
+namespace detail {
+// Sets each of the `collocations` to the real part of the inverse spin-weighted
+// transform of the corresponding spin-0 `coefficients` on a single spherical
+// shell. The coefficients are stacked in a buffer from the `ScratchArena` as if
+// they were consecutive radial shells, so that libsharp performs all of the
+// transforms in a single batch rather than one call per component.
+template <size_t N>
+void batched_real_inverse_swsh_transform(
+    const std::array<DataVector*, N>& collocations,
+    const std::array<const ComplexModalVector*, N>& coefficients,
+    size_t l_max);
+
+// Computes the angular derivatives of each of the real `values` on a single
+// spherical shell from the negated real and imaginary parts of
+// \f$\eth\f$ of the value, placing \f$\partial_\theta\f$ in
+// `theta_derivatives` and \f$\partial_\phi / \sin \theta\f$ in
+// `phi_derivatives`. As in `batched_real_inverse_swsh_transform`, all of the
+// derivatives are evaluated in a single batch.
+template <size_t N>
+void batched_real_angular_derivatives(
+    const std::array<DataVector*, N>& theta_derivatives,
+    const std::array<DataVector*, N>& phi_derivatives,
+    const std::array<const DataVector*, N>& values, size_t l_max);
+}  // namespace detail
+
 /*
  * \brief Compute \f$g_{i j}\f$, \f$g^{i j}\f$, \f$\partial_i g_{j k}\f$, and
  * \f$\partial_t g_{i j}\f$ from input libsharp-compatible modal spatial
@@ -99,11 +125,6 @@ void cartesian_spatial_metric_and_derivatives_from_modes(
     gsl::not_null<tnsr::II<DataVector, 3>*> inverse_cartesian_spatial_metric,
     gsl::not_null<tnsr::ijj<DataVector, 3>*> d_cartesian_spatial_metric,
     gsl::not_null<tnsr::ii<DataVector, 3>*> dt_cartesian_spatial_metric,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::ii<ComplexModalVector, 3>& spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dr_spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dt_spatial_metric_coefficients,
@@ -125,11 +146,6 @@ void cartesian_shift_and_derivatives_from_modes(
     gsl::not_null<tnsr::I<DataVector, 3>*> cartesian_shift,
     gsl::not_null<tnsr::iJ<DataVector, 3>*> d_cartesian_shift,
     gsl::not_null<tnsr::I<DataVector, 3>*> dt_cartesian_shift,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::I<ComplexModalVector, 3>& shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dr_shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dt_shift_coefficients,
@@ -151,11 +167,6 @@ void cartesian_lapse_and_derivatives_from_modes(
     gsl::not_null<Scalar<DataVector>*> cartesian_lapse,
     gsl::not_null<tnsr::i<DataVector, 3>*> d_cartesian_lapse,
     gsl::not_null<Scalar<DataVector>*> dt_cartesian_lapse,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const Scalar<ComplexModalVector>& lapse_coefficients,
     const Scalar<ComplexModalVector>& dr_lapse_coefficients,
     const Scalar<ComplexModalVector>& dt_lapse_coefficients,
@@ -1086,22 +1097,11 @@ void create_bondi_boundary_data(
   auto& dt_cartesian_spatial_metric =
       get<::Tags::dt<gr::Tags::SpatialMetric<DataVector, 3>>>(
           computation_variables);
-  auto& interpolation_buffer =
-      get<::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
-                               std::integral_constant<int, 0>>>(
-          derivative_buffers);
-  Scalar<SpinWeighted<ComplexModalVector, 0>> interpolation_modal_buffer{size};
-  auto& eth_buffer =
-      get<::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
-                               std::integral_constant<int, 1>>>(
-          derivative_buffers);
   cartesian_spatial_metric_and_derivatives_from_modes(
       make_not_null(&cartesian_spatial_metric),
       make_not_null(&inverse_spatial_metric),
       make_not_null(&d_cartesian_spatial_metric),
       make_not_null(&dt_cartesian_spatial_metric),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       spatial_metric_coefficients, dr_spatial_metric_coefficients,
       dt_spatial_metric_coefficients, inverse_cartesian_to_spherical_jacobian,
       l_max);
@@ -1117,8 +1117,6 @@ void create_bondi_boundary_data(
   cartesian_shift_and_derivatives_from_modes(
       make_not_null(&cartesian_shift), make_not_null(&d_cartesian_shift),
       make_not_null(&dt_cartesian_shift),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       shift_coefficients, dr_shift_coefficients, dt_shift_coefficients,
       inverse_cartesian_to_spherical_jacobian, l_max);
 
@@ -1132,8 +1130,6 @@ void create_bondi_boundary_data(
   cartesian_lapse_and_derivatives_from_modes(
       make_not_null(&cartesian_lapse), make_not_null(&d_cartesian_lapse),
       make_not_null(&dt_cartesian_lapse),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       lapse_coefficients, dr_lapse_coefficients, dt_lapse_coefficients,
       inverse_cartesian_to_spherical_jacobian, l_max);
 
@@ -4,6 +4,7 @@
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 
 #include <cstddef>
+#include <vector>
 
 #include "DataStructures/ApplyMatrices.hpp"
 #include "DataStructures/DataVector.hpp"
@@ -21,6 +22,12 @@
 #include "Utilities/StaticCache.hpp"
 #include "Utilities/VectorAlgebra.hpp"
 
+#ifdef _OPENMP
+#ifndef CCE_LINEAR_SOLVE_NUM_THREADS
+#define CCE_LINEAR_SOLVE_NUM_THREADS 1
+#endif  // CCE_LINEAR_SOLVE_NUM_THREADS
+#endif  // _OPENMP
+
 namespace Cce {
 namespace {
 // This builds up the spectral representation of the matrix associated with the
@@ -137,15 +144,14 @@ void transpose_to_reals_then_imags_radial_stripes(
     const gsl::not_null<DataVector*> result, const ComplexDataVector& input,
     const size_t number_of_radial_points,
     const size_t number_of_angular_points) {
-  for (size_t i = 0; i < input.size() * 2; ++i) {
-    (*result)[i] = ((i / number_of_radial_points) % 2) == 0
-                       ? real(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)])
-                       : imag(input[number_of_angular_points *
-                                        (i % number_of_radial_points) +
-                                    i / (2 * number_of_radial_points)]);
-  }
+  // Viewed as doubles, the input is a row-major matrix with one row of
+  // interleaved real and imaginary parts per radial point, so the stripes are
+  // obtained by a transpose.
+  raw_transpose(
+      make_not_null(result->data()),
+      // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
+      reinterpret_cast<const double*>(input.data()),
+      2 * number_of_angular_points, number_of_radial_points);
 }
 }  // namespace detail
 
@@ -222,14 +228,10 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
   const size_t number_of_angular_points =
       Spectral::Swsh::number_of_swsh_collocation_points(l_max);
 
-  Matrix operator_matrix(2 * number_of_radial_points,
-                         2 * number_of_radial_points);
-
-  ComplexDataVector integrand =
+  const ComplexDataVector integrand =
       get(pole_of_integrand).data() +
       get(one_minus_y).data() * get(regular_integrand).data();
 
-  DataVector transpose_buffer{2 * get(pole_of_integrand).size()};
   DataVector linear_solve_buffer{2 * get(pole_of_integrand).size()};
 
   // transpose such that each radial slice is split up into the order:
@@ -238,83 +240,100 @@ void RadialIntegrateBondi<BoundaryPrefix, Tags::BondiH>::apply(
       make_not_null(&linear_solve_buffer), integrand, number_of_radial_points,
       number_of_angular_points);
 
-  raw_transpose(make_not_null(transpose_buffer.data()),
-                linear_solve_buffer.data(), number_of_radial_points,
-                2 * number_of_angular_points);
+  // The linear factors only enter the operator through their sum and
+  // difference, so those are computed for the full volume at once rather than
+  // at each angular point.
+  const ComplexDataVector linear_factor_sum =
+      get(linear_factor).data() + get(linear_factor_of_conjugate).data();
+  const ComplexDataVector linear_factor_difference =
+      get(linear_factor).data() - get(linear_factor_of_conjugate).data();
 
+  // The (1 - y) \partial_y part of the operator is the same for every angular
+  // point.
   const auto& derivative_matrix =
       Spectral::differentiation_matrix<Spectral::Basis::Legendre,
                                        Spectral::Quadrature::GaussLobatto>(
           number_of_radial_points);
-  for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
-    // on repeated evaluations, the matrix gets permuted by the dgesv routine.
-    // We'll ignore its pivots and just overwrite the whole thing on each
-    // pass. There are probably optimizations that can be made which make use
-    // of the pivots.
-
-    // first we apply the (1 - y) \partial_y part of the matrix
-    // to the upper right (real-real) and lower left (imag-imag) part of the
-    // matrix
-    for (size_t matrix_block = 0; matrix_block < 2; ++matrix_block) {
-      for (size_t i = 0; i < number_of_radial_points; ++i) {
-        for (size_t j = 0; j < number_of_radial_points; ++j) {
-          operator_matrix(i + matrix_block * number_of_radial_points,
-                          j + matrix_block * number_of_radial_points) =
-              derivative_matrix(i, j) *
-              real(get(one_minus_y).data()[i * number_of_angular_points]);
-        }
-      }
+  Matrix one_minus_y_derivative_matrix(number_of_radial_points,
+                                       number_of_radial_points);
+  for (size_t i = 0; i < number_of_radial_points; ++i) {
+    for (size_t j = 0; j < number_of_radial_points; ++j) {
+      one_minus_y_derivative_matrix(i, j) =
+          derivative_matrix(i, j) *
+          real(get(one_minus_y).data()[i * number_of_angular_points]);
     }
+  }
+
+  // The solves at different angular points are independent, so they are
+  // distributed over `CCE_LINEAR_SOLVE_NUM_THREADS` threads when OpenMP is
+  // enabled.
+#ifdef _OPENMP
+#pragma omp parallel num_threads(CCE_LINEAR_SOLVE_NUM_THREADS)
+#endif  // _OPENMP
+  {
+    Matrix operator_matrix(2 * number_of_radial_points,
+                           2 * number_of_radial_points);
+    std::vector<int> pivots(2 * number_of_radial_points);
+#ifdef _OPENMP
+#pragma omp for
+#endif  // _OPENMP
+    for (size_t offset = 0; offset < number_of_angular_points; ++offset) {
+      // on repeated evaluations, the matrix gets permuted by the dgesv
+      // routine. We'll ignore its pivots and just overwrite the whole thing on
+      // each pass.
 
-    // zero out the lower left and upper right part of the matrix
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
+      // first we apply the (1 - y) \partial_y part of the matrix to the upper
+      // left (real-real) and lower right (imag-imag) part of the matrix, and
+      // zero out the lower left and upper right part of the matrix
       for (size_t j = 0; j < number_of_radial_points; ++j) {
-        operator_matrix(i + number_of_radial_points, j) = 0.0;
-        operator_matrix(i, j + number_of_radial_points) = 0.0;
+        for (size_t i = 0; i < number_of_radial_points; ++i) {
+          operator_matrix(i, j) = one_minus_y_derivative_matrix(i, j);
+          operator_matrix(i + number_of_radial_points,
+                          j + number_of_radial_points) =
+              one_minus_y_derivative_matrix(i, j);
+          operator_matrix(i + number_of_radial_points, j) = 0.0;
+          operator_matrix(i, j + number_of_radial_points) = 0.0;
+        }
       }
-    }
 
-    // gather the contributions to the matrix blocks from the linear factors
-    // each, we zero the first row
-    for (size_t i = 0; i < number_of_radial_points; ++i) {
-      const size_t linear_factor_index = offset + i * number_of_angular_points;
-      // upper left
-      operator_matrix(i, i) +=
-          real(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, i) = 0.0;
-      // upper right
-      operator_matrix(i, number_of_radial_points + i) -=
-          imag(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(0, number_of_radial_points + i) = 0.0;
-      // lower left
-      operator_matrix(number_of_radial_points + i, i) +=
-          imag(get(linear_factor).data()[linear_factor_index] +
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, i) = 0.0;
-      // lower right
-      operator_matrix(number_of_radial_points + i,
-                      number_of_radial_points + i) +=
-          real(get(linear_factor).data()[linear_factor_index] -
-               get(linear_factor_of_conjugate).data()[linear_factor_index]);
-      operator_matrix(number_of_radial_points, number_of_radial_points + i) =
-          0.0;
+      // gather the contributions to the matrix blocks from the linear factors
+      // each, we zero the first row
+      for (size_t i = 0; i < number_of_radial_points; ++i) {
+        const size_t linear_factor_index =
+            offset + i * number_of_angular_points;
+        // upper left
+        operator_matrix(i, i) += real(linear_factor_sum[linear_factor_index]);
+        operator_matrix(0, i) = 0.0;
+        // upper right
+        operator_matrix(i, number_of_radial_points + i) -=
+            imag(linear_factor_difference[linear_factor_index]);
+        operator_matrix(0, number_of_radial_points + i) = 0.0;
+        // lower left
+        operator_matrix(number_of_radial_points + i, i) +=
+            imag(linear_factor_sum[linear_factor_index]);
+        operator_matrix(number_of_radial_points, i) = 0.0;
+        // lower right
+        operator_matrix(number_of_radial_points + i,
+                        number_of_radial_points + i) +=
+            real(linear_factor_difference[linear_factor_index]);
+        operator_matrix(number_of_radial_points,
+                        number_of_radial_points + i) = 0.0;
+      }
+      operator_matrix(0, 0) = 1.0;
+      operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
+      // put the data currently in integrand into a real DataVector of twice
+      // the length
+      linear_solve_buffer[offset * 2 * number_of_radial_points] =
+          real(get(boundary).data()[offset]);
+      linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
+          imag(get(boundary).data()[offset]);
+      DataVector linear_solve_buffer_view{
+          linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
+          2 * number_of_radial_points};
+      lapack::general_matrix_linear_solve(
+          make_not_null(&linear_solve_buffer_view), make_not_null(&pivots),
+          make_not_null(&operator_matrix));
     }
-    operator_matrix(0, 0) = 1.0;
-    operator_matrix(number_of_radial_points, number_of_radial_points) = 1.0;
-    // put the data currently in integrand into a real DataVector of twice the
-    // length
-    linear_solve_buffer[offset * 2 * number_of_radial_points] =
-        real(get(boundary).data()[offset]);
-    linear_solve_buffer[(offset * 2 + 1) * number_of_radial_points] =
-        imag(get(boundary).data()[offset]);
-    DataVector linear_solve_buffer_view{
-        linear_solve_buffer.data() + offset * 2 * number_of_radial_points,
-        2 * number_of_radial_points};
-    lapack::general_matrix_linear_solve(
-        make_not_null(&linear_solve_buffer_view),
-        make_not_null(&operator_matrix));
   }
   // NOLINTNEXTLINE(cppcoreguidelines-pro-type-reinterpret-cast)
   raw_transpose(make_not_null(reinterpret_cast<double*>(
@@ -93,6 +93,11 @@ void transpose_to_reals_then_imags_radial_stripes(
  * \f$L^\prime\f$ ensure that the only current method we have for evaluating the
  * \f$H\f$ hypersurface equation is a direct linear solve, rather than the
  * spectral matrix multiplications which are available for the other integrals.
+ * The linear solves at different angular points are independent, and are
+ * distributed over threads when SpECTRE is built with `ENABLE_OPENMP`. The
+ * number of threads is set by the CMake option `CCE_LINEAR_SOLVE_NUM_THREADS`
+ * and defaults to 1, so that the solves don't compete with the Charm++ worker
+ * threads unless requested.
  *
  * In each case, the boundary value at the world tube for the integration is
  * retrieved from `BoundaryPrefix<Tag>`.
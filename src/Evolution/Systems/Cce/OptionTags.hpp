@@ -157,6 +157,26 @@ struct H5LookaheadTimes {
   using group = Cce;
 };
 
+struct H5Prefetch {
+  using type = bool;
+  static constexpr Options::String help{
+      "Read the next span of worldtube data from the h5 file on a background "
+      "thread while the current span is used. This has no effect if "
+      "H5LoadAllData is true."};
+  static bool suggested_value() { return false; }
+  using group = Cce;
+};
+
+struct H5LoadAllData {
+  using type = bool;
+  static constexpr Options::String help{
+      "Read the full worldtube data into memory when it is first needed, so "
+      "that no further reads from the h5 file are necessary. This requires "
+      "enough memory to hold all of the worldtube data."};
+  static bool suggested_value() { return false; }
+  using group = Cce;
+};
+
 struct H5Interpolator {
   using type = std::unique_ptr<intrp::SpanInterpolator>;
   static constexpr Options::String help{
@@ -294,14 +314,16 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
       Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::BoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5Prefetch,
+                 OptionTags::H5LoadAllData, OptionTags::H5Interpolator,
                  OptionTags::H5IsBondiData, OptionTags::FixSpecNormalization,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const bool prefetch,
+      const bool load_all_data,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const bool h5_is_bondi_data, const bool fix_spec_normalization,
       const std::optional<double> extraction_radius) {
@@ -316,15 +338,16 @@ struct H5WorldtubeBoundaryDataManager : db::SimpleTag {
             "clearer.\n");
       }
       return std::make_unique<BondiWorldtubeDataManager>(
-          std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
-                                                          extraction_radius),
-          l_max, number_of_lookahead_times, interpolator->get_clone());
+          std::make_unique<BondiWorldtubeH5BufferUpdater>(
+              filename, extraction_radius, load_all_data),
+          l_max, number_of_lookahead_times, interpolator->get_clone(),
+          prefetch and not load_all_data);
     } else {
       return std::make_unique<MetricWorldtubeDataManager>(
-          std::make_unique<MetricWorldtubeH5BufferUpdater>(filename,
-                                                           extraction_radius),
+          std::make_unique<MetricWorldtubeH5BufferUpdater>(
+              filename, extraction_radius, load_all_data),
           l_max, number_of_lookahead_times, interpolator->get_clone(),
-          fix_spec_normalization);
+          fix_spec_normalization, prefetch and not load_all_data);
     }
   }
 };
@@ -335,19 +358,22 @@ struct KleinGordonH5WorldtubeBoundaryDataManager : db::SimpleTag {
       WorldtubeDataManager<Tags::klein_gordon_worldtube_boundary_tags>>;
   using option_tags =
       tmpl::list<OptionTags::LMax, OptionTags::KleinGordonBoundaryDataFilename,
-                 OptionTags::H5LookaheadTimes, OptionTags::H5Interpolator,
+                 OptionTags::H5LookaheadTimes, OptionTags::H5Prefetch,
+                 OptionTags::H5LoadAllData, OptionTags::H5Interpolator,
                  OptionTags::StandaloneExtractionRadius>;
 
   static constexpr bool pass_metavariables = false;
   static type create_from_options(
       const size_t l_max, const std::string& filename,
-      const size_t number_of_lookahead_times,
+      const size_t number_of_lookahead_times, const bool prefetch,
+      const bool load_all_data,
       const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
       const std::optional<double> extraction_radius) {
     return std::make_unique<KleinGordonWorldtubeDataManager>(
         std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(
-            filename, extraction_radius),
-        l_max, number_of_lookahead_times, interpolator->get_clone());
+            filename, extraction_radius, load_all_data),
+        l_max, number_of_lookahead_times, interpolator->get_clone(),
+        prefetch and not load_all_data);
   }
 };
 
@@ -3,16 +3,18 @@
 
 #include "Evolution/Systems/Cce/SpecBoundaryData.hpp"
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
 #include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "DataStructures/Tensor/TypeAliases.hpp"
+#include "Evolution/Systems/Cce/BoundaryData.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
-#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshDerivatives.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Math.hpp"
@@ -27,11 +29,6 @@ void cartesian_spatial_metric_and_derivatives_from_unnormalized_spec_modes(
         inverse_cartesian_spatial_metric,
     const gsl::not_null<tnsr::ijj<DataVector, 3>*> d_cartesian_spatial_metric,
     const gsl::not_null<tnsr::ii<DataVector, 3>*> dt_cartesian_spatial_metric,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const gsl::not_null<Scalar<DataVector>*> radial_correction_factor,
     const tnsr::ii<ComplexModalVector, 3>& spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dr_spatial_metric_coefficients,
@@ -43,61 +40,52 @@ void cartesian_spatial_metric_and_derivatives_from_unnormalized_spec_modes(
   set_number_of_grid_points(d_cartesian_spatial_metric, size);
   set_number_of_grid_points(dt_cartesian_spatial_metric, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
   set_number_of_grid_points(radial_correction_factor, size);
 
   // Allocation
   SphericaliCartesianjj spherical_d_cartesian_spatial_metric{size};
 
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  std::array<DataVector*, 18> collocations{};
+  std::array<const ComplexModalVector*, 18> coefficients{};
+  size_t component = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // copy the modes to a spin-weighted type for interpolation
-      get(*interpolation_modal_buffer).data() =
-          spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dt_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      dt_cartesian_spatial_metric->get(i, j) =
-          real(get(*interpolation_buffer).data());
-
-      get(*interpolation_modal_buffer).data() =
-          dr_spatial_metric_coefficients.get(i, j);
-      Spectral::Swsh::inverse_swsh_transform(
-          l_max, 1, make_not_null(&get(*interpolation_buffer)),
-          get(*interpolation_modal_buffer));
-      spherical_d_cartesian_spatial_metric.get(0, i, j) =
-          real(get(*interpolation_buffer).data());
+      gsl::at(collocations, component) = &cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, component) = &spatial_metric_coefficients.get(i, j);
+      gsl::at(collocations, component + 6) =
+          &dt_cartesian_spatial_metric->get(i, j);
+      gsl::at(coefficients, component + 6) =
+          &dt_spatial_metric_coefficients.get(i, j);
+      gsl::at(collocations, component + 12) =
+          &spherical_d_cartesian_spatial_metric.get(0, i, j);
+      gsl::at(coefficients, component + 12) =
+          &dr_spatial_metric_coefficients.get(i, j);
+      ++component;
     }
   }
+  detail::batched_real_inverse_swsh_transform(collocations, coefficients,
+                                              l_max);
 
   *inverse_cartesian_spatial_metric =
       determinant_and_inverse(*cartesian_spatial_metric).second;
 
+  std::array<DataVector*, 6> theta_derivatives{};
+  std::array<DataVector*, 6> phi_derivatives{};
+  std::array<const DataVector*, 6> values{};
+  component = 0;
   for (size_t i = 0; i < 3; ++i) {
     for (size_t j = i; j < 3; ++j) {
-      // reusing the interpolation buffer for taking the angular derivatives
-      get(*interpolation_buffer) =
-          std::complex<double>(1.0, 0.0) * cartesian_spatial_metric->get(i, j);
-      Spectral::Swsh::angular_derivatives<
-          tmpl::list<Spectral::Swsh::Tags::Eth>>(
-          l_max, 1, make_not_null(&get(*eth_buffer)),
-          get(*interpolation_buffer));
-      spherical_d_cartesian_spatial_metric.get(1, i, j) =
-          -real(get(*eth_buffer).data());
-      spherical_d_cartesian_spatial_metric.get(2, i, j) =
-          -imag(get(*eth_buffer).data());
+      gsl::at(theta_derivatives, component) =
+          &spherical_d_cartesian_spatial_metric.get(1, i, j);
+      gsl::at(phi_derivatives, component) =
+          &spherical_d_cartesian_spatial_metric.get(2, i, j);
+      gsl::at(values, component) = &cartesian_spatial_metric->get(i, j);
+      ++component;
     }
   }
+  detail::batched_real_angular_derivatives(theta_derivatives, phi_derivatives,
+                                           values, l_max);
 
   get(*radial_correction_factor) = square(get<0>(unit_cartesian_coords)) *
                                    get<0, 0>(*inverse_cartesian_spatial_metric);
@@ -136,11 +124,6 @@ void cartesian_shift_and_derivatives_from_unnormalized_spec_modes(
     const gsl::not_null<tnsr::I<DataVector, 3>*> cartesian_shift,
     const gsl::not_null<tnsr::iJ<DataVector, 3>*> d_cartesian_shift,
     const gsl::not_null<tnsr::I<DataVector, 3>*> dt_cartesian_shift,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::I<ComplexModalVector, 3>& shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dr_shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dt_shift_coefficients,
@@ -152,44 +135,33 @@ void cartesian_shift_and_derivatives_from_unnormalized_spec_modes(
   set_number_of_grid_points(d_cartesian_shift, size);
   set_number_of_grid_points(dt_cartesian_shift, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
-
   // Allocation
   SphericaliCartesianJ spherical_d_cartesian_shift{size};
 
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  std::array<DataVector*, 9> collocations{};
+  std::array<const ComplexModalVector*, 9> coefficients{};
   for (size_t i = 0; i < 3; ++i) {
-    // copy the modes to a spin-weighted type for interpolation
-    get(*interpolation_modal_buffer).data() = shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dt_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    dt_cartesian_shift->get(i) = real(get(*interpolation_buffer).data());
-
-    get(*interpolation_modal_buffer).data() = dr_shift_coefficients.get(i);
-    Spectral::Swsh::inverse_swsh_transform(
-        l_max, 1, make_not_null(&get(*interpolation_buffer)),
-        get(*interpolation_modal_buffer));
-    spherical_d_cartesian_shift.get(0, i) =
-        real(get(*interpolation_buffer).data());
-  }
-
-  for (size_t i = 0; i < 3; ++i) {
-    // reusing the interpolation buffer for taking the angular derivatives
-    get(*interpolation_buffer) =
-        std::complex<double>(1.0, 0.0) * cartesian_shift->get(i);
-    Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-        l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-    spherical_d_cartesian_shift.get(1, i) = -real(get(*eth_buffer).data());
-    spherical_d_cartesian_shift.get(2, i) = -imag(get(*eth_buffer).data());
+    gsl::at(collocations, i) = &cartesian_shift->get(i);
+    gsl::at(coefficients, i) = &shift_coefficients.get(i);
+    gsl::at(collocations, i + 3) = &dt_cartesian_shift->get(i);
+    gsl::at(coefficients, i + 3) = &dt_shift_coefficients.get(i);
+    gsl::at(collocations, i + 6) = &spherical_d_cartesian_shift.get(0, i);
+    gsl::at(coefficients, i + 6) = &dr_shift_coefficients.get(i);
   }
+  detail::batched_real_inverse_swsh_transform(collocations, coefficients,
+                                              l_max);
+
+  detail::batched_real_angular_derivatives<3>(
+      {{&spherical_d_cartesian_shift.get(1, 0),
+        &spherical_d_cartesian_shift.get(1, 1),
+        &spherical_d_cartesian_shift.get(1, 2)}},
+      {{&spherical_d_cartesian_shift.get(2, 0),
+        &spherical_d_cartesian_shift.get(2, 1),
+        &spherical_d_cartesian_shift.get(2, 2)}},
+      {{&get<0>(*cartesian_shift), &get<1>(*cartesian_shift),
+        &get<2>(*cartesian_shift)}},
+      l_max);
 
   // convert derivatives to cartesian form
   for (size_t i = 0; i < 3; ++i) {
@@ -211,11 +183,6 @@ void cartesian_lapse_and_derivatives_from_unnormalized_spec_modes(
     const gsl::not_null<Scalar<DataVector>*> cartesian_lapse,
     const gsl::not_null<tnsr::i<DataVector, 3>*> d_cartesian_lapse,
     const gsl::not_null<Scalar<DataVector>*> dt_cartesian_lapse,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    const gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const Scalar<ComplexModalVector>& lapse_coefficients,
     const Scalar<ComplexModalVector>& dr_lapse_coefficients,
     const Scalar<ComplexModalVector>& dt_lapse_coefficients,
@@ -227,38 +194,20 @@ void cartesian_lapse_and_derivatives_from_unnormalized_spec_modes(
   set_number_of_grid_points(d_cartesian_lapse, size);
   set_number_of_grid_points(dt_cartesian_lapse, size);
 
-  set_number_of_grid_points(interpolation_buffer, size);
-  set_number_of_grid_points(interpolation_modal_buffer, size);
-  set_number_of_grid_points(eth_buffer, size);
-
   // Allocation
   tnsr::i<DataVector, 3> spherical_d_cartesian_lapse{size};
-  // copy the modes to a spin-weighted type for interpolation
-  get(*interpolation_modal_buffer).data() = get(lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dt_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get(*dt_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  get(*interpolation_modal_buffer).data() = get(dr_lapse_coefficients);
-  Spectral::Swsh::inverse_swsh_transform(
-      l_max, 1, make_not_null(&get(*interpolation_buffer)),
-      get(*interpolation_modal_buffer));
-  get<0>(spherical_d_cartesian_lapse) = real(get(*interpolation_buffer).data());
-
-  // reusing the interpolation buffer for taking the angular derivatives
-  get(*interpolation_buffer) =
-      std::complex<double>(1.0, 0.0) * get(*cartesian_lapse);
-  Spectral::Swsh::angular_derivatives<tmpl::list<Spectral::Swsh::Tags::Eth>>(
-      l_max, 1, make_not_null(&get(*eth_buffer)), get(*interpolation_buffer));
-  spherical_d_cartesian_lapse.get(1) = -real(get(*eth_buffer).data());
-  spherical_d_cartesian_lapse.get(2) = -imag(get(*eth_buffer).data());
+  // interpolate all of the modes to the libsharp-compatible grid at once
+  detail::batched_real_inverse_swsh_transform<3>(
+      {{&get(*cartesian_lapse), &get(*dt_cartesian_lapse),
+        &get<0>(spherical_d_cartesian_lapse)}},
+      {{&get(lapse_coefficients), &get(dt_lapse_coefficients),
+        &get(dr_lapse_coefficients)}},
+      l_max);
+
+  detail::batched_real_angular_derivatives<1>(
+      {{&get<1>(spherical_d_cartesian_lapse)}},
+      {{&get<2>(spherical_d_cartesian_lapse)}}, {{&get(*cartesian_lapse)}},
+      l_max);
 
   // convert derivatives to cartesian form
   for (size_t k = 0; k < 3; ++k) {
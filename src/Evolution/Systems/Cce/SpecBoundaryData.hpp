@@ -38,11 +38,6 @@ void cartesian_spatial_metric_and_derivatives_from_unnormalized_spec_modes(
     gsl::not_null<tnsr::II<DataVector, 3>*> inverse_cartesian_spatial_metric,
     gsl::not_null<tnsr::ijj<DataVector, 3>*> d_cartesian_spatial_metric,
     gsl::not_null<tnsr::ii<DataVector, 3>*> dt_cartesian_spatial_metric,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     gsl::not_null<Scalar<DataVector>*> radial_correction_factor,
     const tnsr::ii<ComplexModalVector, 3>& spatial_metric_coefficients,
     const tnsr::ii<ComplexModalVector, 3>& dr_spatial_metric_coefficients,
@@ -62,11 +57,6 @@ void cartesian_shift_and_derivatives_from_unnormalized_spec_modes(
     gsl::not_null<tnsr::I<DataVector, 3>*> cartesian_shift,
     gsl::not_null<tnsr::iJ<DataVector, 3>*> d_cartesian_shift,
     gsl::not_null<tnsr::I<DataVector, 3>*> dt_cartesian_shift,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const tnsr::I<ComplexModalVector, 3>& shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dr_shift_coefficients,
     const tnsr::I<ComplexModalVector, 3>& dt_shift_coefficients,
@@ -86,11 +76,6 @@ void cartesian_lapse_and_derivatives_from_unnormalized_spec_modes(
     gsl::not_null<Scalar<DataVector>*> cartesian_lapse,
     gsl::not_null<tnsr::i<DataVector, 3>*> d_cartesian_lapse,
     gsl::not_null<Scalar<DataVector>*> dt_cartesian_lapse,
-    gsl::not_null<Scalar<SpinWeighted<ComplexModalVector, 0>>*>
-        interpolation_modal_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 0>>*>
-        interpolation_buffer,
-    gsl::not_null<Scalar<SpinWeighted<ComplexDataVector, 1>>*> eth_buffer,
     const Scalar<ComplexModalVector>& lapse_coefficients,
     const Scalar<ComplexModalVector>& dr_lapse_coefficients,
     const Scalar<ComplexModalVector>& dt_lapse_coefficients,
@@ -257,15 +242,6 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
   auto& dt_cartesian_spatial_metric =
       get<::Tags::dt<gr::Tags::SpatialMetric<DataVector, 3>>>(
           computation_variables);
-  auto& interpolation_buffer =
-      get<::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
-                               std::integral_constant<int, 0>>>(
-          derivative_buffers);
-  Scalar<SpinWeighted<ComplexModalVector, 0>> interpolation_modal_buffer{size};
-  auto& eth_buffer =
-      get<::Tags::SpinWeighted<::Tags::TempScalar<0, ComplexDataVector>,
-                               std::integral_constant<int, 1>>>(
-          derivative_buffers);
   auto& radial_correction_factor =
       get<::Tags::TempScalar<0, DataVector>>(computation_variables);
   cartesian_spatial_metric_and_derivatives_from_unnormalized_spec_modes(
@@ -273,8 +249,6 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
       make_not_null(&inverse_spatial_metric),
       make_not_null(&d_cartesian_spatial_metric),
       make_not_null(&dt_cartesian_spatial_metric),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       make_not_null(&radial_correction_factor), spatial_metric_coefficients,
       dr_spatial_metric_coefficients, dt_spatial_metric_coefficients,
       inverse_cartesian_to_spherical_jacobian, cartesian_coords, l_max);
@@ -290,8 +264,6 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
   cartesian_shift_and_derivatives_from_unnormalized_spec_modes(
       make_not_null(&cartesian_shift), make_not_null(&d_cartesian_shift),
       make_not_null(&dt_cartesian_shift),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       shift_coefficients, dr_shift_coefficients, dt_shift_coefficients,
       inverse_cartesian_to_spherical_jacobian, radial_correction_factor, l_max);
 
@@ -305,8 +277,6 @@ void create_bondi_boundary_data_from_unnormalized_spec_modes(
   cartesian_lapse_and_derivatives_from_unnormalized_spec_modes(
       make_not_null(&cartesian_lapse), make_not_null(&d_cartesian_lapse),
       make_not_null(&dt_cartesian_lapse),
-      make_not_null(&interpolation_modal_buffer),
-      make_not_null(&interpolation_buffer), make_not_null(&eth_buffer),
       lapse_coefficients, dr_lapse_coefficients, dt_lapse_coefficients,
       inverse_cartesian_to_spherical_jacobian, radial_correction_factor, l_max);
 
@@ -4,10 +4,13 @@
 #include "Evolution/Systems/Cce/WorldtubeBufferUpdater.hpp"
 
 #include <algorithm>
+#include <blaze/math/Submatrix.h>
 #include <complex>
 #include <cstddef>
+#include <optional>
 #include <stdexcept>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -92,21 +95,54 @@ void set_time_buffer_and_lmax(const gsl::not_null<DataVector*> time_buffer,
       static_cast<size_t>(sqrt(static_cast<double>(l_plus_one_squared)) - 1);
 }
 
+bool buffers_need_update(const double time, const size_t time_span_end,
+                         const size_t interpolator_length,
+                         const DataVector& time_buffer) {
+  return time_span_end < time_buffer.size() and
+         (time_span_end <= interpolator_length or
+          time_buffer[time_span_end - interpolator_length] <= time);
+}
+
+Matrix read_modal_data(
+    const gsl::not_null<
+        std::optional<std::unordered_map<std::string, Matrix>>*>
+        preloaded_data,
+    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file,
+    const std::string& dataset_name, const size_t time_span_start,
+    const size_t time_span_end) {
+  const size_t number_of_rows = time_span_end - time_span_start;
+  if (not preloaded_data->has_value()) {
+    const auto& read_data = cce_data_file.get<h5::Dat>(dataset_name);
+    const size_t number_of_columns = read_data.get_dimensions()[1];
+    Matrix data_matrix = read_data.get_data_subset(
+        alg::iota(std::vector<size_t>(number_of_columns - 1), 1_st),
+        time_span_start, number_of_rows);
+    cce_data_file.close_current_object();
+    return data_matrix;
+  }
+  auto& full_data = (**preloaded_data)[dataset_name];
+  if (full_data.rows() == 0) {
+    const auto& read_data = cce_data_file.get<h5::Dat>(dataset_name);
+    const auto dimensions = read_data.get_dimensions();
+    full_data = read_data.get_data_subset(
+        alg::iota(std::vector<size_t>(dimensions[1] - 1), 1_st), 0,
+        dimensions[0]);
+    cce_data_file.close_current_object();
+  }
+  return Matrix{blaze::submatrix(full_data, time_span_start, 0, number_of_rows,
+                                 full_data.columns())};
+}
+
 void update_buffer_with_modal_data(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
-    const h5::Dat& read_data, const size_t computation_l_max,
+    const Matrix& data_matrix, const size_t computation_l_max,
     const size_t l_max, const size_t time_span_start,
     const size_t time_span_end, const bool is_real) {
-  size_t number_of_columns = read_data.get_dimensions()[1];
   if (UNLIKELY(buffer_to_update->size() !=
                square(computation_l_max + 1) *
                    (time_span_end - time_span_start))) {
     ERROR("Incorrect storage size for the data to be loaded in.");
   }
-  std::vector<size_t> cols(number_of_columns - 1);
-  std::iota(cols.begin(), cols.end(), 1);
-  Matrix data_matrix = read_data.get_data_subset(
-      cols, time_span_start, time_span_end - time_span_start);
   *buffer_to_update = 0.0;
   for (size_t time_row = 0; time_row < time_span_end - time_span_start;
        ++time_row) {
@@ -178,12 +214,15 @@ double update_buffers_for_time(
     const DataVector& time_buffer,
     const tuples::tagged_tuple_from_typelist<
         db::wrap_tags_in<Tags::detail::InputDataSet, InputTags>>& dataset_names,
-    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file) {
+    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file,
+    const gsl::not_null<
+        std::optional<std::unordered_map<std::string, Matrix>>*>
+        preloaded_data) {
   if (*time_span_end >= time_buffer.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer[*time_span_end - interpolator_length] > time) {
+  if (not buffers_need_update(time, *time_span_end, interpolator_length,
+                              time_buffer)) {
     // the next time an update will be required
     return time_buffer[*time_span_end - interpolator_length + 1];
   }
@@ -196,15 +235,16 @@ double update_buffers_for_time(
   // load the desired time spans into the buffers
   tmpl::for_each<InputTags>([&buffers, &time_span_start, &time_span_end,
                              &computation_l_max, &l_max, &cce_data_file,
-                             &dataset_names](auto tag_v) {
+                             &dataset_names, &preloaded_data](auto tag_v) {
     using tag = typename decltype(tag_v)::type;
     update_buffer_with_modal_data(
         make_not_null(&get(get<tag>(*buffers)).data()),
-        cce_data_file.get<h5::Dat>(
-            "/" + get<Tags::detail::InputDataSet<tag>>(dataset_names)),
+        read_modal_data(
+            preloaded_data, cce_data_file,
+            "/" + get<Tags::detail::InputDataSet<tag>>(dataset_names),
+            *time_span_start, *time_span_end),
         computation_l_max, l_max, *time_span_start, *time_span_end,
         tag::type::type::spin == 0);
-    cce_data_file.close_current_object();
   });
   // the next time an update will be required
   return time_buffer[std::min(*time_span_end - interpolator_length + 1,
@@ -215,8 +255,11 @@ double update_buffers_for_time(
 
 MetricWorldtubeH5BufferUpdater::MetricWorldtubeH5BufferUpdater(
     const std::string& cce_data_filename,
-    const std::optional<double> extraction_radius)
+    const std::optional<double> extraction_radius, const bool load_all_data)
     : cce_data_file_{cce_data_filename}, filename_{cce_data_filename} {
+  if (load_all_data) {
+    preloaded_data_.emplace();
+  }
   get<Tags::detail::InputDataSet<Tags::detail::SpatialMetric>>(dataset_names_) =
       "/g";
   get<Tags::detail::InputDataSet<
@@ -271,8 +314,8 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
   if (*time_span_end >= time_buffer_.size()) {
     return std::numeric_limits<double>::quiet_NaN();
   }
-  if (*time_span_end > interpolator_length and
-      time_buffer_[*time_span_end - interpolator_length] > time) {
+  if (not detail::buffers_need_update(time, *time_span_end,
+                                      interpolator_length, time_buffer_)) {
     // the next time an update will be required
     return time_buffer_[*time_span_end - interpolator_length + 1];
   }
@@ -294,11 +337,13 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
             using tag = typename decltype(tag_v)::type;
             this->update_buffer(
                 make_not_null(&get<tag>(*buffers).get(i, j)),
-                cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
-                    get<Tags::detail::InputDataSet<tag>>(dataset_names_), i,
-                    j)),
+                detail::read_modal_data(
+                    make_not_null(&preloaded_data_), cce_data_file_,
+                    detail::dataset_name_for_component(
+                        get<Tags::detail::InputDataSet<tag>>(dataset_names_),
+                        i, j),
+                    *time_span_start, *time_span_end),
                 computation_l_max, *time_span_start, *time_span_end);
-            cce_data_file_.close_current_object();
           });
     }
     // shift
@@ -310,10 +355,12 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
           using tag = typename decltype(tag_v)::type;
           this->update_buffer(
               make_not_null(&get<tag>(*buffers).get(i)),
-              cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
-                  get<Tags::detail::InputDataSet<tag>>(dataset_names_), i)),
+              detail::read_modal_data(
+                  make_not_null(&preloaded_data_), cce_data_file_,
+                  detail::dataset_name_for_component(
+                      get<Tags::detail::InputDataSet<tag>>(dataset_names_), i),
+                  *time_span_start, *time_span_end),
               computation_l_max, *time_span_start, *time_span_end);
-          cce_data_file_.close_current_object();
         });
   }
   // lapse
@@ -325,10 +372,12 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
         using tag = typename decltype(tag_v)::type;
         this->update_buffer(
             make_not_null(&get(get<tag>(*buffers))),
-            cce_data_file_.get<h5::Dat>(detail::dataset_name_for_component(
-                get<Tags::detail::InputDataSet<tag>>(dataset_names_))),
+            detail::read_modal_data(
+                make_not_null(&preloaded_data_), cce_data_file_,
+                detail::dataset_name_for_component(
+                    get<Tags::detail::InputDataSet<tag>>(dataset_names_)),
+                *time_span_start, *time_span_end),
             computation_l_max, *time_span_start, *time_span_end);
-        cce_data_file_.close_current_object();
       });
   // the next time an update will be required
   return time_buffer_[std::min(*time_span_end - interpolator_length + 1,
@@ -338,7 +387,8 @@ double MetricWorldtubeH5BufferUpdater::update_buffers_for_time(
 std::unique_ptr<WorldtubeBufferUpdater<cce_metric_input_tags>>
 MetricWorldtubeH5BufferUpdater::get_clone() const {
   return std::make_unique<MetricWorldtubeH5BufferUpdater>(
-      MetricWorldtubeH5BufferUpdater{filename_});
+      MetricWorldtubeH5BufferUpdater{filename_, extraction_radius_,
+                                     preloaded_data_.has_value()});
 }
 
 bool MetricWorldtubeH5BufferUpdater::time_is_outside_range(
@@ -353,23 +403,26 @@ void MetricWorldtubeH5BufferUpdater::pup(PUP::er& p) {
   p | l_max_;
   p | extraction_radius_;
   p | dataset_names_;
+  // The preloaded data is read from the file again when it is next needed
+  bool load_all_data = preloaded_data_.has_value();
+  p | load_all_data;
   if (p.isUnpacking()) {
     cce_data_file_ = h5::H5File<h5::AccessType::ReadOnly>{filename_};
+    preloaded_data_.reset();
+    if (load_all_data) {
+      preloaded_data_.emplace();
+    }
   }
 }
 
 void MetricWorldtubeH5BufferUpdater::update_buffer(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
-    const h5::Dat& read_data, const size_t computation_l_max,
+    const Matrix& data_matrix, const size_t computation_l_max,
     const size_t time_span_start, const size_t time_span_end) const {
-  const size_t number_of_columns = read_data.get_dimensions()[1];
   if (UNLIKELY(buffer_to_update->size() != (time_span_end - time_span_start) *
                                                square(computation_l_max + 1))) {
     ERROR("Incorrect storage size for the data to be loaded in.");
   }
-  auto cols = alg::iota(std::vector<size_t>(number_of_columns - 1), 1_st);
-  const Matrix data_matrix = read_data.get_data_subset(
-      cols, time_span_start, time_span_end - time_span_start);
 
   *buffer_to_update = 0.0;
   for (size_t time_row = 0; time_row < time_span_end - time_span_start;
@@ -397,8 +450,11 @@ void MetricWorldtubeH5BufferUpdater::update_buffer(
 
 BondiWorldtubeH5BufferUpdater::BondiWorldtubeH5BufferUpdater(
     const std::string& cce_data_filename,
-    const std::optional<double> extraction_radius)
+    const std::optional<double> extraction_radius, const bool load_all_data)
     : cce_data_file_{cce_data_filename}, filename_{cce_data_filename} {
+  if (load_all_data) {
+    preloaded_data_.emplace();
+  }
   get<Tags::detail::InputDataSet<
       Spectral::Swsh::Tags::SwshTransform<Tags::BondiBeta>>>(dataset_names_) =
       "Beta";
@@ -448,17 +504,17 @@ double BondiWorldtubeH5BufferUpdater::update_buffers_for_time(
   return detail::update_buffers_for_time<cce_bondi_input_tags>(
       buffers, time_span_start, time_span_end, time, computation_l_max, l_max_,
       interpolator_length, buffer_depth, time_buffer_, dataset_names_,
-      cce_data_file_);
+      cce_data_file_, make_not_null(&preloaded_data_));
 }
 
 void BondiWorldtubeH5BufferUpdater::update_buffer(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
-    const h5::Dat& read_data, const size_t computation_l_max,
+    const Matrix& data_matrix, const size_t computation_l_max,
     const size_t time_span_start, const size_t time_span_end,
     const bool is_real) const {
   detail::update_buffer_with_modal_data(
-      buffer_to_update, read_data, computation_l_max, l_max_, time_span_start,
-      time_span_end, is_real);
+      buffer_to_update, data_matrix, computation_l_max, l_max_,
+      time_span_start, time_span_end, is_real);
 }
 
 void BondiWorldtubeH5BufferUpdater::pup(PUP::er& p) {
@@ -467,15 +523,25 @@ void BondiWorldtubeH5BufferUpdater::pup(PUP::er& p) {
   p | l_max_;
   p | extraction_radius_;
   p | dataset_names_;
+  // The preloaded data is read from the file again when it is next needed
+  bool load_all_data = preloaded_data_.has_value();
+  p | load_all_data;
   if (p.isUnpacking()) {
     cce_data_file_ = h5::H5File<h5::AccessType::ReadOnly>{filename_};
+    preloaded_data_.reset();
+    if (load_all_data) {
+      preloaded_data_.emplace();
+    }
   }
 }
 
 KleinGordonWorldtubeH5BufferUpdater::KleinGordonWorldtubeH5BufferUpdater(
     const std::string& cce_data_filename,
-    const std::optional<double> extraction_radius)
+    const std::optional<double> extraction_radius, const bool load_all_data)
     : cce_data_file_{cce_data_filename}, filename_{cce_data_filename} {
+  if (load_all_data) {
+    preloaded_data_.emplace();
+  }
   get<Tags::detail::InputDataSet<
       Spectral::Swsh::Tags::SwshTransform<Tags::KleinGordonPsi>>>(
       dataset_names_) = "KGPsi";
@@ -509,17 +575,17 @@ double KleinGordonWorldtubeH5BufferUpdater::update_buffers_for_time(
   return detail::update_buffers_for_time<klein_gordon_input_tags>(
       buffers, time_span_start, time_span_end, time, computation_l_max, l_max_,
       interpolator_length, buffer_depth, time_buffer_, dataset_names_,
-      cce_data_file_);
+      cce_data_file_, make_not_null(&preloaded_data_));
 }
 
 void KleinGordonWorldtubeH5BufferUpdater::update_buffer(
     const gsl::not_null<ComplexModalVector*> buffer_to_update,
-    const h5::Dat& read_data, const size_t computation_l_max,
+    const Matrix& data_matrix, const size_t computation_l_max,
     const size_t time_span_start, const size_t time_span_end) const {
   // We assume the scalar field is real-valued
   detail::update_buffer_with_modal_data(
-      buffer_to_update, read_data, computation_l_max, l_max_, time_span_start,
-      time_span_end, true);
+      buffer_to_update, data_matrix, computation_l_max, l_max_,
+      time_span_start, time_span_end, true);
 }
 
 void KleinGordonWorldtubeH5BufferUpdater::pup(PUP::er& p) {
@@ -528,8 +594,15 @@ void KleinGordonWorldtubeH5BufferUpdater::pup(PUP::er& p) {
   p | l_max_;
   p | extraction_radius_;
   p | dataset_names_;
+  // The preloaded data is read from the file again when it is next needed
+  bool load_all_data = preloaded_data_.has_value();
+  p | load_all_data;
   if (p.isUnpacking()) {
     cce_data_file_ = h5::H5File<h5::AccessType::ReadOnly>{filename_};
+    preloaded_data_.reset();
+    if (load_all_data) {
+      preloaded_data_.emplace();
+    }
   }
 }
 
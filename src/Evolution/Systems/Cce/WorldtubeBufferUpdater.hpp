@@ -7,6 +7,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <unordered_map>
 #include <utility>
 
 #include "DataStructures/ComplexModalVector.hpp"
@@ -92,10 +93,27 @@ std::string get_text_radius(const std::string& cce_data_filename);
 void set_time_buffer_and_lmax(gsl::not_null<DataVector*> time_buffer,
                               size_t& l_max, const h5::Dat& data);
 
+// returns whether the buffers ending at `time_span_end` must be updated to
+// provide data at `time`. This is `false` if no further data is available.
+bool buffers_need_update(double time, size_t time_span_end,
+                         size_t interpolator_length,
+                         const DataVector& time_buffer);
+
+// retrieves the modal data (every column except the time) in the rows
+// `[time_span_start, time_span_end)` of the dataset `dataset_name`. If
+// `preloaded_data` holds a value, the full dataset is read into it the first
+// time it is requested, and all later requests are served from memory.
+Matrix read_modal_data(
+    gsl::not_null<std::optional<std::unordered_map<std::string, Matrix>>*>
+        preloaded_data,
+    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file,
+    const std::string& dataset_name, size_t time_span_start,
+    size_t time_span_end);
+
 // retrieves modal data from Bondi or Klein-Gordon worldtube H5 file.
 void update_buffer_with_modal_data(
     gsl::not_null<ComplexModalVector*> buffer_to_update,
-    const h5::Dat& read_data, size_t computation_l_max, size_t l_max,
+    const Matrix& data_matrix, size_t computation_l_max, size_t l_max,
     size_t time_span_start, size_t time_span_end, bool is_real);
 
 // updates `time_span_start` and `time_span_end` based on the provided `time`,
@@ -110,7 +128,9 @@ double update_buffers_for_time(
     const DataVector& time_buffer,
     const tuples::tagged_tuple_from_typelist<
         db::wrap_tags_in<Tags::detail::InputDataSet, InputTags>>& dataset_names,
-    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file);
+    const h5::H5File<h5::AccessType::ReadOnly>& cce_data_file,
+    gsl::not_null<std::optional<std::unordered_map<std::string, Matrix>>*>
+        preloaded_data);
 }  // namespace detail
 
 /// the full set of tensors to be extracted from the worldtube h5 file
@@ -215,10 +235,13 @@ class MetricWorldtubeH5BufferUpdater
   /// The constructor takes the filename of the SpEC h5 file that will be used
   /// for boundary data. The extraction radius can either be passed in directly,
   /// or if it takes the value `std::nullopt`, then the extraction radius is
-  /// retrieved as an integer in the filename.
+  /// retrieved as an integer in the filename. If `load_all_data` is `true`,
+  /// each dataset is read into memory in full the first time it is needed, so
+  /// later buffer updates do not access the file.
   explicit MetricWorldtubeH5BufferUpdater(
       const std::string& cce_data_filename,
-      std::optional<double> extraction_radius = std::nullopt);
+      std::optional<double> extraction_radius = std::nullopt,
+      bool load_all_data = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeH5BufferUpdater);  // NOLINT
 
@@ -266,7 +289,7 @@ class MetricWorldtubeH5BufferUpdater
 
  private:
   void update_buffer(gsl::not_null<ComplexModalVector*> buffer_to_update,
-                     const h5::Dat& read_data, size_t computation_l_max,
+                     const Matrix& data_matrix, size_t computation_l_max,
                      size_t time_span_start, size_t time_span_end) const;
 
   bool has_version_history_ = true;
@@ -282,6 +305,11 @@ class MetricWorldtubeH5BufferUpdater
 
   // stores all the times in the input file
   DataVector time_buffer_;
+
+  // the full datasets, if all data is loaded into memory
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::optional<std::unordered_map<std::string, Matrix>>
+      preloaded_data_;
 };
 
 /// A `WorldtubeBufferUpdater` specialized to the CCE input worldtube H5 file
@@ -295,10 +323,13 @@ class BondiWorldtubeH5BufferUpdater
   /// The constructor takes the filename of the SpEC h5 file that will be used
   /// for boundary data. The extraction radius can either be passed in directly,
   /// or if it takes the value `std::nullopt`, then the extraction radius is
-  /// retrieved as an integer in the filename.
+  /// retrieved as an integer in the filename. If `load_all_data` is `true`,
+  /// each dataset is read into memory in full the first time it is needed, so
+  /// later buffer updates do not access the file.
   explicit BondiWorldtubeH5BufferUpdater(
       const std::string& cce_data_filename,
-      std::optional<double> extraction_radius = std::nullopt);
+      std::optional<double> extraction_radius = std::nullopt,
+      bool load_all_data = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeH5BufferUpdater);  // NOLINT
 
@@ -316,7 +347,8 @@ class BondiWorldtubeH5BufferUpdater
 
   std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>> get_clone()
       const override {
-    return std::make_unique<BondiWorldtubeH5BufferUpdater>(filename_);
+    return std::make_unique<BondiWorldtubeH5BufferUpdater>(
+        filename_, extraction_radius_, preloaded_data_.has_value());
   }
 
   /// The time can only be supported in the buffer update if it is between the
@@ -357,7 +389,7 @@ class BondiWorldtubeH5BufferUpdater
 
  private:
   void update_buffer(gsl::not_null<ComplexModalVector*> buffer_to_update,
-                     const h5::Dat& read_data, size_t computation_l_max,
+                     const Matrix& data_matrix, size_t computation_l_max,
                      size_t time_span_start, size_t time_span_end,
                      bool is_real) const;
 
@@ -373,6 +405,11 @@ class BondiWorldtubeH5BufferUpdater
 
   // stores all the times in the input file
   DataVector time_buffer_;
+
+  // the full datasets, if all data is loaded into memory
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::optional<std::unordered_map<std::string, Matrix>>
+      preloaded_data_;
 };
 
 /// A `WorldtubeBufferUpdater` specialized to the Klein-Gordon input worldtube
@@ -387,10 +424,13 @@ class KleinGordonWorldtubeH5BufferUpdater
   /// The constructor takes the filename of the SpEC h5 file that will be used
   /// for boundary data. The extraction radius can either be passed in directly,
   /// or if it takes the value `std::nullopt`, then the extraction radius is
-  /// retrieved as an integer in the filename.
+  /// retrieved as an integer in the filename. If `load_all_data` is `true`,
+  /// each dataset is read into memory in full the first time it is needed, so
+  /// later buffer updates do not access the file.
   explicit KleinGordonWorldtubeH5BufferUpdater(
       const std::string& cce_data_filename,
-      std::optional<double> extraction_radius = std::nullopt);
+      std::optional<double> extraction_radius = std::nullopt,
+      bool load_all_data = false);
 
   WRAPPED_PUPable_decl_template(KleinGordonWorldtubeH5BufferUpdater);  // NOLINT
 
@@ -408,7 +448,8 @@ class KleinGordonWorldtubeH5BufferUpdater
 
   std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>> get_clone()
       const override {
-    return std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(filename_);
+    return std::make_unique<KleinGordonWorldtubeH5BufferUpdater>(
+        filename_, extraction_radius_, preloaded_data_.has_value());
   }
 
   /// The time can only be supported in the buffer update if it is between the
@@ -450,7 +491,7 @@ class KleinGordonWorldtubeH5BufferUpdater
  private:
   // The scalar field is assumed to be real-valued.
   void update_buffer(gsl::not_null<ComplexModalVector*> buffer_to_update,
-                     const h5::Dat& read_data, size_t computation_l_max,
+                     const Matrix& data_matrix, size_t computation_l_max,
                      size_t time_span_start, size_t time_span_end) const;
 
   std::optional<double> extraction_radius_ = std::nullopt;
@@ -465,5 +506,10 @@ class KleinGordonWorldtubeH5BufferUpdater
 
   // stores all the times in the input file
   DataVector time_buffer_;
+
+  // the full datasets, if all data is loaded into memory
+  // NOLINTNEXTLINE(spectre-mutable)
+  mutable std::optional<std::unordered_map<std::string, Matrix>>
+      preloaded_data_;
 };
 }  // namespace Cce
@@ -5,6 +5,7 @@
 
 #include <complex>
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <mutex>
 #include <utility>
@@ -27,6 +28,102 @@
 namespace Cce {
 
 namespace detail {
+template <typename InputTags>
+WorldtubeDataPrefetcher<InputTags>::WorldtubeDataPrefetcher(
+    std::unique_ptr<WorldtubeBufferUpdater<InputTags>> buffer_updater)
+    : buffer_updater_{std::move(buffer_updater)} {}
+
+template <typename InputTags>
+WorldtubeDataPrefetcher<InputTags>::~WorldtubeDataPrefetcher() {
+  wait();
+}
+
+template <typename InputTags>
+void WorldtubeDataPrefetcher<InputTags>::update_buffers_for_time(
+    const gsl::not_null<Variables<InputTags>*> coefficients_buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock,
+    const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const size_t l_max, const size_t interpolator_length,
+    const size_t buffer_depth) {
+  const DataVector& time_buffer = buffer_updater->get_time_buffer();
+  if (not buffers_need_update(time, *time_span_end, interpolator_length,
+                              time_buffer)) {
+    return;
+  }
+  wait();
+  if (time_span_end_ != 0 and
+      std::make_pair(time_span_start_, time_span_end_) ==
+          create_span_for_time_value(time, buffer_depth, interpolator_length,
+                                     0, time_buffer.size(), time_buffer)) {
+    std::swap(*coefficients_buffers, buffers_);
+    *time_span_start = time_span_start_;
+    *time_span_end = time_span_end_;
+  } else {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    buffer_updater->update_buffers_for_time(
+        coefficients_buffers, time_span_start, time_span_end, time, l_max,
+        interpolator_length, buffer_depth);
+  }
+  time_span_start_ = 0;
+  time_span_end_ = 0;
+  if (*time_span_end >= time_buffer.size()) {
+    return;
+  }
+
+  // The next update happens once the time passes
+  // `time_buffer[*time_span_end - interpolator_length]`, and for a time
+  // between that point and the next one it loads the same span as for this
+  // time.
+  const double next_update_time =
+      time_buffer[*time_span_end - interpolator_length + 1];
+  if (buffers_.number_of_grid_points() !=
+      coefficients_buffers->number_of_grid_points()) {
+    buffers_.initialize(coefficients_buffers->number_of_grid_points());
+  }
+  pending_read_ =
+      std::async(std::launch::async, [this, hdf5_lock, next_update_time, l_max,
+                                      interpolator_length, buffer_depth]() {
+        const std::lock_guard hold_lock(*hdf5_lock);
+        buffer_updater_->update_buffers_for_time(
+            make_not_null(&buffers_), make_not_null(&time_span_start_),
+            make_not_null(&time_span_end_), next_update_time, l_max,
+            interpolator_length, buffer_depth);
+      });
+}
+
+template <typename InputTags>
+void WorldtubeDataPrefetcher<InputTags>::wait() {
+  if (pending_read_.valid()) {
+    pending_read_.get();
+  }
+}
+
+// updates the buffers using the `prefetcher` if there is one, and directly
+// from the `buffer_updater` otherwise
+template <typename InputTags>
+void update_coefficients_buffers(
+    const gsl::not_null<Variables<InputTags>*> coefficients_buffers,
+    const gsl::not_null<size_t*> time_span_start,
+    const gsl::not_null<size_t*> time_span_end, const double time,
+    const gsl::not_null<Parallel::NodeLock*> hdf5_lock,
+    const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+    const std::unique_ptr<WorldtubeDataPrefetcher<InputTags>>& prefetcher,
+    const size_t l_max, const size_t interpolator_length,
+    const size_t buffer_depth) {
+  if (prefetcher != nullptr) {
+    prefetcher->update_buffers_for_time(
+        coefficients_buffers, time_span_start, time_span_end, time, hdf5_lock,
+        buffer_updater, l_max, interpolator_length, buffer_depth);
+  } else {
+    const std::lock_guard hold_lock(*hdf5_lock);
+    buffer_updater->update_buffers_for_time(
+        coefficients_buffers, time_span_start, time_span_end, time, l_max,
+        interpolator_length, buffer_depth);
+  }
+}
+
 template <typename InputTags>
 void set_non_pupped_members(
     const gsl::not_null<size_t*> time_span_start,
@@ -82,14 +179,12 @@ void populate_hypersurface_boundary_data(
     const gsl::not_null<Parallel::NodeLock*> hdf5_lock, const double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
-    const size_t l_max, const size_t buffer_depth) {
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater->update_buffers_for_time(
-        coefficients_buffers, time_span_start, time_span_end, time, l_max,
-        interpolator->required_number_of_points_before_and_after(),
-        buffer_depth);
-  }
+    const size_t l_max, const size_t buffer_depth,
+    const std::unique_ptr<WorldtubeDataPrefetcher<InputTags>>& prefetcher) {
+  update_coefficients_buffers(
+      coefficients_buffers, time_span_start, time_span_end, time, hdf5_lock,
+      buffer_updater, prefetcher, l_max,
+      interpolator->required_number_of_points_before_and_after(), buffer_depth);
 
   auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator->required_number_of_points_before_and_after(),
@@ -166,7 +261,7 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
     std::unique_ptr<intrp::SpanInterpolator> interpolator,
-    const bool fix_spec_normalization)
+    const bool fix_spec_normalization, const bool prefetch_data)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       fix_spec_normalization_{fix_spec_normalization},
@@ -178,6 +273,11 @@ MetricWorldtubeDataManager::MetricWorldtubeDataManager(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
       interpolator_->required_number_of_points_before_and_after(), l_max);
+  if (prefetch_data) {
+    prefetcher_ = std::make_unique<
+        detail::WorldtubeDataPrefetcher<cce_metric_input_tags>>(
+        buffer_updater_->get_clone());
+  }
 }
 
 bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
@@ -189,14 +289,12 @@ bool MetricWorldtubeDataManager::populate_hypersurface_boundary_data(
   if (buffer_updater_->time_is_outside_range(time)) {
     return false;
   }
-  {
-    const std::lock_guard hold_lock(*hdf5_lock);
-    buffer_updater_->update_buffers_for_time(
-        make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
-        make_not_null(&time_span_end_), time, l_max_,
-        interpolator_->required_number_of_points_before_and_after(),
-        buffer_depth_);
-  }
+  detail::update_coefficients_buffers(
+      make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
+      make_not_null(&time_span_end_), time, hdf5_lock, buffer_updater_,
+      prefetcher_, l_max_,
+      interpolator_->required_number_of_points_before_and_after(),
+      buffer_depth_);
   const auto interpolation_time_span = detail::create_span_for_time_value(
       time, 0, interpolator_->required_number_of_points_before_and_after(),
       time_span_start_, time_span_end_, buffer_updater_->get_time_buffer());
@@ -351,7 +449,8 @@ std::unique_ptr<WorldtubeDataManager<
 MetricWorldtubeDataManager::get_clone() const {
   return std::make_unique<MetricWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone(), fix_spec_normalization_);
+      interpolator_->get_clone(), fix_spec_normalization_,
+      prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> MetricWorldtubeDataManager::get_time_span() const {
@@ -366,12 +465,20 @@ void MetricWorldtubeDataManager::pup(PUP::er& p) {
   p | buffer_depth_;
   p | interpolator_;
   p | fix_spec_normalization_;
+  bool prefetch_data = prefetcher_ != nullptr;
+  p | prefetch_data;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<cce_metric_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    prefetcher_.reset();
+    if (prefetch_data) {
+      prefetcher_ = std::make_unique<
+          detail::WorldtubeDataPrefetcher<cce_metric_input_tags>>(
+          buffer_updater_->get_clone());
+    }
   }
 }
 
@@ -379,7 +486,8 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_data)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
@@ -390,6 +498,11 @@ BondiWorldtubeDataManager::BondiWorldtubeDataManager(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
       interpolator_->required_number_of_points_before_and_after(), l_max);
+  if (prefetch_data) {
+    prefetcher_ = std::make_unique<
+        detail::WorldtubeDataPrefetcher<cce_bondi_input_tags>>(
+        buffer_updater_->get_clone());
+  }
 }
 
 bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
@@ -408,7 +521,7 @@ bool BondiWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, l_max_, buffer_depth_, prefetcher_);
 
   const auto& du_r = get(get<Tags::BoundaryValue<Tags::Du<Tags::BondiR>>>(
       *boundary_data_variables));
@@ -447,7 +560,7 @@ std::unique_ptr<WorldtubeDataManager<
 BondiWorldtubeDataManager::get_clone() const {
   return std::make_unique<BondiWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> BondiWorldtubeDataManager::get_time_span() const {
@@ -461,12 +574,20 @@ void BondiWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  bool prefetch_data = prefetcher_ != nullptr;
+  p | prefetch_data;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<cce_bondi_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    prefetcher_.reset();
+    if (prefetch_data) {
+      prefetcher_ = std::make_unique<
+          detail::WorldtubeDataPrefetcher<cce_bondi_input_tags>>(
+          buffer_updater_->get_clone());
+    }
   }
 }
 
@@ -474,7 +595,8 @@ KleinGordonWorldtubeDataManager::KleinGordonWorldtubeDataManager(
     std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
         buffer_updater,
     const size_t l_max, const size_t buffer_depth,
-    std::unique_ptr<intrp::SpanInterpolator> interpolator)
+    std::unique_ptr<intrp::SpanInterpolator> interpolator,
+    const bool prefetch_data)
     : buffer_updater_{std::move(buffer_updater)},
       l_max_{l_max},
       interpolated_coefficients_{
@@ -485,6 +607,11 @@ KleinGordonWorldtubeDataManager::KleinGordonWorldtubeDataManager(
       make_not_null(&buffer_depth_), make_not_null(&coefficients_buffers_),
       buffer_updater_->get_time_buffer().size(),
       interpolator_->required_number_of_points_before_and_after(), l_max);
+  if (prefetch_data) {
+    prefetcher_ = std::make_unique<
+        detail::WorldtubeDataPrefetcher<klein_gordon_input_tags>>(
+        buffer_updater_->get_clone());
+  }
 }
 
 bool KleinGordonWorldtubeDataManager::populate_hypersurface_boundary_data(
@@ -501,7 +628,7 @@ bool KleinGordonWorldtubeDataManager::populate_hypersurface_boundary_data(
       boundary_data_variables, make_not_null(&interpolated_coefficients_),
       make_not_null(&coefficients_buffers_), make_not_null(&time_span_start_),
       make_not_null(&time_span_end_), hdf5_lock, time, interpolator_,
-      buffer_updater_, l_max_, buffer_depth_);
+      buffer_updater_, l_max_, buffer_depth_, prefetcher_);
 
   return true;
 }
@@ -511,7 +638,7 @@ std::unique_ptr<
 KleinGordonWorldtubeDataManager::get_clone() const {
   return std::make_unique<KleinGordonWorldtubeDataManager>(
       buffer_updater_->get_clone(), l_max_, buffer_depth_,
-      interpolator_->get_clone());
+      interpolator_->get_clone(), prefetcher_ != nullptr);
 }
 
 std::pair<size_t, size_t> KleinGordonWorldtubeDataManager::get_time_span()
@@ -526,15 +653,27 @@ void KleinGordonWorldtubeDataManager::pup(PUP::er& p) {
   p | l_max_;
   p | buffer_depth_;
   p | interpolator_;
+  bool prefetch_data = prefetcher_ != nullptr;
+  p | prefetch_data;
   if (p.isUnpacking()) {
     detail::set_non_pupped_members<klein_gordon_input_tags>(
         make_not_null(&time_span_start_), make_not_null(&time_span_end_),
         make_not_null(&coefficients_buffers_),
         make_not_null(&interpolated_coefficients_), buffer_depth_,
         interpolator_->required_number_of_points_before_and_after(), l_max_);
+    prefetcher_.reset();
+    if (prefetch_data) {
+      prefetcher_ = std::make_unique<
+          detail::WorldtubeDataPrefetcher<klein_gordon_input_tags>>(
+          buffer_updater_->get_clone());
+    }
   }
 }
 
+template class detail::WorldtubeDataPrefetcher<cce_metric_input_tags>;
+template class detail::WorldtubeDataPrefetcher<cce_bondi_input_tags>;
+template class detail::WorldtubeDataPrefetcher<klein_gordon_input_tags>;
+
 PUP::able::PUP_ID MetricWorldtubeDataManager::my_PUP_ID = 0;
 PUP::able::PUP_ID BondiWorldtubeDataManager::my_PUP_ID = 0;
 PUP::able::PUP_ID KleinGordonWorldtubeDataManager::my_PUP_ID = 0;  // NOLINT
@@ -5,6 +5,7 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <future>
 #include <memory>
 #include <utility>
 
@@ -21,6 +22,49 @@
 namespace Cce {
 
 namespace detail {
+/*
+ * Reads the worldtube data needed for the next buffer update on a background
+ * thread while the current buffers are used, using a clone of the buffer
+ * updater so that the reads never touch the updater used by the manager.
+ *
+ * `update_buffers_for_time` performs the same update as
+ * `WorldtubeBufferUpdater::update_buffers_for_time`. When an update is needed
+ * and the data read in the background is exactly the span that update would
+ * load, the prefetched buffers are swapped in; otherwise the data is read
+ * synchronously. Either way, a read of the span for the following update is
+ * then started. The background thread holds `hdf5_lock` while reading, so the
+ * lock must outlive the prefetcher.
+ */
+template <typename InputTags>
+class WorldtubeDataPrefetcher {
+ public:
+  explicit WorldtubeDataPrefetcher(
+      std::unique_ptr<WorldtubeBufferUpdater<InputTags>> buffer_updater);
+
+  WorldtubeDataPrefetcher(const WorldtubeDataPrefetcher&) = delete;
+  WorldtubeDataPrefetcher& operator=(const WorldtubeDataPrefetcher&) = delete;
+  WorldtubeDataPrefetcher(WorldtubeDataPrefetcher&&) = delete;
+  WorldtubeDataPrefetcher& operator=(WorldtubeDataPrefetcher&&) = delete;
+  ~WorldtubeDataPrefetcher();
+
+  void update_buffers_for_time(
+      gsl::not_null<Variables<InputTags>*> coefficients_buffers,
+      gsl::not_null<size_t*> time_span_start,
+      gsl::not_null<size_t*> time_span_end, double time,
+      gsl::not_null<Parallel::NodeLock*> hdf5_lock,
+      const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
+      size_t l_max, size_t interpolator_length, size_t buffer_depth);
+
+  // Blocks until the background read, if any, is finished
+  void wait();
+
+ private:
+  std::unique_ptr<WorldtubeBufferUpdater<InputTags>> buffer_updater_;
+  std::future<void> pending_read_{};
+  Variables<InputTags> buffers_{};
+  size_t time_span_start_ = 0;
+  size_t time_span_end_ = 0;
+};
 
 template <typename InputTags>
 void set_non_pupped_members(
@@ -46,7 +90,8 @@ void populate_hypersurface_boundary_data(
     gsl::not_null<Parallel::NodeLock*> hdf5_lock, double time,
     const std::unique_ptr<intrp::SpanInterpolator>& interpolator,
     const std::unique_ptr<WorldtubeBufferUpdater<InputTags>>& buffer_updater,
-    size_t l_max, size_t buffer_depth);
+    size_t l_max, size_t buffer_depth,
+    const std::unique_ptr<WorldtubeDataPrefetcher<InputTags>>& prefetcher);
 }  // namespace detail
 
 /// \cond
@@ -107,6 +152,9 @@ class WorldtubeDataManager : public PUP::able {
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_data` is `true`, the data for the next buffer update is read on
+ * a background thread while the current buffer is in use, so the evolution
+ * does not wait for the file system.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation.
@@ -123,7 +171,8 @@ class MetricWorldtubeDataManager
           buffer_updater,
       size_t l_max, size_t buffer_depth,
       std::unique_ptr<intrp::SpanInterpolator> interpolator,
-      bool fix_spec_normalization);
+      bool fix_spec_normalization,
+      bool prefetch_data = false);
 
   WRAPPED_PUPable_decl_template(MetricWorldtubeDataManager);  // NOLINT
 
@@ -187,6 +236,10 @@ class MetricWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // only set if the data is prefetched
+  std::unique_ptr<detail::WorldtubeDataPrefetcher<cce_metric_input_tags>>
+      prefetcher_;
 };
 
 /*!
@@ -198,6 +251,8 @@ class MetricWorldtubeDataManager
  * the `Interpolator` and the `buffer_depth` also passed to the constructor. A
  * longer depth will ensure that the buffer updater is called less frequently,
  * which is useful for slow updaters (e.g. those that perform file access).
+ * If `prefetch_data` is `true`, the data for the next buffer update is read on
+ * a background thread while the current buffer is in use.
  * The main functionality is provided by the
  * `WorldtubeDataManager::populate_hypersurface_boundary_data()` member
  * function that handles buffer updating and boundary computation. This version
@@ -217,7 +272,8 @@ class BondiWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<cce_bondi_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_data = false);
 
   WRAPPED_PUPable_decl_template(BondiWorldtubeDataManager);  // NOLINT
 
@@ -278,6 +334,10 @@ class BondiWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // only set if the data is prefetched
+  std::unique_ptr<detail::WorldtubeDataPrefetcher<cce_bondi_input_tags>>
+      prefetcher_;
 };
 
 class KleinGordonWorldtubeDataManager
@@ -290,7 +350,8 @@ class KleinGordonWorldtubeDataManager
       std::unique_ptr<WorldtubeBufferUpdater<klein_gordon_input_tags>>
           buffer_updater,
       size_t l_max, size_t buffer_depth,
-      std::unique_ptr<intrp::SpanInterpolator> interpolator);
+      std::unique_ptr<intrp::SpanInterpolator> interpolator,
+      bool prefetch_data = false);
 
   WRAPPED_PUPable_decl_template(KleinGordonWorldtubeDataManager);  // NOLINT
 
@@ -349,5 +410,9 @@ class KleinGordonWorldtubeDataManager
   size_t buffer_depth_ = 0;
 
   std::unique_ptr<intrp::SpanInterpolator> interpolator_;
+
+  // only set if the data is prefetched
+  std::unique_ptr<detail::WorldtubeDataPrefetcher<klein_gordon_input_tags>>
+      prefetcher_;
 };
 }  // namespace Cce
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <array>
 #include <cstddef>
 #include <limits>
 #include <optional>
 #include <string>
+#include <type_traits>
+#include <utility>
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveRecoveryData.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 /// \cond
 namespace EquationsOfState {
@@ -49,9 +53,23 @@ namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
  * of the spatial metric \f$\gamma_{kl}\f$.
  *
  * \note This scheme does not use the initial guess for the pressure.
+ *
+ * `apply_simd` recovers the primitives at `simd_width` points at once by
+ * solving for the root of the master function at all points in lockstep, with
+ * the points that have converged masked out of the root find. The equation of
+ * state is evaluated one point at a time. Points that need the bounds of the
+ * equation of state to be imposed on the root bracket (the corner case in
+ * Appendix A of \cite Kastaun2020uxr) or that have non-finite input are
+ * recovered with `apply`, so `apply_simd` returns the same as calling `apply`
+ * at each point, up to roundoff.
  */
 class KastaunEtAl {
  public:
+  /// The SIMD batch of `double`s used by `apply_simd`
+  using simd_type = std::decay_t<decltype(simd::load_unaligned(
+      std::declval<const double*>()))>;
+  static constexpr size_t simd_width = simd::size<simd_type>();
+
   template <bool EnforcePhysicality, typename EosType>
   static std::optional<PrimitiveRecoveryData> apply(
       double initial_guess_pressure, double tau,
@@ -62,6 +80,19 @@ class KastaunEtAl {
       const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
           primitive_from_conservative_options);
 
+  /// Recover the primitives at the `simd_width` points starting at each of the
+  /// pointers. At points where the recovery fails the result is
+  /// `std::nullopt`.
+  template <bool EnforcePhysicality, typename EosType>
+  static std::array<std::optional<PrimitiveRecoveryData>, simd_width>
+  apply_simd(const double* tau, const double* momentum_density_squared,
+             const double* momentum_density_dot_magnetic_field,
+             const double* magnetic_field_squared,
+             const double* rest_mass_density_times_lorentz_factor,
+             const double* electron_fraction, const EosType& equation_of_state,
+             const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+                 primitive_from_conservative_options);
+
   static const std::string name() { return "KastaunEtAl"; }
 
  private:
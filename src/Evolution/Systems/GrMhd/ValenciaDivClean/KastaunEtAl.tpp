@@ -5,6 +5,8 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <exception>
 #include <limits>
@@ -19,25 +21,25 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes {
 
 namespace KastaunEtAl_detail {
 // GCC warns without forward decls
-double compute_x(double mu, double b_squared);
-double compute_r_bar_squared(double mu, double x, double r_squared,
-                             double r_dot_b_squared);
 double compute_v_0_squared(double r_squared, double h_0, double lorentz_max);
 
 // Equation (26)
-double compute_x(const double mu, const double b_squared) {
+template <typename T>
+T compute_x(const T& mu, const T& b_squared) {
   return 1.0 / (1.0 + mu * b_squared);
 }
 
 // Equation (38)
-double compute_r_bar_squared(const double mu, const double x,
-                             const double r_squared,
-                             const double r_dot_b_squared) {
+template <typename T>
+T compute_r_bar_squared(const T& mu, const T& x, const T& r_squared,
+                        const T& r_dot_b_squared) {
   return x * (r_squared * x + mu * (1.0 + x) * r_dot_b_squared);
 }
 
@@ -89,28 +91,29 @@ class CornerCaseFunction {
 };
 
 // Function whose root is upper bracket of master function, see Sec. II.F
+template <typename T>
 class AuxiliaryFunction {
  public:
-  AuxiliaryFunction(const double h_0, const double r_squared,
-                    const double b_squared, const double r_dot_b_squared)
+  AuxiliaryFunction(const T& h_0, const T& r_squared, const T& b_squared,
+                    const T& r_dot_b_squared)
       : h_0_(h_0),
         r_squared_(r_squared),
         b_squared_(b_squared),
         r_dot_b_squared_(r_dot_b_squared) {}
 
-  double operator()(double mu) const {
-    const double x = compute_x(mu, b_squared_);
-    const double r_bar_squared =
+  T operator()(const T& mu) const {
+    const T x = compute_x(mu, b_squared_);
+    const T r_bar_squared =
         compute_r_bar_squared(mu, x, r_squared_, r_dot_b_squared_);
     // Equation (49)
     return mu * sqrt(square(h_0_) + r_bar_squared) - 1.0;
   }
 
  private:
-  const double h_0_;
-  const double r_squared_;
-  const double b_squared_;
-  const double r_dot_b_squared_;
+  const T h_0_;
+  const T r_squared_;
+  const T b_squared_;
+  const T r_dot_b_squared_;
 };
 
 // Master function, see Equation (44) in Sec. II.E
@@ -336,6 +339,247 @@ double FunctionOfMu<EnforcePhysicality, EosType>::operator()(
   // Equations (44) - (45)
   return mu - 1.0 / (nu_hat + mu * r_bar_squared);
 }
+
+// Loads the values in `values` into a SIMD batch
+template <size_t Width>
+KastaunEtAl::simd_type load_batch(const std::array<double, Width>& values) {
+  return simd::load_unaligned(values.data());
+}
+
+// Stores the values in a SIMD batch so the lanes can be accessed one at a time
+inline std::array<double, KastaunEtAl::simd_width> store_batch(
+    const KastaunEtAl::simd_type& batch) {
+  std::array<double, KastaunEtAl::simd_width> result{};
+  simd::store_unaligned(result.data(), batch);
+  return result;
+}
+
+template <typename T>
+struct PrimitivesSimd {
+  T rest_mass_density;
+  T lorentz_factor;
+  T pressure;
+  T specific_internal_energy;
+  T q_bar;
+  T r_bar_squared;
+};
+
+// Master function of FunctionOfMu evaluated on `simd_width` points at once.
+// The EOS is evaluated one point at a time.
+template <bool EnforcePhysicality, typename EosType>
+class FunctionOfMuSimd {
+ public:
+  using T = KastaunEtAl::simd_type;
+  using Mask = simd::mask_type_t<T>;
+  static constexpr size_t width = KastaunEtAl::simd_width;
+
+  FunctionOfMuSimd(const T& tau, const T& momentum_density_squared,
+                   const T& momentum_density_dot_magnetic_field,
+                   const T& magnetic_field_squared,
+                   const T& rest_mass_density_times_lorentz_factor,
+                   const std::array<double, width>& electron_fraction,
+                   const EosType& equation_of_state, const double lorentz_max)
+      : r_squared_(momentum_density_squared /
+                   square(rest_mass_density_times_lorentz_factor)),
+        b_squared_(magnetic_field_squared /
+                   rest_mass_density_times_lorentz_factor),
+        r_dot_b_squared_(square(momentum_density_dot_magnetic_field) /
+                         cube(rest_mass_density_times_lorentz_factor)),
+        rest_mass_density_times_lorentz_factor_(
+            rest_mass_density_times_lorentz_factor),
+        electron_fraction_(electron_fraction),
+        equation_of_state_(equation_of_state),
+        h_0_(equation_of_state_.specific_enthalpy_lower_bound()),
+        rest_mass_density_lower_bound_(
+            equation_of_state_.rest_mass_density_lower_bound()),
+        rest_mass_density_upper_bound_(
+            equation_of_state_.rest_mass_density_upper_bound()) {
+    // Equations (33) and (32)
+    const T z_0_squared = r_squared_ / square(h_0_);
+    v_0_squared_ = simd::min(z_0_squared / (1.0 + z_0_squared),
+                             T(1.0 - 1.0 / (lorentz_max * lorentz_max)));
+
+    const auto density = store_batch(rest_mass_density_times_lorentz_factor_);
+    std::array<double, width> eps_min_values{};
+    for (size_t i = 0; i < width; ++i) {
+      if constexpr (EosType::thermodynamic_dim == 3) {
+        gsl::at(eps_min_values, i) =
+            equation_of_state_.specific_internal_energy_lower_bound(
+                gsl::at(density, i) / lorentz_max,
+                gsl::at(electron_fraction_, i));
+      } else {
+        gsl::at(eps_min_values, i) =
+            equation_of_state_.specific_internal_energy_lower_bound(
+                gsl::at(density, i) / lorentz_max);
+      }
+    }
+    const T eps_min = load_batch(eps_min_values);
+    q_ = tau / rest_mass_density_times_lorentz_factor;
+    if constexpr (EnforcePhysicality) {
+      q_ = simd::max(q_, eps_min);
+      const T r_squared_bound =
+          4.0 * v_0_squared_ * square(q_ + 1.0) / square(1.0 + v_0_squared_);
+      const auto bound_is_smaller = r_squared_bound < r_squared_;
+      r_squared_ = simd::select(bound_is_smaller, r_squared_bound, r_squared_);
+      r_dot_b_squared_ =
+          simd::select(bound_is_smaller,
+                       r_dot_b_squared_ * r_squared_bound / r_squared_,
+                       r_dot_b_squared_);
+    } else {
+      const T r_squared_bound =
+          4.0 * v_0_squared_ * square(q_ + 1.0) / square(1.0 + v_0_squared_);
+      state_is_unphysical_ = q_ < eps_min or r_squared_ > r_squared_bound;
+    }
+  }
+
+  // Same as FunctionOfMu::root_bracket for the points not in `ignore`. The
+  // points at which the bracket has to be adjusted for the bounds of the EOS,
+  // or the auxiliary function does not bracket a root, are added to
+  // `use_scalar`.
+  std::pair<T, T> root_bracket(const Mask& ignore,
+                               const gsl::not_null<Mask*> use_scalar,
+                               const double absolute_tolerance,
+                               const double relative_tolerance,
+                               const size_t max_iterations) const {
+    const T lower_bound(0.0);
+    T upper_bound(1.0 / (h_0_ + std::numeric_limits<double>::min()));
+    const auto needs_auxiliary = (r_squared_ < T(square(h_0_))) and not ignore;
+    if (simd::any(needs_auxiliary)) {
+      const auto auxiliary_function = AuxiliaryFunction<T>{
+          T(h_0_), r_squared_, b_squared_, r_dot_b_squared_};
+      T f_at_lower_bound = auxiliary_function(lower_bound);
+      T f_at_upper_bound = auxiliary_function(upper_bound);
+      *use_scalar = *use_scalar or
+                    (needs_auxiliary and
+                     f_at_lower_bound * f_at_upper_bound > T(0.0));
+      const auto skip_auxiliary = not needs_auxiliary or *use_scalar;
+      if (not simd::all(skip_auxiliary)) {
+        f_at_lower_bound =
+            simd::select(skip_auxiliary, T(-1.0), f_at_lower_bound);
+        f_at_upper_bound =
+            simd::select(skip_auxiliary, T(1.0), f_at_upper_bound);
+        upper_bound = simd::select(
+            skip_auxiliary, upper_bound,
+            RootFinder::toms748(auxiliary_function, lower_bound, upper_bound,
+                                f_at_lower_bound, f_at_upper_bound,
+                                absolute_tolerance, relative_tolerance,
+                                max_iterations, skip_auxiliary));
+      }
+    }
+
+    // Corner case discussed in Appendix A, see FunctionOfMu::root_bracket
+    const T x = compute_x(upper_bound, b_squared_);
+    const T r_bar_squared =
+        compute_r_bar_squared(upper_bound, x, r_squared_, r_dot_b_squared_);
+    const T v_hat_squared =
+        simd::min(square(upper_bound) * r_bar_squared, v_0_squared_);
+    const T w_hat = 1.0 / sqrt(1.0 - v_hat_squared);
+    const T rest_mass_density_at_upper_bound =
+        rest_mass_density_times_lorentz_factor_ / w_hat;
+    *use_scalar =
+        *use_scalar or
+        rest_mass_density_at_upper_bound > T(rest_mass_density_upper_bound_) or
+        rest_mass_density_at_upper_bound < T(rest_mass_density_lower_bound_) or
+        T(rest_mass_density_upper_bound_) <
+            rest_mass_density_times_lorentz_factor_;
+    return {lower_bound, upper_bound};
+  }
+
+  PrimitivesSimd<T> primitives(const T& mu) const {
+    // Equation (26)
+    const T x = compute_x(mu, b_squared_);
+    // Equations(38)
+    const T r_bar_squared =
+        compute_r_bar_squared(mu, x, r_squared_, r_dot_b_squared_);
+    // Equation (40)
+    const T v_hat_squared = simd::min(square(mu) * r_bar_squared, v_0_squared_);
+    const T w_hat = 1.0 / sqrt(1.0 - v_hat_squared);
+    // Equation (41) with bounds from Equation (5)
+    const T rho_hat = simd::min(
+        simd::max(rest_mass_density_times_lorentz_factor_ / w_hat,
+                  T(rest_mass_density_lower_bound_)),
+        T(rest_mass_density_upper_bound_));
+    // Equations (39) and (25)
+    const T q_bar =
+        q_ - 0.5 * b_squared_ -
+        0.5 * square(mu * x) * (r_squared_ * b_squared_ - r_dot_b_squared_);
+    // Equation (42), the bounds from Equation (6) are imposed below
+    const T epsilon_hat_unbounded =
+        w_hat * (q_bar - mu * r_bar_squared) +
+        v_hat_squared * square(w_hat) / (1.0 + w_hat);
+
+    const auto rho_hat_values = store_batch(rho_hat);
+    auto epsilon_hat_values = store_batch(epsilon_hat_unbounded);
+    std::array<double, width> p_hat_values{};
+    for (size_t i = 0; i < width; ++i) {
+      const double rho = gsl::at(rho_hat_values, i);
+      double& epsilon = gsl::at(epsilon_hat_values, i);
+      if constexpr (EosType::thermodynamic_dim == 3) {
+        epsilon =
+            std::clamp(epsilon,
+                       equation_of_state_.specific_internal_energy_lower_bound(
+                           rho, gsl::at(electron_fraction_, i)),
+                       equation_of_state_.specific_internal_energy_upper_bound(
+                           rho, gsl::at(electron_fraction_, i)));
+      } else {
+        epsilon = std::clamp(
+            epsilon,
+            equation_of_state_.specific_internal_energy_lower_bound(rho),
+            equation_of_state_.specific_internal_energy_upper_bound(rho));
+      }
+      // See FunctionOfMu::primitives for why epsilon is not reset for a 1d
+      // EOS
+      if constexpr (EosType::thermodynamic_dim == 1) {
+        gsl::at(p_hat_values, i) = get(
+            equation_of_state_.pressure_from_density(Scalar<double>(rho)));
+      } else if constexpr (EosType::thermodynamic_dim == 2) {
+        gsl::at(p_hat_values, i) =
+            get(equation_of_state_.pressure_from_density_and_energy(
+                Scalar<double>(rho), Scalar<double>(epsilon)));
+      } else if constexpr (EosType::thermodynamic_dim == 3) {
+        gsl::at(p_hat_values, i) =
+            get(equation_of_state_.pressure_from_density_and_energy(
+                Scalar<double>(rho), Scalar<double>(epsilon),
+                Scalar<double>(gsl::at(electron_fraction_, i))));
+      }
+    }
+    return PrimitivesSimd<T>{rho_hat,
+                             w_hat,
+                             load_batch(p_hat_values),
+                             load_batch(epsilon_hat_values),
+                             q_bar,
+                             r_bar_squared};
+  }
+
+  T operator()(const T& mu) const {
+    const auto [rho_hat, w_hat, p_hat, epsilon_hat, q_bar, r_bar_squared] =
+        primitives(mu);
+    // Equation (43)
+    const T a_hat = p_hat / (rho_hat * (1.0 + epsilon_hat));
+    const T h_hat = (1.0 + epsilon_hat) * (1.0 + a_hat);
+    // Equations (46) - (48)
+    const T nu_hat = simd::max(
+        h_hat / w_hat, (1.0 + a_hat) * (1.0 + q_bar - mu * r_bar_squared));
+    // Equations (44) - (45)
+    return mu - 1.0 / (nu_hat + mu * r_bar_squared);
+  }
+
+  const Mask& state_is_unphysical() const { return state_is_unphysical_; }
+
+ private:
+  T q_;
+  T r_squared_;
+  const T b_squared_;
+  T r_dot_b_squared_;
+  const T rest_mass_density_times_lorentz_factor_;
+  const std::array<double, width>& electron_fraction_;
+  const EosType& equation_of_state_;
+  const double h_0_;
+  const double rest_mass_density_lower_bound_;
+  const double rest_mass_density_upper_bound_;
+  T v_0_squared_;
+  Mask state_is_unphysical_ = static_cast<Mask>(false);
+};
 }  // namespace KastaunEtAl_detail
 
 template <bool EnforcePhysicality, typename EosType>
@@ -398,4 +642,147 @@ std::optional<PrimitiveRecoveryData> KastaunEtAl::apply(
           one_over_specific_enthalpy_times_lorentz_factor,
       electron_fraction};
 }
+
+template <bool EnforcePhysicality, typename EosType>
+std::array<std::optional<PrimitiveRecoveryData>, KastaunEtAl::simd_width>
+KastaunEtAl::apply_simd(
+    const double* const tau, const double* const momentum_density_squared,
+    const double* const momentum_density_dot_magnetic_field,
+    const double* const magnetic_field_squared,
+    const double* const rest_mass_density_times_lorentz_factor,
+    const double* const electron_fraction, const EosType& equation_of_state,
+    const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions&
+        primitive_from_conservative_options) {
+  using T = simd_type;
+  using Mask = simd::mask_type_t<T>;
+  std::array<std::optional<PrimitiveRecoveryData>, simd_width> result{};
+  const auto apply_scalar = [&](const size_t i) {
+    gsl::at(result, i) = apply<EnforcePhysicality>(
+        std::numeric_limits<double>::signaling_NaN(), tau[i],
+        momentum_density_squared[i], momentum_density_dot_magnetic_field[i],
+        magnetic_field_squared[i], rest_mass_density_times_lorentz_factor[i],
+        electron_fraction[i], equation_of_state,
+        primitive_from_conservative_options);
+  };
+
+  // Points with non-finite input, or a density below the minimum of the EOS,
+  // are recovered with `apply`. In the batch their values are replaced by
+  // those of the first other point so that all evaluations of the EOS are
+  // well defined.
+  std::array<double, simd_width> use_scalar_values{};
+  std::optional<size_t> reference_point{};
+  for (size_t i = 0; i < simd_width; ++i) {
+    const bool is_valid =
+        std::isfinite(tau[i]) and std::isfinite(momentum_density_squared[i]) and
+        std::isfinite(momentum_density_dot_magnetic_field[i]) and
+        std::isfinite(magnetic_field_squared[i]) and
+        std::isfinite(electron_fraction[i]) and
+        std::isfinite(rest_mass_density_times_lorentz_factor[i]) and
+        rest_mass_density_times_lorentz_factor[i] >=
+            equation_of_state.rest_mass_density_lower_bound();
+    gsl::at(use_scalar_values, i) = is_valid ? 0.0 : 1.0;
+    if (is_valid and not reference_point.has_value()) {
+      reference_point = i;
+    }
+  }
+  if (not reference_point.has_value()) {
+    for (size_t i = 0; i < simd_width; ++i) {
+      apply_scalar(i);
+    }
+    return result;
+  }
+  const auto valid_values = [&use_scalar_values,
+                             &reference_point](const double* const values) {
+    std::array<double, simd_width> batch_values{};
+    for (size_t i = 0; i < simd_width; ++i) {
+      gsl::at(batch_values, i) =
+          values[gsl::at(use_scalar_values, i) == 0.0 ? i : *reference_point];
+    }
+    return batch_values;
+  };
+  const std::array<double, simd_width> batch_electron_fraction =
+      valid_values(electron_fraction);
+  const T batch_rest_mass_density_times_lorentz_factor =
+      KastaunEtAl_detail::load_batch(
+          valid_values(rest_mass_density_times_lorentz_factor));
+
+  // Master function see Equation (44)
+  const auto f_of_mu =
+      KastaunEtAl_detail::FunctionOfMuSimd<EnforcePhysicality, EosType>{
+          KastaunEtAl_detail::load_batch(valid_values(tau)),
+          KastaunEtAl_detail::load_batch(
+              valid_values(momentum_density_squared)),
+          KastaunEtAl_detail::load_batch(
+              valid_values(momentum_density_dot_magnetic_field)),
+          KastaunEtAl_detail::load_batch(valid_values(magnetic_field_squared)),
+          batch_rest_mass_density_times_lorentz_factor,
+          batch_electron_fraction,
+          equation_of_state,
+          primitive_from_conservative_options.kastaun_max_lorentz_factor()};
+
+  Mask use_scalar =
+      KastaunEtAl_detail::load_batch(use_scalar_values) != T(0.0);
+  // mu is 1 / (h W) see Equation (26)
+  T one_over_specific_enthalpy_times_lorentz_factor(
+      std::numeric_limits<double>::signaling_NaN());
+  try {
+    // Bracket for master function, see Sec. II.F
+    const auto [lower_bound, upper_bound] = f_of_mu.root_bracket(
+        use_scalar or f_of_mu.state_is_unphysical(), make_not_null(&use_scalar),
+        absolute_tolerance_, relative_tolerance_, max_iterations_);
+
+    // Points that don't bracket a root are left to `apply` to handle
+    T f_at_lower_bound = f_of_mu(lower_bound);
+    T f_at_upper_bound = f_of_mu(upper_bound);
+    use_scalar = use_scalar or f_at_lower_bound * f_at_upper_bound > T(0.0);
+    const Mask ignore = use_scalar or f_of_mu.state_is_unphysical();
+    if (not simd::all(ignore)) {
+      f_at_lower_bound = simd::select(ignore, T(-1.0), f_at_lower_bound);
+      f_at_upper_bound = simd::select(ignore, T(1.0), f_at_upper_bound);
+      // Try to recover primitves, the points that converge are masked out
+      // while the others keep iterating
+      one_over_specific_enthalpy_times_lorentz_factor = RootFinder::toms748(
+          f_of_mu, lower_bound, upper_bound, f_at_lower_bound,
+          f_at_upper_bound, absolute_tolerance_, relative_tolerance_,
+          max_iterations_, ignore);
+    }
+  } catch (std::exception& exception) {
+    // A point failed to converge or a bracket could not be found, so fall
+    // back to recovering each point on its own to find out which
+    for (size_t i = 0; i < simd_width; ++i) {
+      apply_scalar(i);
+    }
+    return result;
+  }
+
+  const auto primitives =
+      f_of_mu.primitives(one_over_specific_enthalpy_times_lorentz_factor);
+  const auto use_scalar_at_point = KastaunEtAl_detail::store_batch(
+      simd::select(use_scalar, T(1.0), T(0.0)));
+  const auto unphysical_at_point = KastaunEtAl_detail::store_batch(
+      simd::select(f_of_mu.state_is_unphysical(), T(1.0), T(0.0)));
+  const auto mu = KastaunEtAl_detail::store_batch(
+      one_over_specific_enthalpy_times_lorentz_factor);
+  const auto rest_mass_density =
+      KastaunEtAl_detail::store_batch(primitives.rest_mass_density);
+  const auto lorentz_factor =
+      KastaunEtAl_detail::store_batch(primitives.lorentz_factor);
+  const auto pressure = KastaunEtAl_detail::store_batch(primitives.pressure);
+  const auto specific_internal_energy =
+      KastaunEtAl_detail::store_batch(primitives.specific_internal_energy);
+  for (size_t i = 0; i < simd_width; ++i) {
+    if (gsl::at(use_scalar_at_point, i) != 0.0) {
+      apply_scalar(i);
+    } else if (gsl::at(unphysical_at_point, i) == 0.0) {
+      gsl::at(result, i) = PrimitiveRecoveryData{
+          gsl::at(rest_mass_density, i),
+          gsl::at(lorentz_factor, i),
+          gsl::at(pressure, i),
+          gsl::at(specific_internal_energy, i),
+          rest_mass_density_times_lorentz_factor[i] / gsl::at(mu, i),
+          electron_fraction[i]};
+    }
+  }
+  return result;
+}
 }  // namespace grmhd::ValenciaDivClean::PrimitiveRecoverySchemes
@@ -3,6 +3,8 @@
 
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
 
+#include <array>
+#include <cstddef>
 #include <iomanip>
 #include <limits>
 #include <optional>
@@ -160,6 +162,47 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
   for (size_t s = 0; s < number_of_points; ++s) {
     get(*electron_fraction)[s] =
         std::min(0.5, std::max(get(tilde_ye)[s] / get(tilde_d)[s], 0.));
+  }
+
+  // When KastaunEtAl is tried first, it is applied to `simd_width` points at
+  // once wherever none of them is in the atmosphere or uses the hydro
+  // optimization. The remaining schemes are only tried at the points where it
+  // fails.
+  using KastaunEtAl = PrimitiveRecoverySchemes::KastaunEtAl;
+  constexpr size_t simd_width = KastaunEtAl::simd_width;
+  constexpr bool recover_in_batches =
+      simd_width > 1 and
+      std::is_same_v<tmpl::front<OrderedListOfPrimitiveRecoverySchemes>,
+                     KastaunEtAl>;
+  std::array<std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>,
+             simd_width>
+      batch_primitive_data{};
+  // The points [batch_end - simd_width, batch_end) were recovered as a batch
+  size_t batch_end = 0;
+
+  for (size_t s = 0; s < number_of_points; ++s) {
+    if constexpr (recover_in_batches) {
+      if (s >= batch_end and s + simd_width <= number_of_points) {
+        bool batch_is_valid = true;
+        for (size_t i = s; i < s + simd_width and batch_is_valid; ++i) {
+          batch_is_valid =
+              rest_mass_density_times_lorentz_factor[i] >= cutoffD and
+              not(use_hydro_optimization and
+                  (get(magnetic_field_squared)[i] <
+                   100.0 * std::numeric_limits<double>::epsilon() * tau[i]));
+        }
+        if (batch_is_valid) {
+          batch_primitive_data = KastaunEtAl::apply_simd<EnforcePhysicality>(
+              &tau[s], &get(momentum_density_squared)[s],
+              &get(momentum_density_dot_magnetic_field)[s],
+              &get(magnetic_field_squared)[s],
+              &rest_mass_density_times_lorentz_factor[s],
+              &get(*electron_fraction)[s], equation_of_state,
+              primitive_from_conservative_options);
+          batch_end = s + simd_width;
+        }
+      }
+    }
 
     std::optional<PrimitiveRecoverySchemes::PrimitiveRecoveryData>
         primitive_data = std::nullopt;
@@ -211,9 +254,18 @@ bool PrimitiveFromConservative<OrderedListOfPrimitiveRecoverySchemes,
         }
       };
       // Check consistency
-      if (use_hydro_optimization and
-          (get(magnetic_field_squared)[s] <
-           100.0 * std::numeric_limits<double>::epsilon() * tau[s])) {
+      if (s < batch_end) {
+        // KastaunEtAl was already applied to this point as part of a batch
+        primitive_data =
+            gsl::at(batch_primitive_data, s + simd_width - batch_end);
+        if (not primitive_data.has_value()) {
+          tmpl::for_each<
+              tmpl::pop_front<OrderedListOfPrimitiveRecoverySchemes>>(
+              apply_scheme);
+        }
+      } else if (use_hydro_optimization and
+                 (get(magnetic_field_squared)[s] <
+                  100.0 * std::numeric_limits<double>::epsilon() * tau[s])) {
         tmpl::for_each<
             tmpl::list<grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::
                            KastaunEtAlHydro>>(apply_scheme);
@@ -0,0 +1,54 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/ApplyMatrices.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Index.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// Number of independent components, roughly that of the GH system
+constexpr size_t number_of_components = 50;
+
+// Interpolates from a cube with `state.range(0)` points per dimension to one
+// with one more point per dimension, as is done when projecting data after
+// p-refinement. Extents beyond 12 are handled by BLAS instead of the
+// fixed-size kernels.
+template <size_t Dim>
+void bench_apply_matrices(benchmark::State& state) {  // NOLINT
+  const auto source_extent = static_cast<size_t>(state.range(0));
+  const Mesh<1> source_mesh{source_extent, Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto};
+  const Mesh<1> target_mesh{source_extent + 1, Spectral::Basis::Legendre,
+                            Spectral::Quadrature::GaussLobatto};
+  const Matrix interpolation_matrix = Spectral::interpolation_matrix(
+      source_mesh, Spectral::collocation_points(target_mesh));
+  std::array<Matrix, Dim> matrices{};
+  matrices.fill(interpolation_matrix);
+  const Index<Dim> extents(source_extent);
+  const DataVector data(number_of_components * extents.product(), 1.0);
+  DataVector result(number_of_components *
+                    Index<Dim>(source_extent + 1).product());
+  for (auto _ : state) {
+    apply_matrices(make_not_null(&result), matrices, data, extents);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(data.size()));
+}
+BENCHMARK_TEMPLATE(bench_apply_matrices, 1)->DenseRange(2, 13);  // NOLINT
+BENCHMARK_TEMPLATE(bench_apply_matrices, 2)->DenseRange(2, 13);  // NOLINT
+BENCHMARK_TEMPLATE(bench_apply_matrices, 3)->DenseRange(2, 13);  // NOLINT
+}  // namespace
@@ -0,0 +1,121 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Prefixes.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Hll.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/BoundaryCorrections/Rusanov.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/System.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/Tags.hpp"
+#include "NumericalAlgorithms/DiscontinuousGalerkin/Formulation.hpp"
+#include "PointwiseFunctions/GeneralRelativity/Tags.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+using System = grmhd::ValenciaDivClean::System;
+using variables_tags = typename System::variables_tag::tags_list;
+using flux_tags =
+    db::wrap_tags_in<::Tags::Flux, typename System::flux_variables,
+                     tmpl::size_t<3>, Frame::Inertial>;
+
+// Forwards the tensors in the `Variables` to the boundary correction, in the
+// same order as the DG actions do
+template <typename BoundaryCorrection, typename... PackagedTags,
+          typename... FaceTags>
+double package_data(
+    const gsl::not_null<Variables<tmpl::list<PackagedTags...>>*> packaged_data,
+    const BoundaryCorrection& boundary_correction,
+    const Variables<tmpl::list<FaceTags...>>& fields_on_face,
+    const tnsr::i<DataVector, 3, Frame::Inertial>& normal_covector,
+    const tnsr::I<DataVector, 3, Frame::Inertial>& normal_vector) {
+  return boundary_correction.dg_package_data(
+      make_not_null(&get<PackagedTags>(*packaged_data))...,
+      get<FaceTags>(fields_on_face)..., normal_covector, normal_vector,
+      std::nullopt, std::nullopt);
+}
+
+template <typename BoundaryCorrection, typename... CorrectionTags,
+          typename... PackagedTags>
+void boundary_terms(
+    const gsl::not_null<Variables<tmpl::list<CorrectionTags...>>*>
+        boundary_corrections,
+    const BoundaryCorrection& boundary_correction,
+    const Variables<tmpl::list<PackagedTags...>>& interior_packaged_data,
+    const Variables<tmpl::list<PackagedTags...>>& exterior_packaged_data) {
+  boundary_correction.dg_boundary_terms(
+      make_not_null(&get<CorrectionTags>(*boundary_corrections))...,
+      get<PackagedTags>(interior_packaged_data)...,
+      get<PackagedTags>(exterior_packaged_data)...,
+      dg::Formulation::StrongInertial);
+}
+
+// Packages the data on both sides of a face of a cube with `state.range(0)`
+// points per dimension and computes the GRMHD boundary correction from it,
+// which is what happens on every internal mortar at every step.
+template <typename BoundaryCorrection>
+void bench_grmhd_boundary_correction(benchmark::State& state) {  // NOLINT
+  const auto extent = static_cast<size_t>(state.range(0));
+  const size_t num_points = extent * extent;
+  using FieldsOnFace = Variables<tmpl::append<
+      variables_tags, flux_tags,
+      typename BoundaryCorrection::dg_package_data_temporary_tags>>;
+  FieldsOnFace interior_fields(num_points, 0.1);
+  get(get<grmhd::ValenciaDivClean::Tags::TildeD>(interior_fields)) = 1.0;
+  get(get<grmhd::ValenciaDivClean::Tags::TildeTau>(interior_fields)) = 0.5;
+  get(get<gr::Tags::Lapse<DataVector>>(interior_fields)) = 1.0;
+  FieldsOnFace exterior_fields = interior_fields;
+  get(get<grmhd::ValenciaDivClean::Tags::TildeD>(exterior_fields)) = 1.1;
+
+  tnsr::i<DataVector, 3, Frame::Inertial> interior_normal_covector(num_points,
+                                                                    0.0);
+  get<0>(interior_normal_covector) = 1.0;
+  tnsr::I<DataVector, 3, Frame::Inertial> interior_normal_vector(num_points,
+                                                                 0.0);
+  get<0>(interior_normal_vector) = 1.0;
+  auto exterior_normal_covector = interior_normal_covector;
+  get<0>(exterior_normal_covector) = -1.0;
+  auto exterior_normal_vector = interior_normal_vector;
+  get<0>(exterior_normal_vector) = -1.0;
+
+  const BoundaryCorrection boundary_correction{};
+  using PackagedData =
+      Variables<typename BoundaryCorrection::dg_package_field_tags>;
+  PackagedData interior_packaged_data(num_points);
+  PackagedData exterior_packaged_data(num_points);
+  Variables<variables_tags> boundary_corrections(num_points);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(package_data(
+        make_not_null(&interior_packaged_data), boundary_correction,
+        interior_fields, interior_normal_covector, interior_normal_vector));
+    benchmark::DoNotOptimize(package_data(
+        make_not_null(&exterior_packaged_data), boundary_correction,
+        exterior_fields, exterior_normal_covector, exterior_normal_vector));
+    boundary_terms(make_not_null(&boundary_corrections), boundary_correction,
+                   interior_packaged_data, exterior_packaged_data);
+    benchmark::DoNotOptimize(boundary_corrections.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(num_points));
+}
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_grmhd_boundary_correction,
+    grmhd::ValenciaDivClean::BoundaryCorrections::Rusanov)
+    ->DenseRange(2, 12, 2);
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_grmhd_boundary_correction,
+    grmhd::ValenciaDivClean::BoundaryCorrections::Hll)
+    ->DenseRange(2, 12, 2);
+}  // namespace
@@ -0,0 +1,79 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "Time/BoundaryHistory.hpp"
+#include "Time/Slab.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+#include "Time/TimeSteppers/AdamsBashforth.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+using History =
+    TimeSteppers::BoundaryHistory<DataVector, DataVector, DataVector>;
+
+// The six mortars of a 3D element with 6^3 points and 8 evolved variables
+constexpr size_t number_of_mortars = 6;
+constexpr size_t num_points = 6 * 6 * 8;
+
+// Takes a local-time-stepping boundary step on all mortars of an element
+// with an Adams-Bashforth method of order `state.range(0)`, where the
+// neighbors take two steps for each step of the element. The couplings are
+// cached in the histories after the first iteration, so this measures the
+// computation of the coefficients and the sum over the couplings.
+void bench_lts_boundary_delta(benchmark::State& state) {  // NOLINT
+  const auto order = static_cast<size_t>(state.range(0));
+  const TimeSteppers::AdamsBashforth stepper(order);
+  const Slab slab(0.0, 1.0);
+  const Slab init_slab = slab.advance_towards(-slab.duration());
+  const TimeDelta local_step = slab.duration() / 16;
+  const TimeDelta remote_step = local_step / 2;
+  const auto make_time_id = [](const Time& time) {
+    return TimeStepId(true, 0, time);
+  };
+
+  std::array<History, number_of_mortars> histories{};
+  for (size_t mortar = 0; mortar < number_of_mortars; ++mortar) {
+    auto& history = gsl::at(histories, mortar);
+    const DataVector data(num_points, static_cast<double>(mortar + 1));
+    for (int32_t step = 1; step < static_cast<int32_t>(order); ++step) {
+      history.local().insert_initial(
+          make_time_id(slab.start() - step * local_step.with_slab(init_slab)),
+          order, data);
+      history.remote().insert_initial(
+          make_time_id(slab.start() - step * remote_step.with_slab(init_slab)),
+          order, data);
+    }
+    history.local().insert(make_time_id(slab.start()), order, data);
+    history.remote().insert(make_time_id(slab.start()), order, data);
+    history.remote().insert(make_time_id(slab.start() + remote_step), order,
+                            data);
+  }
+
+  const auto coupling = [](const DataVector& local, const DataVector& remote) {
+    return DataVector(local * remote);
+  };
+  DataVector result(num_points, 0.0);
+  for (auto _ : state) {
+    for (auto& history : histories) {
+      stepper.add_boundary_delta(make_not_null(&result),
+                                 make_not_null(&history), local_step,
+                                 coupling);
+    }
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(number_of_mortars * num_points));
+}
+BENCHMARK(bench_lts_boundary_delta)->DenseRange(2, 8, 1);  // NOLINT
+}  // namespace
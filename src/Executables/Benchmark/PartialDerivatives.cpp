@@ -0,0 +1,126 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
+#include "Domain/CoordinateMaps/Affine.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.hpp"
+#include "Domain/CoordinateMaps/CoordinateMap.tpp"
+#include "Domain/CoordinateMaps/ProductMaps.hpp"
+#include "Domain/CoordinateMaps/ProductMaps.tpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
+#include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
+#include "NumericalAlgorithms/Spectral/LogicalCoordinates.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// The evolved variables of the generalized harmonic system, which are a
+// typical workload for partial derivatives
+template <size_t Dim>
+struct Kappa : db::SimpleTag {
+  using type = tnsr::abb<DataVector, Dim, Frame::Grid>;
+};
+template <size_t Dim>
+struct Psi : db::SimpleTag {
+  using type = tnsr::aa<DataVector, Dim, Frame::Grid>;
+};
+
+// clang-tidy: don't pass be non-const reference
+void bench_all_gradient(benchmark::State& state) {  // NOLINT
+  constexpr const size_t pts_1d = 4;
+  constexpr const size_t Dim = 3;
+  const Mesh<Dim> mesh{pts_1d, Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  domain::CoordinateMaps::Affine map1d(-1.0, 1.0, -1.0, 1.0);
+  using Map3d =
+      domain::CoordinateMaps::ProductOf3Maps<domain::CoordinateMaps::Affine,
+                                             domain::CoordinateMaps::Affine,
+                                             domain::CoordinateMaps::Affine>;
+  domain::CoordinateMap<Frame::ElementLogical, Frame::Grid, Map3d> map(
+      Map3d{map1d, map1d, map1d});
+
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid>
+      inv_jac = map.inv_jacobian(logical_coordinates(mesh));
+  const auto grid_coords = map(logical_coordinates(mesh));
+  Variables<VarTags> vars(mesh.number_of_grid_points(), 0.0);
+
+  while (state.KeepRunning()) {
+    benchmark::DoNotOptimize(partial_derivatives<VarTags>(vars, mesh, inv_jac));
+  }
+}
+BENCHMARK(bench_all_gradient);  // NOLINT
+
+// Partial derivatives of the GH variables on a cube with `state.range(0)`
+// points per dimension
+template <size_t Dim>
+void bench_partial_derivatives(benchmark::State& state) {  // NOLINT
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  using DerivTags = db::wrap_tags_in<Tags::deriv, VarTags, tmpl::size_t<Dim>,
+                                     Frame::Grid>;
+  const size_t num_points = mesh.number_of_grid_points();
+  InverseJacobian<DataVector, Dim, Frame::ElementLogical, Frame::Grid> inv_jac{
+      num_points, 0.0};
+  for (size_t d = 0; d < Dim; ++d) {
+    inv_jac.get(d, d) = 2.0;
+  }
+  const Variables<VarTags> vars(num_points, 1.0);
+  Variables<DerivTags> derivs(num_points);
+  for (auto _ : state) {
+    partial_derivatives(make_not_null(&derivs), vars, mesh, inv_jac);
+    benchmark::DoNotOptimize(derivs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(vars.size()));
+}
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 1)->DenseRange(2, 12);  // NOLINT
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 2)->DenseRange(2, 12);  // NOLINT
+BENCHMARK_TEMPLATE(bench_partial_derivatives, 3)->DenseRange(2, 12);  // NOLINT
+
+// Logical derivatives of a GH-sized set of variables on a cube with
+// `state.range(0)` points per dimension, comparing the BLAS implementation
+// (which transposes the data) with the fixed-size kernels (which don't). The
+// crossover determines `apply_fixed_size_matrix_preferred_max_size`.
+template <LogicalDerivativeAlgorithm Algorithm>
+void bench_logical_derivatives(benchmark::State& state) {  // NOLINT
+  constexpr size_t Dim = 3;
+  const Mesh<Dim> mesh{static_cast<size_t>(state.range(0)),
+                       Spectral::Basis::Legendre,
+                       Spectral::Quadrature::GaussLobatto};
+  using VarTags = tmpl::list<Kappa<Dim>, Psi<Dim>>;
+  const Variables<VarTags> vars(mesh.number_of_grid_points(), 1.0);
+  std::array<Variables<VarTags>, Dim> logical_derivs{};
+  for (auto _ : state) {
+    logical_partial_derivatives(make_not_null(&logical_derivs), vars, mesh,
+                                Algorithm);
+    benchmark::DoNotOptimize(logical_derivs[0].data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(vars.size()));
+}
+BENCHMARK_TEMPLATE(bench_logical_derivatives,  // NOLINT
+                   LogicalDerivativeAlgorithm::Blas)
+    ->DenseRange(2, 12);
+BENCHMARK_TEMPLATE(bench_logical_derivatives,  // NOLINT
+                   LogicalDerivativeAlgorithm::FixedSize)
+    ->DenseRange(2, 12);
+}  // namespace
@@ -0,0 +1,149 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/EagerMath/DeterminantAndInverse.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservative.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/PrimitiveFromConservativeOptions.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Equilibrium3D.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+// Recovers the primitive variables at `state.range(0)` points from
+// conservatives computed from a smooth, magnetized state that spans several
+// orders of magnitude in density and specific internal energy.
+//
+// The pressure is reset to a guess 10% off the solution before each
+// recovery, mimicking the use of the previous time step's pressure as the
+// initial guess during an evolution.
+template <typename RecoveryScheme>
+void bench_primitive_from_conservative(benchmark::State& state) {  // NOLINT
+  const auto num_points = static_cast<size_t>(state.range(0));
+  const EquationsOfState::Equilibrium3D<EquationsOfState::IdealFluid<true>>
+      equation_of_state{EquationsOfState::IdealFluid<true>{4.0 / 3.0}};
+
+  DataVector fraction(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    fraction[i] = static_cast<double>(i) / static_cast<double>(num_points);
+  }
+  const Scalar<DataVector> rest_mass_density{
+      1.0e-8 * exp(log(1.0e5) * fraction)};
+  const Scalar<DataVector> electron_fraction(num_points, 0.1);
+  const Scalar<DataVector> specific_internal_energy{
+      1.0e-2 * exp(log(1.0e2) * fraction)};
+  const Scalar<DataVector> temperature =
+      equation_of_state.temperature_from_density_and_energy(
+          rest_mass_density, specific_internal_energy, electron_fraction);
+  const Scalar<DataVector> pressure =
+      equation_of_state.pressure_from_density_and_temperature(
+          rest_mass_density, temperature, electron_fraction);
+
+  tnsr::ii<DataVector, 3, Frame::Inertial> spatial_metric(num_points, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    spatial_metric.get(i, i) = 1.0 + 0.1 * static_cast<double>(i + 1);
+  }
+  spatial_metric.get(0, 1) = 0.05;
+  const auto [det_spatial_metric, inv_spatial_metric] =
+      determinant_and_inverse(spatial_metric);
+  const Scalar<DataVector> sqrt_det_spatial_metric{
+      sqrt(get(det_spatial_metric))};
+
+  tnsr::I<DataVector, 3, Frame::Inertial> spatial_velocity(num_points);
+  get<0>(spatial_velocity) = 0.5 * sin(6.0 * fraction);
+  get<1>(spatial_velocity) = 0.3 * cos(6.0 * fraction);
+  get<2>(spatial_velocity) = -0.1;
+  Scalar<DataVector> lorentz_factor(num_points, 0.0);
+  for (size_t i = 0; i < 3; ++i) {
+    for (size_t j = 0; j < 3; ++j) {
+      get(lorentz_factor) += spatial_metric.get(i, j) *
+                             spatial_velocity.get(i) * spatial_velocity.get(j);
+    }
+  }
+  get(lorentz_factor) = 1.0 / sqrt(1.0 - get(lorentz_factor));
+  // A magnetic pressure of about 10% of the fluid pressure
+  tnsr::I<DataVector, 3, Frame::Inertial> magnetic_field(num_points);
+  get<0>(magnetic_field) = 0.3 * sqrt(get(pressure));
+  get<1>(magnetic_field) = 0.2 * sqrt(get(pressure));
+  get<2>(magnetic_field) = 0.3 * sqrt(get(pressure)) * cos(3.0 * fraction);
+  const Scalar<DataVector> divergence_cleaning_field(num_points, 0.0);
+
+  Scalar<DataVector> tilde_d(num_points);
+  Scalar<DataVector> tilde_ye(num_points);
+  Scalar<DataVector> tilde_tau(num_points);
+  tnsr::i<DataVector, 3, Frame::Inertial> tilde_s(num_points);
+  tnsr::I<DataVector, 3, Frame::Inertial> tilde_b(num_points);
+  Scalar<DataVector> tilde_phi(num_points);
+  grmhd::ValenciaDivClean::ConservativeFromPrimitive::apply(
+      make_not_null(&tilde_d), make_not_null(&tilde_ye),
+      make_not_null(&tilde_tau), make_not_null(&tilde_s),
+      make_not_null(&tilde_b), make_not_null(&tilde_phi), rest_mass_density,
+      electron_fraction, specific_internal_energy, pressure, spatial_velocity,
+      lorentz_factor, magnetic_field, sqrt_det_spatial_metric, spatial_metric,
+      divergence_cleaning_field);
+
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions options{
+      0.0, 0.0, std::numeric_limits<double>::max()};
+  const DataVector pressure_guess = 0.9 * get(pressure);
+  Scalar<DataVector> recovered_rest_mass_density(num_points);
+  Scalar<DataVector> recovered_electron_fraction(num_points);
+  Scalar<DataVector> recovered_specific_internal_energy(num_points);
+  tnsr::I<DataVector, 3, Frame::Inertial> recovered_spatial_velocity(
+      num_points);
+  tnsr::I<DataVector, 3, Frame::Inertial> recovered_magnetic_field(num_points);
+  Scalar<DataVector> recovered_divergence_cleaning_field(num_points);
+  Scalar<DataVector> recovered_lorentz_factor(num_points);
+  Scalar<DataVector> recovered_pressure(num_points);
+  Scalar<DataVector> recovered_temperature(num_points);
+  for (auto _ : state) {
+    get(recovered_pressure) = pressure_guess;
+    grmhd::ValenciaDivClean::PrimitiveFromConservative<
+        tmpl::list<RecoveryScheme>>::apply(
+        make_not_null(&recovered_rest_mass_density),
+        make_not_null(&recovered_electron_fraction),
+        make_not_null(&recovered_specific_internal_energy),
+        make_not_null(&recovered_spatial_velocity),
+        make_not_null(&recovered_magnetic_field),
+        make_not_null(&recovered_divergence_cleaning_field),
+        make_not_null(&recovered_lorentz_factor),
+        make_not_null(&recovered_pressure),
+        make_not_null(&recovered_temperature), tilde_d, tilde_ye, tilde_tau,
+        tilde_s, tilde_b, tilde_phi, spatial_metric, inv_spatial_metric,
+        sqrt_det_spatial_metric, equation_of_state, options);
+    benchmark::DoNotOptimize(get(recovered_pressure).data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(num_points));
+}
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_primitive_from_conservative,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl)
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_primitive_from_conservative,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::NewmanHamlin)
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+BENCHMARK_TEMPLATE(  // NOLINT
+    bench_primitive_from_conservative,
+    grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::PalenzuelaEtAl)
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+}  // namespace
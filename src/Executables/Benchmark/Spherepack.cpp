@@ -0,0 +1,140 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+#include "DataStructures/DataVector.hpp"
+#include "NumericalAlgorithms/SphericalHarmonics/Spherepack.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+// A smooth function on the sphere at the collocation points of `ylm`
+DataVector test_function(const ylm::Spherepack& ylm) {
+  const auto theta_phi = ylm.theta_phi_points();
+  return 1.0 + sin(theta_phi[0]) * cos(theta_phi[0]) * sin(2.0 * theta_phi[1]);
+}
+
+// Points spread over the sphere that are not on the collocation grid
+std::array<DataVector, 2> scattered_points(const size_t num_points) {
+  std::array<DataVector, 2> points{DataVector(num_points),
+                                   DataVector(num_points)};
+  for (size_t i = 0; i < num_points; ++i) {
+    const double fraction =
+        static_cast<double>(i) / static_cast<double>(num_points);
+    points[0][i] = M_PI * (0.01 + 0.98 * fraction);
+    points[1][i] = 2.0 * M_PI * fraction * 17.0;
+  }
+  return points;
+}
+
+// Transforms with `l_max = m_max = state.range(0)`, covering the resolutions
+// of apparent horizons and CCE worldtubes
+void bench_spherepack_phys_to_spec(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const ylm::Spherepack ylm{l_max, l_max};
+  const DataVector collocation_values = test_function(ylm);
+  DataVector spectral_coefs(ylm.spectral_size());
+  for (auto _ : state) {
+    ylm.phys_to_spec(make_not_null(spectral_coefs.data()),
+                     make_not_null(collocation_values.data()));
+    benchmark::DoNotOptimize(spectral_coefs.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(ylm.physical_size()));
+}
+BENCHMARK(bench_spherepack_phys_to_spec)->DenseRange(8, 32, 8);  // NOLINT
+
+void bench_spherepack_spec_to_phys(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const ylm::Spherepack ylm{l_max, l_max};
+  const DataVector spectral_coefs = ylm.phys_to_spec(test_function(ylm));
+  DataVector collocation_values(ylm.physical_size());
+  for (auto _ : state) {
+    ylm.spec_to_phys(make_not_null(collocation_values.data()),
+                     make_not_null(spectral_coefs.data()));
+    benchmark::DoNotOptimize(collocation_values.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(ylm.physical_size()));
+}
+BENCHMARK(bench_spherepack_spec_to_phys)->DenseRange(8, 32, 8);  // NOLINT
+
+void bench_spherepack_gradient(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const ylm::Spherepack ylm{l_max, l_max};
+  const DataVector collocation_values = test_function(ylm);
+  std::array<DataVector, 2> gradient{DataVector(ylm.physical_size()),
+                                     DataVector(ylm.physical_size())};
+  for (auto _ : state) {
+    ylm.gradient({{gradient[0].data(), gradient[1].data()}},
+                 make_not_null(collocation_values.data()));
+    benchmark::DoNotOptimize(gradient[0].data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(ylm.physical_size()));
+}
+BENCHMARK(bench_spherepack_gradient)->DenseRange(8, 32, 8);  // NOLINT
+
+// Interpolation to a set of target points that changes every call, as when
+// interpolating to a surface that moves with the horizon finder
+void bench_spherepack_interpolation(benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const ylm::Spherepack ylm{l_max, l_max};
+  const DataVector collocation_values = test_function(ylm);
+  const size_t num_target_points = ylm.physical_size();
+  const auto target_points = scattered_points(num_target_points);
+  DataVector result(num_target_points);
+  for (auto _ : state) {
+    const auto interpolation_info =
+        ylm.set_up_interpolation_info(target_points);
+    ylm.interpolate(make_not_null(&result),
+                    make_not_null(collocation_values.data()),
+                    interpolation_info);
+    benchmark::DoNotOptimize(result.data());
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(num_target_points));
+}
+BENCHMARK(bench_spherepack_interpolation)->DenseRange(8, 32, 8);  // NOLINT
+
+// The number of functions interpolated together below, e.g. the components of
+// the spatial metric and extrinsic curvature
+constexpr size_t number_of_functions = 12;
+
+// Interpolation of several functions to a fixed set of target points with
+// `Spherepack::interpolate`, reusing the `InterpolationInfo`
+void bench_spherepack_fixed_target_interpolation(
+    benchmark::State& state) {  // NOLINT
+  const auto l_max = static_cast<size_t>(state.range(0));
+  const ylm::Spherepack ylm{l_max, l_max};
+  const DataVector collocation_values = test_function(ylm);
+  const size_t num_target_points = ylm.physical_size();
+  const auto interpolation_info =
+      ylm.set_up_interpolation_info(scattered_points(num_target_points));
+  DataVector result(num_target_points);
+  for (auto _ : state) {
+    for (size_t i = 0; i < number_of_functions; ++i) {
+      ylm.interpolate(make_not_null(&result),
+                      make_not_null(collocation_values.data()),
+                      interpolation_info);
+      benchmark::DoNotOptimize(result.data());
+    }
+    benchmark::ClobberMemory();
+  }
+  state.SetItemsProcessed(
+      state.iterations() *
+      static_cast<int64_t>(number_of_functions * num_target_points));
+}
+BENCHMARK(bench_spherepack_fixed_target_interpolation)
+    ->DenseRange(8, 32, 8);  // NOLINT
+}  // namespace
@@ -0,0 +1,165 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
+
+namespace {
+using Eos = EquationsOfState::Tabulated3D<true>;
+
+// Bounds and number of points of the table in (Y_e, log(rho), log(T)), with
+// sizes comparable to the nuclear equations of state used in production
+constexpr size_t number_of_electron_fractions = 50;
+constexpr size_t number_of_log_densities = 200;
+constexpr size_t number_of_log_temperatures = 100;
+constexpr double min_electron_fraction = 0.01;
+constexpr double max_electron_fraction = 0.6;
+constexpr double min_density = 1.0e-12;
+constexpr double max_density = 1.0e-2;
+constexpr double min_temperature = 1.0e-2;
+constexpr double max_temperature = 1.0e2;
+
+std::vector<double> uniform_points(const double lower, const double upper,
+                                   const size_t number_of_points) {
+  std::vector<double> result(number_of_points);
+  for (size_t i = 0; i < number_of_points; ++i) {
+    result[i] = lower + (upper - lower) * static_cast<double>(i) /
+                            static_cast<double>(number_of_points - 1);
+  }
+  return result;
+}
+
+// A table of an ideal gas with eps = T and p = rho T. Only the layout and size
+// of the table matter for the cost of the lookups.
+const Eos& equation_of_state() {
+  static const Eos eos = []() {
+    const auto electron_fraction =
+        uniform_points(min_electron_fraction, max_electron_fraction,
+                       number_of_electron_fractions);
+    const auto log_density = uniform_points(
+        std::log(min_density), std::log(max_density), number_of_log_densities);
+    const auto log_temperature =
+        uniform_points(std::log(min_temperature), std::log(max_temperature),
+                       number_of_log_temperatures);
+    std::vector<double> table_data(number_of_electron_fractions *
+                                   number_of_log_densities *
+                                   number_of_log_temperatures *
+                                   Eos::NumberOfVars);
+    // The temperature varies fastest, then the density
+    for (size_t i_ye = 0; i_ye < number_of_electron_fractions; ++i_ye) {
+      for (size_t i_rho = 0; i_rho < number_of_log_densities; ++i_rho) {
+        for (size_t i_t = 0; i_t < number_of_log_temperatures; ++i_t) {
+          double* const table_point =
+              &table_data[Eos::NumberOfVars *
+                          (i_t + number_of_log_temperatures *
+                                     (i_rho + number_of_log_densities *
+                                                  i_ye))];
+          table_point[Eos::Epsilon] = log_temperature[i_t];
+          table_point[Eos::Pressure] =
+              log_density[i_rho] + log_temperature[i_t];
+          table_point[Eos::CsSquared] = 0.1;
+          table_point[Eos::DeltaMu] = 0.0;
+        }
+      }
+    }
+    return Eos{electron_fraction, log_density, log_temperature,
+               std::move(table_data), 0.0, 1.0};
+  }();
+  return eos;
+}
+
+// Points scattered over the whole table so the lookups aren't cache-friendly,
+// as is the case for a neutron star spanning many orders of magnitude in
+// density
+struct Points {
+  explicit Points(const size_t number_of_points)
+      : electron_fraction(number_of_points),
+        rest_mass_density(number_of_points),
+        temperature(number_of_points) {
+    // Quasi-random sequences using the fractional parts of multiples of
+    // irrational numbers
+    const auto fraction = [](const size_t i, const double step) {
+      const double x = static_cast<double>(i + 1) * step;
+      return x - std::floor(x);
+    };
+    for (size_t i = 0; i < number_of_points; ++i) {
+      get(electron_fraction)[i] =
+          min_electron_fraction +
+          (max_electron_fraction - min_electron_fraction) *
+              (0.05 + 0.9 * fraction(i, std::sqrt(2.0)));
+      get(rest_mass_density)[i] =
+          min_density *
+          std::pow(max_density / min_density,
+                   0.05 + 0.9 * fraction(i, 0.5 * (1.0 + std::sqrt(5.0))));
+      get(temperature)[i] =
+          min_temperature * std::pow(max_temperature / min_temperature,
+                                     0.05 + 0.9 * fraction(i, M_PI));
+    }
+  }
+
+  Scalar<DataVector> electron_fraction;
+  Scalar<DataVector> rest_mass_density;
+  Scalar<DataVector> temperature;
+};
+
+void bench_tabulated_pressure(benchmark::State& state) {  // NOLINT
+  const auto& eos = equation_of_state();
+  const Points points{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(eos.pressure_from_density_and_temperature(
+        points.rest_mass_density, points.temperature,
+        points.electron_fraction));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bench_tabulated_pressure)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+
+void bench_tabulated_specific_internal_energy(  // NOLINT
+    benchmark::State& state) {
+  const auto& eos = equation_of_state();
+  const Points points{static_cast<size_t>(state.range(0))};
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(
+        eos.specific_internal_energy_from_density_and_temperature(
+            points.rest_mass_density, points.temperature,
+            points.electron_fraction));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bench_tabulated_specific_internal_energy)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+
+// Inverting the table for the temperature requires a root find, which is what
+// primitive recovery does at every point
+void bench_tabulated_temperature(benchmark::State& state) {  // NOLINT
+  const auto& eos = equation_of_state();
+  const Points points{static_cast<size_t>(state.range(0))};
+  const auto specific_internal_energy =
+      eos.specific_internal_energy_from_density_and_temperature(
+          points.rest_mass_density, points.temperature,
+          points.electron_fraction);
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(eos.temperature_from_density_and_energy(
+        points.rest_mass_density, specific_internal_energy,
+        points.electron_fraction));
+  }
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(bench_tabulated_temperature)  // NOLINT
+    ->RangeMultiplier(8)
+    ->Range(64, 32768);
+}  // namespace
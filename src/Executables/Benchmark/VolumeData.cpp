@@ -0,0 +1,81 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wredundant-decls"
+#include <benchmark/benchmark.h>
+#pragma GCC diagnostic pop
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "NumericalAlgorithms/Spectral/Spectral.hpp"
+#include "Utilities/FileSystem.hpp"
+
+namespace {
+// The coordinates and a few scalars and vectors per element, roughly what a
+// hydro simulation writes for visualization
+const std::vector<std::string> component_names{
+    "InertialCoordinates_x", "InertialCoordinates_y", "InertialCoordinates_z",
+    "RestMassDensity",       "Pressure",              "Temperature",
+    "SpatialVelocity_x",     "SpatialVelocity_y",     "SpatialVelocity_z",
+    "DivergenceCleaningField"};
+
+// Writes the volume data of `state.range(0)` elements with 6^3 points each to
+// an H5 file, reopening the file for every observation like the observers do.
+// Every iteration adds an observation to the same file, so the number of
+// iterations is fixed to keep the file small.
+void bench_write_volume_data(benchmark::State& state) {  // NOLINT
+  const std::string file_name{"BenchmarkVolumeData.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  const auto number_of_elements = static_cast<size_t>(state.range(0));
+  const Mesh<3> mesh{6, Spectral::Basis::Legendre,
+                     Spectral::Quadrature::GaussLobatto};
+  std::vector<ElementVolumeData> elements{};
+  elements.reserve(number_of_elements);
+  for (size_t i = 0; i < number_of_elements; ++i) {
+    std::vector<TensorComponent> components{};
+    components.reserve(component_names.size());
+    for (const auto& name : component_names) {
+      components.emplace_back(
+          name, DataVector(mesh.number_of_grid_points(),
+                           static_cast<double>(i + components.size())));
+    }
+    elements.emplace_back(ElementId<3>{i}, std::move(components), mesh);
+  }
+
+  size_t observation_id = 0;
+  for (auto _ : state) {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file{file_name, true};
+    auto& volume_data = h5_file.try_insert<h5::VolumeData>("/element_data");
+    volume_data.write_volume_data(observation_id,
+                                  static_cast<double>(observation_id),
+                                  elements);
+    h5_file.close_current_object();
+    ++observation_id;
+  }
+  state.SetBytesProcessed(
+      state.iterations() *
+      static_cast<int64_t>(number_of_elements * component_names.size() *
+                           mesh.number_of_grid_points() * sizeof(double)));
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+BENCHMARK(bench_write_volume_data)  // NOLINT
+    ->RangeMultiplier(4)
+    ->Range(8, 512)
+    ->Iterations(20)
+    ->Unit(benchmark::kMillisecond);
+}  // namespace
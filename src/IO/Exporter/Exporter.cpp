@@ -4,11 +4,14 @@
 #include "IO/Exporter/Exporter.hpp"
 
 #include <csignal>  // For Blaze error handling without PCH
+#include <mutex>
+#include <vector>
 #ifdef _OPENMP
 #include <omp.h>
 #endif  // _OPENMP
 
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSpatialIndex.hpp"
 #include "Domain/Creators/RegisterDerivedWithCharm.hpp"
 #include "Domain/Creators/TimeDependence/RegisterDerivedWithCharm.hpp"
 #include "Domain/Domain.hpp"
@@ -148,6 +151,25 @@ struct SelectObservation {
   const h5::VolumeData& volfile;
 };
 
+// Returns the spatial index of the `domain`, whose serialization is
+// `serialized_domain`. Building the index maps a lattice of points through
+// every block, so the index of the most recently used domain is kept and
+// reused as long as the volume files hold the same domain, e.g. when
+// interpolating to many observations of a run.
+template <size_t Dim>
+domain::BlockSpatialIndex<Dim> spatial_index_for_domain(
+    const std::vector<char>& serialized_domain, const Domain<Dim>& domain) {
+  static std::mutex cache_mutex{};
+  static std::vector<char> cached_serialized_domain{};
+  static domain::BlockSpatialIndex<Dim> cached_spatial_index{};
+  const std::lock_guard lock(cache_mutex);
+  if (serialized_domain != cached_serialized_domain) {
+    cached_spatial_index = domain::BlockSpatialIndex<Dim>{domain};
+    cached_serialized_domain = serialized_domain;
+  }
+  return cached_spatial_index;
+}
+
 }  // namespace
 
 template <size_t Dim>
@@ -204,8 +226,9 @@ std::vector<std::vector<double>> interpolate_to_points(
   const size_t obs_id =
       std::visit(SelectObservation{first_volfile}, observation);
   // Get domain, time, functions of time
-  const auto domain =
-      deserialize<Domain<Dim>>(first_volfile.get_domain(obs_id)->data());
+  const std::vector<char> serialized_domain =
+      first_volfile.get_domain(obs_id).value();
+  const auto domain = deserialize<Domain<Dim>>(serialized_domain.data());
   const auto time_and_fot = [&first_volfile, &obs_id, &domain]() {
     if (domain.is_time_dependent()) {
       return std::make_pair(
@@ -233,17 +256,28 @@ std::vector<std::vector<double>> interpolate_to_points(
 
   // Look up block logical coordinates for all target points by mapping them
   // through the domain. This is the most expensive part of the function, so we
-  // parallelize the loop.
+  // parallelize the loop and skip blocks whose bounding box doesn't contain
+  // the point.
+  auto spatial_index = spatial_index_for_domain(serialized_domain, domain);
+  if (domain.is_time_dependent()) {
+    spatial_index.update(domain, time, functions_of_time);
+  }
   std::vector<BlockLogicalCoords<Dim>> block_logical_coords(num_target_points);
 #pragma omp parallel num_threads(resolved_num_threads)
   {
     tnsr::I<double, Dim, Frame::Inertial> target_point{};
+    std::array<double, Dim> target_point_array{};
 #pragma omp for
     for (size_t s = 0; s < num_target_points; ++s) {
       for (size_t d = 0; d < Dim; ++d) {
         target_point.get(d) = gsl::at(target_points, d)[s];
+        gsl::at(target_point_array, d) = gsl::at(target_points, d)[s];
       }
       for (const auto& block : domain.blocks()) {
+        if (not spatial_index.template may_contain<Frame::Inertial>(
+                block.id(), target_point_array, time)) {
+          continue;
+        }
         auto x_logical = block_logical_coordinates_single_point(
             target_point, block, time, functions_of_time);
         if (x_logical.has_value()) {
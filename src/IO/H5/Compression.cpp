@@ -0,0 +1,87 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/H5/Compression.hpp"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <pup.h>
+#include <pup_stl.h>
+#include <type_traits>
+
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/GenerateInstantiations.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/PupStlCpp17.hpp"
+
+namespace h5 {
+void Compression::pup(PUP::er& p) {
+  p | chunk_bytes;
+  p | deflate_level;
+  p | shuffle;
+  p | max_relative_error;
+}
+
+bool operator==(const Compression& lhs, const Compression& rhs) {
+  return lhs.chunk_bytes == rhs.chunk_bytes and
+         lhs.deflate_level == rhs.deflate_level and
+         lhs.shuffle == rhs.shuffle and
+         lhs.max_relative_error == rhs.max_relative_error;
+}
+
+bool operator!=(const Compression& lhs, const Compression& rhs) {
+  return not(lhs == rhs);
+}
+
+template <typename T>
+void round_mantissa(const gsl::span<T> data, const double max_relative_error) {
+  static_assert(std::numeric_limits<T>::is_iec559);
+  using Bits = std::conditional_t<sizeof(T) == 8, uint64_t, uint32_t>;
+  static_assert(sizeof(Bits) == sizeof(T));
+  ASSERT(max_relative_error > 0.0,
+         "The maximum relative error must be positive, not "
+             << max_relative_error);
+  // Explicitly stored mantissa bits
+  constexpr int mantissa_bits = std::numeric_limits<T>::digits - 1;
+  // Rounding to the nearest value with `kept_bits` mantissa bits has a relative
+  // error of at most 2^-(kept_bits + 1)
+  const int kept_bits = std::clamp(
+      static_cast<int>(std::ceil(-std::log2(max_relative_error))) - 1, 0,
+      mantissa_bits);
+  if (kept_bits == mantissa_bits) {
+    return;
+  }
+  const int dropped_bits = mantissa_bits - kept_bits;
+  const Bits half_of_dropped = Bits{1} << (dropped_bits - 1);
+  const Bits kept_mask = ~((Bits{1} << dropped_bits) - 1);
+  constexpr Bits exponent_mask =
+      ((Bits{1} << (8 * sizeof(T) - 1 - mantissa_bits)) - 1) << mantissa_bits;
+  for (T& value : data) {
+    const auto bits = std::bit_cast<Bits>(value);
+    if ((bits & exponent_mask) == exponent_mask) {
+      // Infinity or NaN
+      continue;
+    }
+    // A carry out of the mantissa correctly increments the exponent
+    auto rounded = (bits + half_of_dropped) & kept_mask;
+    if ((rounded & exponent_mask) == exponent_mask) {
+      // Rounding up overflowed to infinity, so round down instead
+      rounded = bits & kept_mask;
+    }
+    value = std::bit_cast<T>(rounded);
+  }
+}
+
+#define DTYPE(data) BOOST_PP_TUPLE_ELEM(0, data)
+
+#define INSTANTIATE(_, data) \
+  template void round_mantissa(gsl::span<DTYPE(data)>, double);
+
+GENERATE_INSTANTIATIONS(INSTANTIATE, (float, double))
+
+#undef INSTANTIATE
+#undef DTYPE
+}  // namespace h5
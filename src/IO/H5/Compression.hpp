@@ -0,0 +1,79 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+/// \file
+/// Defines how datasets are chunked, compressed, and quantized on disk
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace h5 {
+/*!
+ * \ingroup HDF5Group
+ * \brief How a dataset is stored in an H5 file.
+ *
+ * Datasets with `deflate_level` or `shuffle` set are written in chunks of
+ * roughly `chunk_bytes` bytes and compressed with the corresponding HDF5
+ * filters. Setting the chunk size to a power of 2 is important for reducing
+ * the cost of writing to disk. Both filters are part of every HDF5
+ * installation, so compressed datasets are read transparently by any HDF5
+ * reader, including h5py. If a filter is not available when writing, the data
+ * is written uncompressed.
+ *
+ * If `max_relative_error` is set, floating point data is rounded to the fewest
+ * mantissa bits that keep the relative error of every value below
+ * `max_relative_error` before it is written (see `h5::round_mantissa`). This is
+ * lossy, but the zeroed trailing bits make the data compress much better with
+ * the shuffle and deflate filters. Since the data is still stored as regular
+ * floating point numbers, reading it requires no special handling. Rounding is
+ * applied by the `h5::VolumeData` tensor component writers.
+ *
+ * The default stores datasets with deflate level 5 and the shuffle filter.
+ */
+struct Compression {
+  /// Target number of bytes in a chunk
+  size_t chunk_bytes = 131'072;
+  /// Deflate (gzip) compression level between 0 and 9, where 0 disables the
+  /// filter
+  unsigned int deflate_level = 5;
+  /// Shuffle the bytes of the values before compressing them, which groups
+  /// bytes of similar significance together
+  bool shuffle = true;
+  /// Round floating point data to the precision needed to keep this relative
+  /// error
+  std::optional<double> max_relative_error = std::nullopt;
+
+  /// Datasets written contiguously, without filters
+  static constexpr Compression none() {
+    return {131'072, 0, false, std::nullopt};
+  }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+};
+
+bool operator==(const Compression& lhs, const Compression& rhs);
+bool operator!=(const Compression& lhs, const Compression& rhs);
+
+/*!
+ * \ingroup HDF5Group
+ * \brief Rounds the mantissa of every value in `data` to the fewest bits that
+ * keep the relative rounding error at or below `max_relative_error`.
+ *
+ * The trailing bits of the mantissa are set to zero, rounding to the nearest
+ * representable value. Infinities and NaNs are left unchanged. Subnormal values
+ * have fewer significant bits, so their relative error can be larger.
+ */
+template <typename T>
+void round_mantissa(gsl::span<T> data, double max_relative_error);
+}  // namespace h5
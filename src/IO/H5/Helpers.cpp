@@ -129,20 +129,67 @@ bool types_equal(const hid_t dtype1, const hid_t dtype2) {
   return equal > 0;
 }
 
-template <typename T>
-void write_data(const hid_t group_id, const std::vector<T>& data,
-                const std::vector<size_t>& extents, const std::string& name,
-                const bool overwrite_existing) {
+namespace {
+bool filter_available(const H5Z_filter_t filter) {
+  if (not static_cast<bool>(H5Zfilter_avail(filter))) {
+    return false;
+  }
+  unsigned int filter_info = 0;
+  const auto status = H5Zget_filter_info(filter, &filter_info);
+  return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
+         (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
+}
+
+// Returns the dataset creation property list for the `compression`, which must
+// be closed by the caller if it isn't the default
+hid_t dataset_creation_properties(const std::vector<size_t>& extents,
+                                  const size_t bytes_per_value,
+                                  const Compression& compression,
+                                  const std::string& name) {
+  // Check for available filters and only use those that are available
+  const bool use_gzip_filter = compression.deflate_level > 0 and
+                               filter_available(H5Z_FILTER_DEFLATE);
+  const bool use_shuffle_filter =
+      compression.shuffle and filter_available(H5Z_FILTER_SHUFFLE);
+  // We can't compress a single number. Since there's not much to reduce anyway,
+  // we just skip compression.
+  if (extents.empty() or not(use_gzip_filter or use_shuffle_filter)) {
+    return h5::h5p_default();
+  }
+  ASSERT(compression.deflate_level <= 9,
+         "The deflate level must be between 0 and 9, not "
+             << compression.deflate_level);
   std::vector<hsize_t> chunk_size(extents.size());
   for (size_t i = 0; i < chunk_size.size(); ++i) {
-    // Setting the target number of bytes per chunk to a power of 2 is important
-    // for reducing the cost of writing to disk. Setting to a non-power of 2
-    // increases the compression overhead by ~>10x.
-    constexpr size_t target_number_of_bytes_per_chunk = 131'072;
-    chunk_size[i] = target_number_of_bytes_per_chunk / sizeof(T) > extents[i]
-                        ? extents[i]
-                        : target_number_of_bytes_per_chunk / sizeof(T);
+    chunk_size[i] = std::clamp(compression.chunk_bytes / bytes_per_value,
+                               size_t{1}, extents[i]);
   }
+  const hid_t property_list = H5Pcreate(H5P_DATASET_CREATE);
+  CHECK_H5(property_list,
+           "Failed to create property list for dataset " << name);
+  if (use_shuffle_filter) {
+    CHECK_H5(H5Pset_shuffle(property_list),
+             "Failed to enable shuffle filter on dataset " << name);
+  }
+  if (use_gzip_filter) {
+    CHECK_H5(H5Pset_deflate(property_list, compression.deflate_level),
+             "Failed to enable gzip filter on dataset " << name);
+  }
+  CHECK_H5(H5Pset_chunk(property_list, static_cast<int>(chunk_size.size()),
+                        chunk_size.data()),
+           "Failed to set chunk size on dataset " << name);
+  CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
+           "Failed to disable setting default values on dataset creation for "
+           "dataset "
+               << name);
+  return property_list;
+}
+}  // namespace
+
+template <typename T>
+void write_data(const hid_t group_id, const std::vector<T>& data,
+                const std::vector<size_t>& extents, const std::string& name,
+                const bool overwrite_existing, const Compression& compression) {
   ASSERT(alg::none_of(extents, [](const size_t extent) { return extent == 0; }),
          "Got zero extent when trying to write data.");
 
@@ -150,45 +197,8 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
   const hid_t space_id = H5Screate_simple(dims.size(), dims.data(), nullptr);
   CHECK_H5(space_id, "Failed to create dataspace");
   const hid_t contained_type = h5::h5_type<tt::get_fundamental_type_t<T>>();
-
-  // Check for available filters and write with GZIP+shuffle if available
-  const bool use_gzip_filter = []() {
-    if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_DEFLATE))) {
-      return false;
-    }
-    unsigned int filter_info = 0;
-    const auto status = H5Zget_filter_info(H5Z_FILTER_DEFLATE, &filter_info);
-    return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
-           (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
-  }();
-  const bool use_shuffle_filter = []() {
-    if (not static_cast<bool>(H5Zfilter_avail(H5Z_FILTER_SHUFFLE))) {
-      return false;
-    }
-    unsigned int filter_info = 0;
-    const auto status = H5Zget_filter_info(H5Z_FILTER_SHUFFLE, &filter_info);
-    return status >= 0 and (filter_info & H5Z_FILTER_CONFIG_ENCODE_ENABLED) and
-           (filter_info & H5Z_FILTER_CONFIG_DECODE_ENABLED);
-  }();
-
-  hid_t property_list = h5::h5p_default();
-  // We can't compress a single number. Since there's not much to reduce anyway,
-  // we just skip compression.
-  if (not extents.empty() and use_gzip_filter) {
-    property_list = H5Pcreate(H5P_DATASET_CREATE);
-    if (use_shuffle_filter) {
-      CHECK_H5(H5Pset_shuffle(property_list),
-               "Failed to enable shuffle filter on dataset " << name);
-    }
-    CHECK_H5(H5Pset_deflate(property_list, 5),
-             "Failed to enable gzip filter on dataset " << name);
-    CHECK_H5(H5Pset_chunk(property_list, chunk_size.size(), chunk_size.data()),
-             "Failed to set chunk size on dataset " << name);
-    CHECK_H5(H5Pset_fill_time(property_list, H5D_FILL_TIME_NEVER),
-             "Failed to disable setting default values on dataset creation for "
-             "dataset "
-                 << name);
-  }
+  const hid_t property_list =
+      dataset_creation_properties(extents, sizeof(T), compression, name);
 
   if (H5Lexists(group_id, name.c_str(), h5::h5p_default()) != 0) {
     if (not overwrite_existing) {
@@ -206,16 +216,23 @@ void write_data(const hid_t group_id, const std::vector<T>& data,
   CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
                     h5::h5p_default(), static_cast<const void*>(data.data())),
            "Failed to write data to dataset");
+  if (property_list != h5::h5p_default()) {
+    CHECK_H5(H5Pclose(property_list),
+             "Failed to close property list for dataset " << name);
+  }
   CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
 
 void write_data(const hid_t group_id, const DataVector& data,
-                const std::string& name, const bool overwrite_existing) {
+                const std::string& name, const bool overwrite_existing,
+                const Compression& compression) {
   const auto number_of_points = static_cast<hsize_t>(data.size());
   const hid_t space_id = H5Screate_simple(1, &number_of_points, nullptr);
   CHECK_H5(space_id, "Failed to create dataspace");
   const hid_t contained_type = h5::h5_type<double>();
+  const hid_t property_list = dataset_creation_properties(
+      {data.size()}, sizeof(double), compression, name);
   if (H5Lexists(group_id, name.c_str(), h5::h5p_default()) != 0) {
     if (not overwrite_existing) {
       ERROR("Dataset already exists with name '" << name << "'.");
@@ -227,11 +244,15 @@ void write_data(const hid_t group_id, const DataVector& data,
   }
   const hid_t dataset_id =
       H5Dcreate2(group_id, name.c_str(), contained_type, space_id,
-                 h5::h5p_default(), h5::h5p_default(), h5::h5p_default());
+                 h5::h5p_default(), property_list, h5::h5p_default());
   CHECK_H5(dataset_id, "Failed to create dataset");
   CHECK_H5(H5Dwrite(dataset_id, contained_type, h5::h5s_all(), h5::h5s_all(),
                     h5::h5p_default(), static_cast<const void*>(data.data())),
            "Failed to write data to dataset");
+  if (property_list != h5::h5p_default()) {
+    CHECK_H5(H5Pclose(property_list),
+             "Failed to close property list for dataset " << name);
+  }
   CHECK_H5(H5Sclose(space_id), "Failed to close dataspace");
   CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
 }
@@ -727,7 +748,7 @@ template Index<3> read_extents<3>(const hid_t group_id,
   template void write_data<TYPE(DATA)>(                            \
       const hid_t group_id, const std::vector<TYPE(DATA)>& data,   \
       const std::vector<size_t>& extents, const std::string& name, \
-      bool overwrite_existing);
+      bool overwrite_existing, const Compression& compression);
 
 GENERATE_INSTANTIATIONS(INSTANTIATE_WRITE_DATA,
                         (float, double, int, unsigned int, long, unsigned long,
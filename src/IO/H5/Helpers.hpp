@@ -13,6 +13,7 @@
 #include <vector>
 
 #include "DataStructures/Index.hpp"
+#include "IO/H5/Compression.hpp"
 
 /// \cond
 class DataVector;
@@ -28,19 +29,28 @@ bool types_equal(hid_t dtype1, hid_t dtype2);
 /*!
  * \ingroup HDF5Group
  * \brief Write a std::vector named `name` to the group `group_id`
+ *
+ * The dataset is chunked and filtered as specified by the `compression`. The
+ * `h5::Compression::max_relative_error` is ignored, the data is written as is.
  */
 template <typename T>
 void write_data(hid_t group_id, const std::vector<T>& data,
                 const std::vector<size_t>& extents,
                 const std::string& name = "scalar",
-                const bool overwrite_existing = false);
+                const bool overwrite_existing = false,
+                const Compression& compression = {});
 
 /*!
  * \ingroup HDF5Group
  * \brief Write a DataVector named `name` to the group `group_id`
+ *
+ * The dataset is written contiguously unless `compression` enables filters.
+ * The `h5::Compression::max_relative_error` is ignored, the data is written as
+ * is.
  */
 void write_data(hid_t group_id, const DataVector& data, const std::string& name,
-                const bool overwrite_existing = false);
+                const bool overwrite_existing = false,
+                const Compression& compression = Compression::none());
 
 /*!
  * \ingroup HDF5Group
@@ -3,11 +3,14 @@
 
 #include "IO/H5/Python/VolumeData.hpp"
 
+#include <cstddef>
+#include <optional>
 #include <pybind11/pybind11.h>
 #include <pybind11/stl.h>
 #include <string>
 
 #include "DataStructures/DataVector.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
 
@@ -15,6 +18,23 @@ namespace py = pybind11;
 
 namespace py_bindings {
 void bind_h5vol(py::module& m) {
+  py::class_<h5::Compression>(m, "Compression")
+      .def(py::init([](const size_t chunk_bytes,
+                       const unsigned int deflate_level, const bool shuffle,
+                       const std::optional<double> max_relative_error) {
+             return h5::Compression{chunk_bytes, deflate_level, shuffle,
+                                    max_relative_error};
+           }),
+           py::arg("chunk_bytes") = h5::Compression{}.chunk_bytes,
+           py::arg("deflate_level") = h5::Compression{}.deflate_level,
+           py::arg("shuffle") = h5::Compression{}.shuffle,
+           py::arg("max_relative_error") = std::nullopt)
+      .def_static("none", &h5::Compression::none)
+      .def_readwrite("chunk_bytes", &h5::Compression::chunk_bytes)
+      .def_readwrite("deflate_level", &h5::Compression::deflate_level)
+      .def_readwrite("shuffle", &h5::Compression::shuffle)
+      .def_readwrite("max_relative_error",
+                     &h5::Compression::max_relative_error);
   // Wrapper for basic H5VolumeData operations
   py::class_<h5::VolumeData>(m, "H5Vol")
       .def_static("extension", &h5::VolumeData::extension)
@@ -24,13 +44,16 @@ void bind_h5vol(py::module& m) {
       .def("write_volume_data", &h5::VolumeData::write_volume_data,
            py::arg("observation_id"), py::arg("observation_value"),
            py::arg("elements"), py::arg("serialized_domain") = std::nullopt,
-           py::arg("serialized_functions_of_time") = std::nullopt)
+           py::arg("serialized_functions_of_time") = std::nullopt,
+           py::arg("compression") = h5::Compression{})
       .def("write_tensor_component",
            py::overload_cast<size_t, const std::string&, const DataVector&,
-                             bool>(&h5::VolumeData::write_tensor_component),
+                             bool, const h5::Compression&>(
+               &h5::VolumeData::write_tensor_component),
            py::arg("observation_id"), py::arg("component_name"),
            py::arg("contiguous_tensor_data"),
-           py::arg("overwrite_existing") = false)
+           py::arg("overwrite_existing") = false,
+           py::arg("compression") = h5::Compression::none())
       .def("list_observation_ids", &h5::VolumeData::list_observation_ids)
       .def("get_observation_value", &h5::VolumeData::get_observation_value,
            py::arg("observation_id"))
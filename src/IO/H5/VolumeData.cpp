@@ -18,6 +18,7 @@
 #include "DataStructures/DataVector.hpp"
 #include "IO/Connectivity.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/ExtendConnectivityHelpers.hpp"
 #include "IO/H5/Header.hpp"
 #include "IO/H5/Helpers.hpp"
@@ -187,7 +188,8 @@ void VolumeData::write_volume_data(
     const size_t observation_id, const double observation_value,
     const std::vector<ElementVolumeData>& elements,
     const std::optional<std::vector<char>>& serialized_domain,
-    const std::optional<std::vector<char>>& serialized_functions_of_time) {
+    const std::optional<std::vector<char>>& serialized_functions_of_time,
+    const Compression& compression) {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
@@ -246,8 +248,8 @@ void VolumeData::write_volume_data(
     }
 
     const auto fill_and_write_contiguous_tensor_data =
-        [&bases, &component_name, &dim, &elements, &grid_names, i,
-         &observation_group, &quadratures, &total_connectivity,
+        [&bases, &component_name, &compression, &dim, &elements, &grid_names,
+         i, &observation_group, &quadratures, &total_connectivity,
          &pole_connectivity, &total_extents,
          &total_points_so_far](const auto contiguous_tensor_data_ptr) {
           for (const auto& element : elements) {
@@ -285,8 +287,13 @@ void VolumeData::write_volume_data(
                 std::get<type_from_variant>(tensor_component.data).begin(),
                 std::get<type_from_variant>(tensor_component.data).end());
           }  // for each element
+          if (compression.max_relative_error.has_value()) {
+            h5::round_mantissa(gsl::make_span(*contiguous_tensor_data_ptr),
+                               *compression.max_relative_error);
+          }
           h5::write_data(observation_group.id(), *contiguous_tensor_data_ptr,
-                         {contiguous_tensor_data_ptr->size()}, component_name);
+                         {contiguous_tensor_data_ptr->size()}, component_name,
+                         false, compression);
         };
 
     if (elements[0].tensor_components[i].data.index() == 0) {
@@ -381,24 +388,42 @@ void VolumeData::extend_connectivity_data(
 
 void VolumeData::write_tensor_component(
     const size_t observation_id, const std::string& component_name,
-    const DataVector& contiguous_tensor_data, const bool overwrite_existing) {
+    const DataVector& contiguous_tensor_data, const bool overwrite_existing,
+    const Compression& compression) {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
-  h5::write_data(observation_group.id(), contiguous_tensor_data, component_name,
-                 overwrite_existing);
+  if (compression.max_relative_error.has_value()) {
+    DataVector rounded_data = contiguous_tensor_data;
+    h5::round_mantissa(gsl::make_span(rounded_data),
+                       *compression.max_relative_error);
+    h5::write_data(observation_group.id(), rounded_data, component_name,
+                   overwrite_existing, compression);
+  } else {
+    h5::write_data(observation_group.id(), contiguous_tensor_data,
+                   component_name, overwrite_existing, compression);
+  }
 }
 
 void VolumeData::write_tensor_component(
     const size_t observation_id, const std::string& component_name,
     const std::vector<float>& contiguous_tensor_data,
-    const bool overwrite_existing) {
+    const bool overwrite_existing, const Compression& compression) {
   const std::string path = "ObservationId" + std::to_string(observation_id);
   detail::OpenGroup observation_group(volume_data_group_.id(), path,
                                       AccessType::ReadWrite);
-  h5::write_data(observation_group.id(), contiguous_tensor_data,
-                 {contiguous_tensor_data.size()}, component_name,
-                 overwrite_existing);
+  if (compression.max_relative_error.has_value()) {
+    std::vector<float> rounded_data = contiguous_tensor_data;
+    h5::round_mantissa(gsl::make_span(rounded_data),
+                       *compression.max_relative_error);
+    h5::write_data(observation_group.id(), rounded_data,
+                   {rounded_data.size()}, component_name, overwrite_existing,
+                   compression);
+  } else {
+    h5::write_data(observation_group.id(), contiguous_tensor_data,
+                   {contiguous_tensor_data.size()}, component_name,
+                   overwrite_existing, compression);
+  }
 }
 
 std::vector<size_t> VolumeData::list_observation_ids() const {
@@ -11,6 +11,7 @@
 #include <utility>
 #include <vector>
 
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Object.hpp"
 #include "IO/H5/OpenGroup.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
@@ -66,6 +67,14 @@ namespace h5 {
  * `h5::offset_and_length_for_grid` function to compute the offset into the
  * contiguous dataset that corresponds to a particular grid.
  *
+ * \par Compression
+ * The tensor component datasets are chunked and compressed as specified by the
+ * `h5::Compression` passed to the write functions. Optionally, the floating
+ * point data can be rounded to a given relative precision before it is
+ * written, which makes it compress much better. The data are still standard
+ * HDF5 datasets of floats or doubles, so all readers, including
+ * `get_data_by_element()` and the Python bindings, work unchanged.
+ *
  * \par Domain and FunctionsOfTime
  * A serialized representation of the domain and the functions of time can be
  * written into the subfile alongside the tensor data. Reconstructing the domain
@@ -112,12 +121,14 @@ class VolumeData : public h5::Object {
   /// domain and the functions of time into the subfile as well.
   ///
   /// All `elements` must contain the same tensor components in the same order.
+  /// The tensor components are stored as specified by the `compression`.
   void write_volume_data(
       size_t observation_id, double observation_value,
       const std::vector<ElementVolumeData>& elements,
       const std::optional<std::vector<char>>& serialized_domain = std::nullopt,
       const std::optional<std::vector<char>>& serialized_functions_of_time =
-          std::nullopt);
+          std::nullopt,
+      const Compression& compression = {});
 
   /// Overwrites the current connectivity dataset with a new one. This new
   /// connectivity dataset builds connectivity within each block in the domain
@@ -125,15 +136,20 @@ class VolumeData : public h5::Object {
   template <size_t SpatialDim>
   void extend_connectivity_data(const std::vector<size_t>& observation_ids);
 
-  void write_tensor_component(const size_t observation_id,
-                              const std::string& component_name,
-                              const DataVector& contiguous_tensor_data,
-                              bool overwrite_existing = false);
+  /// @{
+  /// Write a single tensor component that holds the data of all grids at the
+  /// `observation_id`, stored as specified by the `compression`.
+  void write_tensor_component(
+      const size_t observation_id, const std::string& component_name,
+      const DataVector& contiguous_tensor_data, bool overwrite_existing = false,
+      const Compression& compression = Compression::none());
 
   void write_tensor_component(const size_t observation_id,
                               const std::string& component_name,
                               const std::vector<float>& contiguous_tensor_data,
-                              bool overwrite_existing = false);
+                              bool overwrite_existing = false,
+                              const Compression& compression = {});
+  /// @}
 
   /// List all the integral observation ids in the subfile
   ///
@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <mutex>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace observers::ThreadedActions {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Blocks until all volume data staged in the
+ * `observers::AsyncVolumeWriter` of this node is on disk.
+ *
+ * Errors if writing any of the staged data failed. Invoke this action on the
+ * `observers::ObserverWriter` component. If volume data staging is enabled
+ * with `observers::Tags::VolumeDataStagingLimit`, the component invokes it on
+ * all nodes at every phase change and before the executable exits, because
+ * Charm++ does not destroy the writer (and so does not wait for the data) on
+ * exit.
+ */
+struct FlushVolumeData {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<DbTagsList>& box,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const gsl::not_null<Parallel::NodeLock*> node_lock) {
+    AsyncVolumeWriter* async_writer = nullptr;
+    {
+      const std::lock_guard hold_lock(*node_lock);
+      async_writer = &db::get_mutable_reference<Tags::AsyncVolumeWriter>(
+          make_not_null(&box));
+    }
+    // The writer is pointer stable and thread-safe, so we don't hold the node
+    // lock while waiting for the file system
+    async_writer->wait();
+  }
+};
+}  // namespace observers::ThreadedActions
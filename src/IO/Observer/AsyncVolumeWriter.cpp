@@ -0,0 +1,201 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <memory>
+#include <mutex>
+#include <pup.h>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace observers {
+namespace {
+size_t size_in_bytes(const std::vector<ElementVolumeData>& volume_data) {
+  size_t bytes = 0;
+  for (const auto& element : volume_data) {
+    for (const auto& component : element.tensor_components) {
+      bytes += std::visit(
+          [](const auto& data) {
+            return data.size() * sizeof(typename std::decay_t<
+                                        decltype(data)>::value_type);
+          },
+          component.data);
+    }
+  }
+  return bytes;
+}
+
+void write(AsyncVolumeWriter::Observation&& observation) {
+  const uint32_t version_number = 0;
+  h5::H5File<h5::AccessType::ReadWrite> h5_file{observation.file_name, true,
+                                                observation.input_source};
+  auto& volume_file = h5_file.try_insert<h5::VolumeData>(
+      observation.subfile_name, version_number);
+  volume_file.write_volume_data(
+      observation.observation_id, observation.observation_value,
+      observation.volume_data, observation.serialized_domain,
+      observation.serialized_functions_of_time, observation.compression);
+}
+}  // namespace
+
+struct AsyncVolumeWriter::State {
+  struct Job {
+    Observation observation;
+    Parallel::NodeLock* h5_file_lock;
+    size_t bytes;
+  };
+
+  State() = default;
+
+  State(const State&) = delete;
+  State& operator=(const State&) = delete;
+  State(State&&) = delete;
+  State& operator=(State&&) = delete;
+
+  ~State() {
+    if (not thread.joinable()) {
+      return;
+    }
+    {
+      const std::lock_guard hold_lock(mutex);
+      stop = true;
+    }
+    staged.notify_all();
+    thread.join();
+  }
+
+  // Runs on the writer thread. Swaps the staging buffer with `writing` so new
+  // observations can be staged while the previous ones are written.
+  void drain() {
+    std::vector<Job> writing{};
+    std::unique_lock lock(mutex);
+    while (true) {
+      staged.wait(lock, [this]() { return stop or not staging.empty(); });
+      if (staging.empty()) {
+        // Only reached when stopping with nothing left to write
+        return;
+      }
+      std::swap(writing, staging);
+      lock.unlock();
+      for (auto& job : writing) {
+        std::string error{};
+        try {
+          const std::lock_guard hold_lock(*job.h5_file_lock);
+          write(std::move(job.observation));
+        } catch (const std::exception& e) {
+          error = e.what();
+        }
+        // Free the data before reporting it as written
+        const size_t bytes = job.bytes;
+        job.observation = Observation{};
+        {
+          const std::lock_guard hold_lock(mutex);
+          staged_bytes -= bytes;
+          --pending;
+          if (not error.empty() and error_message.empty()) {
+            error_message = std::move(error);
+          }
+        }
+        written.notify_all();
+      }
+      writing.clear();
+      lock.lock();
+    }
+  }
+
+  std::mutex mutex{};
+  std::condition_variable staged{};
+  std::condition_variable written{};
+  std::vector<Job> staging{};
+  size_t staged_bytes{0};
+  size_t pending{0};
+  bool stop{false};
+  std::string error_message{};
+  // Started by the first call to `stage`
+  std::thread thread{};
+};
+
+AsyncVolumeWriter::AsyncVolumeWriter() : state_(std::make_unique<State>()) {}
+
+AsyncVolumeWriter::AsyncVolumeWriter(AsyncVolumeWriter&& rhs) noexcept =
+    default;
+
+AsyncVolumeWriter& AsyncVolumeWriter::operator=(
+    AsyncVolumeWriter&& rhs) noexcept = default;
+
+AsyncVolumeWriter::~AsyncVolumeWriter() = default;
+
+void AsyncVolumeWriter::stage(
+    Observation observation,
+    const gsl::not_null<Parallel::NodeLock*> h5_file_lock,
+    const size_t max_staged_bytes) {
+  ASSERT(state_ != nullptr, "Cannot stage data in a moved-from writer.");
+  const size_t bytes = size_in_bytes(observation.volume_data);
+  std::unique_lock lock(state_->mutex);
+  if (not state_->thread.joinable()) {
+    state_->thread = std::thread{[state = state_.get()]() { state->drain(); }};
+  }
+  state_->written.wait(lock, [this, &bytes, &max_staged_bytes]() {
+    return state_->pending == 0 or
+           state_->staged_bytes + bytes <= max_staged_bytes or
+           not state_->error_message.empty();
+  });
+  if (not state_->error_message.empty()) {
+    ERROR("Failed to write volume data in the background: "
+          << state_->error_message);
+  }
+  state_->staging.push_back(
+      State::Job{std::move(observation), h5_file_lock.get(), bytes});
+  state_->staged_bytes += bytes;
+  ++state_->pending;
+  lock.unlock();
+  state_->staged.notify_one();
+}
+
+void AsyncVolumeWriter::wait() {
+  if (state_ == nullptr) {
+    return;
+  }
+  std::unique_lock lock(state_->mutex);
+  state_->written.wait(lock, [this]() { return state_->pending == 0; });
+  if (not state_->error_message.empty()) {
+    ERROR("Failed to write volume data in the background: "
+          << state_->error_message);
+  }
+}
+
+size_t AsyncVolumeWriter::staged_bytes() const {
+  if (state_ == nullptr) {
+    return 0;
+  }
+  const std::lock_guard hold_lock(state_->mutex);
+  return state_->staged_bytes;
+}
+
+void AsyncVolumeWriter::pup(PUP::er& p) {
+  // Staged data isn't serialized, so it must be on disk before checkpointing
+  // or migrating
+  if (not p.isUnpacking()) {
+    wait();
+  }
+  size_t version = 0;
+  p | version;
+}
+}  // namespace observers
@@ -0,0 +1,106 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <vector>
+
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "Utilities/Gsl.hpp"
+
+/// \cond
+namespace Parallel {
+class NodeLock;
+}  // namespace Parallel
+namespace PUP {
+class er;
+}  // namespace PUP
+/// \endcond
+
+namespace observers {
+/*!
+ * \ingroup ObserversGroup
+ * \brief Writes volume data to disk on a background thread.
+ *
+ * `stage` moves a complete observation into a staging buffer and returns
+ * immediately. A dedicated thread, started on the first call to `stage`, swaps
+ * the staging buffer with a second one and writes the observations in it to
+ * their `h5::VolumeData` subfiles while new observations are staged. This way
+ * the threads running the simulation don't wait for the file system.
+ *
+ * The tensor data that is staged but not yet written is limited to the
+ * `max_staged_bytes` passed to `stage`. This provides back-pressure: `stage`
+ * blocks until enough data is written to stay within the limit. An observation
+ * that is larger than the limit on its own is still staged once everything
+ * else is written.
+ *
+ * HDF5 is not thread-safe, so the background thread holds the lock passed to
+ * `stage` (the `observers::Tags::H5FileLock`) while writing. `stage` may be
+ * called from multiple threads at once. Serializing the writer waits until all
+ * staged data is written. A deserialized writer starts a new thread when it is
+ * next used.
+ *
+ * \warning Callers must follow these locking rules:
+ * - Don't hold the `h5_file_lock` while calling `wait`, destroying or
+ *   serializing the writer, or calling `stage` when it may block for
+ *   back-pressure. The background thread needs the lock to make progress, so
+ *   this deadlocks.
+ * - Don't hold the node lock of the `observers::ObserverWriter` while calling
+ *   `stage` or `wait`. Both may block on the file system, and the other
+ *   threads on the node need the node lock to make progress. Since the writer
+ *   is thread-safe and not moved while in use, retrieve a pointer to it under
+ *   the node lock and call it after releasing the lock.
+ */
+class AsyncVolumeWriter {
+ public:
+  /// An observation to be written to an `h5::VolumeData` subfile
+  struct Observation {
+    /// Name of the H5 file, including the extension
+    std::string file_name{};
+    std::string input_source{};
+    std::string subfile_name{};
+    size_t observation_id{};
+    double observation_value{};
+    std::vector<ElementVolumeData> volume_data{};
+    std::optional<std::vector<char>> serialized_domain{};
+    std::optional<std::vector<char>> serialized_functions_of_time{};
+    h5::Compression compression{};
+  };
+
+  AsyncVolumeWriter();
+  AsyncVolumeWriter(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter& operator=(const AsyncVolumeWriter&) = delete;
+  AsyncVolumeWriter(AsyncVolumeWriter&& rhs) noexcept;
+  AsyncVolumeWriter& operator=(AsyncVolumeWriter&& rhs) noexcept;
+  /// Waits until all staged observations are written
+  ~AsyncVolumeWriter();
+
+  /// Hands the `observation` to the background thread, which holds
+  /// `h5_file_lock` while writing it. Blocks while the staged data would
+  /// exceed `max_staged_bytes`, so don't hold `h5_file_lock` when calling this
+  /// unless the observation fits within the limit.
+  void stage(Observation observation,
+             gsl::not_null<Parallel::NodeLock*> h5_file_lock,
+             size_t max_staged_bytes);
+
+  /// Blocks until all staged observations are written. Don't hold the
+  /// `h5_file_lock` passed to `stage` when calling this.
+  void wait();
+
+  /// The bytes of tensor data that are staged but not yet written
+  size_t staged_bytes() const;
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  struct State;
+
+  std::unique_ptr<State> state_;
+};
+}  // namespace observers
@@ -3,12 +3,15 @@
 
 #pragma once
 
+#include "IO/Observer/Actions/FlushVolumeData.hpp"
 #include "IO/Observer/Initialize.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Parallel/Algorithms/AlgorithmGroup.hpp"
 #include "Parallel/Algorithms/AlgorithmNodegroup.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
 #include "Parallel/Phase.hpp"
 #include "Parallel/PhaseDependentActionList.hpp"
@@ -46,12 +49,18 @@ struct Observer {
  * \ingroup ObserversGroup
  * \brief The nodegroup parallel component that is responsible for writing data
  * to disk.
+ *
+ * If volume data staging is enabled with
+ * `observers::Tags::VolumeDataStagingLimit`, volume data is written in the
+ * background (see `observers::ThreadedActions::ContributeVolumeDataToWriter`)
+ * and flushed to disk at every phase change and before the executable exits.
  */
 template <class Metavariables>
 struct ObserverWriter {
   using chare_type = Parallel::Algorithms::Nodegroup;
   using const_global_cache_tags =
       tmpl::list<Tags::ReductionFileName, Tags::VolumeFileName,
+                 Tags::VolumeDataStagingLimit, Tags::VolumeDataCompression,
                  ::Parallel::Tags::InputSource>;
   using metavariables = Metavariables;
   using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
@@ -63,6 +72,28 @@ struct ObserverWriter {
 
   static void execute_next_phase(
       const Parallel::Phase /*next_phase*/,
-      Parallel::CProxy_GlobalCache<Metavariables>& /*global_cache*/) {}
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    flush_volume_data(global_cache);
+  }
+
+  /// Returns `true` if the staged volume data is being flushed, so
+  /// `Parallel::Main` has to wait for quiescence before exiting
+  static bool execute_before_exit(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    return flush_volume_data(global_cache);
+  }
+
+ private:
+  static bool flush_volume_data(
+      Parallel::CProxy_GlobalCache<Metavariables>& global_cache) {
+    auto& local_cache = *Parallel::local_branch(global_cache);
+    if (not Parallel::get<Tags::VolumeDataStagingLimit>(local_cache)
+                .has_value()) {
+      return false;
+    }
+    Parallel::threaded_action<ThreadedActions::FlushVolumeData>(
+        Parallel::get_parallel_component<ObserverWriter>(local_cache));
+    return true;
+  }
 };
 }  // namespace observers
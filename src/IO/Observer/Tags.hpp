@@ -7,6 +7,7 @@
 #include <converse.h>
 #include <cstddef>
 #include <memory>
+#include <optional>
 #include <set>
 #include <string>
 #include <unordered_map>
@@ -15,12 +16,16 @@
 
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/DataVector.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/TensorData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
 #include "IO/Observer/ObservationId.hpp"
+#include "Options/Auto.hpp"
 #include "Options/String.hpp"
 #include "Parallel/ArrayComponentId.hpp"
 #include "Parallel/NodeLock.hpp"
 #include "Parallel/Reduction.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/PrettyType.hpp"
 
 namespace observers {
@@ -151,6 +156,13 @@ struct H5FileLock : db::SimpleTag {
   using type = Parallel::NodeLock;
 };
 
+/// Writes volume data to disk on a background thread when
+/// `observers::Tags::VolumeDataStagingLimit` enables it. See
+/// `observers::ThreadedActions::ContributeVolumeDataToWriter`.
+struct AsyncVolumeWriter : db::SimpleTag {
+  using type = observers::AsyncVolumeWriter;
+};
+
 /*!
  * \brief A string identifying observations related to the `Tag`.
  *
@@ -205,6 +217,57 @@ struct SurfaceFileName {
       "Name of the surface data file without extension"};
   using group = Group;
 };
+
+/// The bytes of volume data per node that may wait to be written on a
+/// background thread, or `None` to write volume data synchronously.
+struct VolumeDataStagingLimit {
+  using type = Options::Auto<size_t, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Bytes of volume data per node that may wait to be written to disk on a "
+      "background thread, or 'None' to write volume data synchronously. "
+      "Writing in the background frees the cores from waiting for the file "
+      "system, but buffers up to this many bytes of data in memory."};
+  using group = Group;
+};
+
+/// Groups option tags related to compressing volume data.
+struct VolumeDataCompression {
+  static constexpr Options::String help = {
+      "How volume data is compressed on disk. See h5::Compression."};
+  using group = Group;
+};
+
+/// The deflate (gzip) compression level of volume data.
+struct VolumeDataDeflateLevel {
+  static std::string name() { return "DeflateLevel"; }
+  using type = unsigned int;
+  static constexpr Options::String help = {
+      "Deflate (gzip) compression level between 0 and 9, where 0 disables "
+      "compression"};
+  static type upper_bound() { return 9; }
+  using group = VolumeDataCompression;
+};
+
+/// Whether to shuffle the bytes of volume data before compressing them.
+struct VolumeDataShuffle {
+  static std::string name() { return "Shuffle"; }
+  using type = bool;
+  static constexpr Options::String help = {
+      "Shuffle the bytes of the values before compressing them, which "
+      "improves the compression of floating point data"};
+  using group = VolumeDataCompression;
+};
+
+/// The relative error to which volume data is rounded before it is written.
+struct VolumeDataMaxRelativeError {
+  static std::string name() { return "MaxRelativeError"; }
+  using type = Options::Auto<double, Options::AutoLabel::None>;
+  static constexpr Options::String help = {
+      "Round the floating point values to the fewest mantissa bits that keep "
+      "this relative error, or 'None' to write them exactly. Rounding is "
+      "lossy, but makes the data compress much better."};
+  using group = VolumeDataCompression;
+};
 }  // namespace OptionTags
 
 namespace Tags {
@@ -264,5 +327,49 @@ struct SurfaceFileName : db::SimpleTag {
     return surface_file_name;
   }
 };
+
+/// \brief The bytes of volume data per node that may be staged in the
+/// `observers::AsyncVolumeWriter`, or `std::nullopt` if volume data is written
+/// synchronously.
+///
+/// See `observers::ThreadedActions::ContributeVolumeDataToWriter`.
+struct VolumeDataStagingLimit : db::SimpleTag {
+  using type = std::optional<size_t>;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::VolumeDataStagingLimit>;
+
+  static constexpr bool pass_metavariables = false;
+  static std::optional<size_t> create_from_options(
+      const std::optional<size_t>& staging_limit) {
+    return staging_limit;
+  }
+};
+
+/// \brief How volume data is chunked, compressed, and rounded on disk.
+///
+/// See `observers::ThreadedActions::ContributeVolumeDataToWriter`.
+struct VolumeDataCompression : db::SimpleTag {
+  using type = h5::Compression;
+  using option_tags =
+      tmpl::list<::observers::OptionTags::VolumeDataDeflateLevel,
+                 ::observers::OptionTags::VolumeDataShuffle,
+                 ::observers::OptionTags::VolumeDataMaxRelativeError>;
+
+  static constexpr bool pass_metavariables = false;
+  static h5::Compression create_from_options(
+      const unsigned int deflate_level, const bool shuffle,
+      const std::optional<double>& max_relative_error) {
+    if (max_relative_error.has_value() and *max_relative_error <= 0.0) {
+      ERROR_NO_TRACE(
+          "The MaxRelativeError of volume data must be positive, not "
+          << *max_relative_error);
+    }
+    h5::Compression compression{};
+    compression.deflate_level = deflate_level;
+    compression.shuffle = shuffle;
+    compression.max_relative_error = max_relative_error;
+    return compression;
+  }
+};
 }  // namespace Tags
 }  // namespace observers
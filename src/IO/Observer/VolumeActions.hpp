@@ -15,9 +15,11 @@
 #include "Domain/FunctionsOfTime/Tags.hpp"
 #include "Domain/Tags.hpp"
 #include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/TensorData.hpp"
 #include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
 #include "IO/Observer/Helpers.hpp"
 #include "IO/Observer/ObservationId.hpp"
 #include "IO/Observer/ObserverComponent.hpp"
@@ -157,12 +159,53 @@ void write_data(const std::string& h5_file_name,
                 const std::string& subfile_path,
                 const observers::ObservationId& observation_id,
                 std::vector<ElementVolumeData>&& volume_data);
+
+template <typename Metavariables>
+std::optional<size_t> volume_data_staging_limit(
+    const Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                             Tags::VolumeDataStagingLimit>) {
+    return Parallel::get<Tags::VolumeDataStagingLimit>(cache);
+  } else {
+    (void)cache;
+    return std::nullopt;
+  }
+}
+
+template <typename Metavariables>
+h5::Compression volume_data_compression(
+    const Parallel::GlobalCache<Metavariables>& cache) {
+  if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                             Tags::VolumeDataCompression>) {
+    return Parallel::get<Tags::VolumeDataCompression>(cache);
+  } else {
+    (void)cache;
+    return {};
+  }
+}
 }  // namespace VolumeActions_detail
 /*!
  * \ingroup ObserversGroup
  * \brief Move data to the observer writer for writing to disk.
  *
  * Once data from all cores is collected this action writes the data to disk.
+ *
+ * By default the data is written synchronously, so the core that collected the
+ * last contribution is blocked until the write finishes. If the
+ * `observers::Tags::VolumeDataStagingLimit` input-file option is set to a
+ * number of bytes, the data is instead handed to the
+ * `observers::AsyncVolumeWriter` in `observers::Tags::AsyncVolumeWriter` and
+ * written on a background thread. The core then only blocks if more than that
+ * many bytes of tensor data are waiting to be written. The
+ * `observers::ObserverWriter` waits for the staged data with
+ * `observers::ThreadedActions::FlushVolumeData` at every phase change and
+ * before the executable exits. If the option isn't in the global cache the
+ * data is written synchronously.
+ *
+ * The tensor data is chunked, compressed, and optionally rounded as specified
+ * by the `observers::Tags::VolumeDataCompression` input-file options, or by the
+ * default `h5::Compression` if they aren't in the global cache. The
+ * compression applies to all volume data written by the element observers.
  */
 struct ContributeVolumeDataToWriter {
   template <typename ParallelComponent, typename DbTagsList,
@@ -226,9 +269,16 @@ struct ContributeVolumeDataToWriter {
         volume_observers_contributed = nullptr;
     Parallel::NodeLock* volume_data_lock = nullptr;
     size_t observations_registered_with_id = std::numeric_limits<size_t>::max();
+    const std::optional<size_t> staging_limit =
+        VolumeActions_detail::volume_data_staging_limit(cache);
+    AsyncVolumeWriter* async_writer = nullptr;
 
     {
       const std::lock_guard hold_lock(*node_lock);
+      if (staging_limit.has_value()) {
+        async_writer = &db::get_mutable_reference<Tags::AsyncVolumeWriter>(
+            make_not_null(&box));
+      }
       db::mutate<TensorDataTag, Tags::ContributorsOfTensorData,
                  Tags::VolumeDataLock, Tags::H5FileLock>(
           [&observation_id, &observations_registered_with_id,
@@ -333,9 +383,9 @@ struct ContributeVolumeDataToWriter {
       if constexpr (std::is_same_v<tmpl::at_c<VolumeDataAtObsId, 1>,
                                    ElementVolumeData>) {
         volume_data_to_write.reserve(volume_data.size());
-        for (const auto& [id, element] : volume_data) {
+        for (auto& [id, element] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.push_back(element);
+          volume_data_to_write.push_back(std::move(element));
         }
       } else {
         size_t total_size = 0;
@@ -345,13 +395,59 @@ struct ContributeVolumeDataToWriter {
         }
         volume_data_to_write.reserve(total_size);
 
-        for (const auto& [id, vec_elements] : volume_data) {
+        for (auto& [id, vec_elements] : volume_data) {
           (void)id;  // avoid compiler warnings
-          volume_data_to_write.insert(volume_data_to_write.end(),
-                                      vec_elements.begin(), vec_elements.end());
+          volume_data_to_write.insert(
+              volume_data_to_write.end(),
+              std::make_move_iterator(vec_elements.begin()),
+              std::make_move_iterator(vec_elements.end()));
         }
       }
 
+      const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
+      auto& my_proxy =
+          Parallel::get_parallel_component<ParallelComponent>(cache);
+      const std::string h5_file_name =
+          file_prefix +
+          std::to_string(
+              Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
+          ".h5";
+      // Serialize domain. See `Domain` docs for details on the serialization.
+      // The domain is retrieved from the global cache using the standard
+      // domain tag. If more flexibility is required here later, then the
+      // domain can be passed along with the `ContributeVolumeData` action.
+      auto serialized_domain = serialize(
+          Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
+              cache));
+      auto serialized_functions_of_time =
+          [&cache]() -> std::optional<std::vector<char>> {
+        // Functions-of-time are in the _mutable_ global cache, so they aren't
+        // accessible through the DataBox by default
+        if constexpr (Parallel::is_in_global_cache<
+                          Metavariables, domain::Tags::FunctionsOfTime>) {
+          return serialize(get<domain::Tags::FunctionsOfTime>(cache));
+        } else {
+          (void)cache;
+          return std::nullopt;
+        }
+      }();
+
+      if (staging_limit.has_value()) {
+        // The background thread takes the H5FileLock when it writes the data,
+        // so we must not hold it here
+        ASSERT(async_writer != nullptr,
+               "Failed to set async_writer before staging the volume data");
+        async_writer->stage(
+            AsyncVolumeWriter::Observation{
+                h5_file_name, observers::input_source_from_cache(cache),
+                subfile_name, observation_id.hash(), observation_id.value(),
+                std::move(volume_data_to_write), std::move(serialized_domain),
+                std::move(serialized_functions_of_time),
+                VolumeActions_detail::volume_data_compression(cache)},
+            volume_file_lock, *staging_limit);
+        return;
+      }
+
       // Write to file. We use a separate node lock because writing can be
       // very time consuming (it's network dependent, depends on how full the
       // disks are, what other users are doing, etc.) and we want to be able
@@ -360,42 +456,16 @@ struct ContributeVolumeDataToWriter {
       const std::lock_guard hold_lock(*volume_file_lock);
       {
         // Scoping is for closing HDF5 file before we release the lock.
-        const auto& file_prefix = Parallel::get<Tags::VolumeFileName>(cache);
-        auto& my_proxy =
-            Parallel::get_parallel_component<ParallelComponent>(cache);
         h5::H5File<h5::AccessType::ReadWrite> h5file(
-            file_prefix +
-                std::to_string(
-                    Parallel::my_node<int>(*Parallel::local_branch(my_proxy))) +
-                ".h5",
-            true, observers::input_source_from_cache(cache));
+            h5_file_name, true, observers::input_source_from_cache(cache));
         constexpr size_t version_number = 0;
         auto& volume_file =
             h5file.try_insert<h5::VolumeData>(subfile_name, version_number);
-
-        // Serialize domain. See `Domain` docs for details on the serialization.
-        // The domain is retrieved from the global cache using the standard
-        // domain tag. If more flexibility is required here later, then the
-        // domain can be passed along with the `ContributeVolumeData` action.
-        const auto serialized_domain = serialize(
-            Parallel::get<domain::Tags::Domain<Metavariables::volume_dim>>(
-                cache));
-        const auto serialized_functions_of_time =
-            [&cache]() -> std::optional<std::vector<char>> {
-          // Functions-of-time are in the _mutable_ global cache, so they aren't
-          // accessible through the DataBox by default
-          if constexpr (Parallel::is_in_global_cache<
-                            Metavariables, domain::Tags::FunctionsOfTime>) {
-            return serialize(get<domain::Tags::FunctionsOfTime>(cache));
-          } else {
-            (void)cache;
-            return std::nullopt;
-          }
-        }();
         // Write the data to the file
         volume_file.write_volume_data(
             observation_id.hash(), observation_id.value(), volume_data_to_write,
-            serialized_domain, serialized_functions_of_time);
+            serialized_domain, serialized_functions_of_time,
+            VolumeActions_detail::volume_data_compression(cache));
       }
     }
   }
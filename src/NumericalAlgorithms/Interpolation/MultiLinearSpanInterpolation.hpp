@@ -6,14 +6,19 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstddef>
 #include <memory>
+#include <type_traits>
+#include <utility>
 
 #include "DataStructures/Index.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/Requires.hpp"
+#include "Utilities/Simd/Simd.hpp"
 #include "Utilities/TMPL.hpp"
 
 namespace intrp {
@@ -130,6 +135,29 @@ class MultiLinearSpanInterpolation {
                        std::make_index_sequence<Dimension>{});
   }
 
+  /// Number of points whose weights are computed at once by the batched
+  /// `interpolate`
+  static constexpr size_t batch_size = 64;
+
+  /*!
+   * \brief Interpolate the variables `VariablesToInterpolate` to many points
+   * at once.
+   *
+   * `target_points[d]` holds the `d`th coordinate of all points, and
+   * `results[i]` is filled with the `i`th variable in
+   * `VariablesToInterpolate` at all points. The points are processed in
+   * batches of `batch_size`: first the table indices and relative coordinates
+   * of all points in the batch are computed, using SIMD for uniformly spaced
+   * tables, and then all variables are gathered from the corners of the cell
+   * containing each point in a single pass. No memory is allocated.
+   */
+  template <size_t... VariablesToInterpolate>
+  void interpolate(
+      const std::array<gsl::span<double>, sizeof...(VariablesToInterpolate)>&
+          results,
+      const std::array<gsl::span<const double>, Dimension>& target_points)
+      const;
+
   MultiLinearSpanInterpolation() = default;
 
   MultiLinearSpanInterpolation(
@@ -178,6 +206,16 @@ class MultiLinearSpanInterpolation {
       return find_index_general(which_dimension, target_points);
     }
   }
+
+  /// Add the index of the cell containing each of the coordinates
+  /// `target_points` in dimension `which_dimension`, times `stride`, to
+  /// `cell_index` and compute the normalized coordinates of the points
+  /// relative to their cell
+  void add_cell_indices(
+      gsl::not_null<std::array<size_t, batch_size>*> cell_index,
+      gsl::not_null<std::array<double, batch_size>*> relative_coordinates,
+      size_t which_dimension, size_t stride,
+      gsl::span<const double> target_points) const;
 };
 
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
@@ -241,6 +279,151 @@ size_t MultiLinearSpanInterpolation<
   return current_index;
 }
 
+template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
+void MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
+                                  UniformSpacing>::
+    add_cell_indices(
+        const gsl::not_null<std::array<size_t, batch_size>*> cell_index,
+        const gsl::not_null<std::array<double, batch_size>*>
+            relative_coordinates,
+        const size_t which_dimension, const size_t stride,
+        const gsl::span<const double> target_points) const {
+  const size_t number_of_points = target_points.size();
+  if constexpr (UniformSpacing) {
+    using simd_type =
+        std::decay_t<decltype(simd::load_unaligned(target_points.data()))>;
+    constexpr size_t simd_width = simd::size<simd_type>();
+    const double lower_bound = x_[which_dimension][0];
+    const double inverse_spacing = inverse_spacing_[which_dimension];
+    const auto highest_cell =
+        static_cast<double>(number_of_points_[which_dimension] - 2);
+    // The cell indices are computed as doubles so they can be vectorized
+    std::array<double, batch_size> cell{};
+    const size_t vectorized_size =
+        number_of_points - number_of_points % simd_width;
+    for (size_t s = 0; s < vectorized_size; s += simd_width) {
+      const simd_type scaled_coordinate =
+          (simd::load_unaligned(&target_points[s]) - simd_type(lower_bound)) *
+          simd_type(inverse_spacing);
+      const simd_type cell_batch =
+          simd::min(simd::max(simd::floor(scaled_coordinate), simd_type(0.0)),
+                    simd_type(highest_cell));
+      simd::store_unaligned(&gsl::at(cell, s), cell_batch);
+      simd::store_unaligned(&gsl::at(*relative_coordinates, s),
+                            scaled_coordinate - cell_batch);
+    }
+    for (size_t s = vectorized_size; s < number_of_points; ++s) {
+      const double scaled_coordinate =
+          (target_points[s] - lower_bound) * inverse_spacing;
+      gsl::at(cell, s) = std::min(
+          std::max(std::floor(scaled_coordinate), 0.0), highest_cell);
+      gsl::at(*relative_coordinates, s) = scaled_coordinate - gsl::at(cell, s);
+    }
+    // Allow for roundoff in points that were clamped to the table bounds
+    // before being converted to table coordinates
+    [[maybe_unused]] constexpr double tolerance = 1.0e-10;
+    for (size_t s = 0; s < number_of_points; ++s) {
+      ASSERT(allow_extrapolation_below_data_[which_dimension] or
+                 gsl::at(*relative_coordinates, s) >= -tolerance,
+             "Interpolation exceeds lower table bounds.");
+      ASSERT(allow_extrapolation_abov_data_[which_dimension] or
+                 gsl::at(*relative_coordinates, s) <= 1.0 + tolerance,
+             "Interpolation exceeds upper table bounds.");
+      gsl::at(*cell_index, s) += stride * static_cast<size_t>(gsl::at(cell, s));
+    }
+  } else {
+    const auto& x = x_[which_dimension];
+    for (size_t s = 0; s < number_of_points; ++s) {
+      const size_t index =
+          find_index_general(which_dimension, target_points[s]);
+      gsl::at(*relative_coordinates, s) =
+          (target_points[s] - x[index]) / (x[index + 1] - x[index]);
+      gsl::at(*cell_index, s) += stride * index;
+    }
+  }
+}
+
+template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
+template <size_t... VariablesToInterpolate>
+void MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
+                                  UniformSpacing>::
+    interpolate(
+        const std::array<gsl::span<double>, sizeof...(VariablesToInterpolate)>&
+            results,
+        const std::array<gsl::span<const double>, Dimension>& target_points)
+        const {
+  constexpr size_t number_of_variables = sizeof...(VariablesToInterpolate);
+  static_assert(number_of_variables <= NumberOfVariables,
+                "You are trying to interpolate more variables than this "
+                "container holds.");
+  constexpr std::array<size_t, number_of_variables> variables{
+      {VariablesToInterpolate...}};
+  constexpr size_t number_of_corners = two_to_the(Dimension);
+  const size_t number_of_target_points = target_points[0].size();
+  ASSERT(alg::all_of(target_points,
+                     [number_of_target_points](const auto& points) {
+                       return points.size() == number_of_target_points;
+                     }) and
+             alg::all_of(results,
+                         [number_of_target_points](const auto& result) {
+                           return result.size() == number_of_target_points;
+                         }),
+         "All target points and results must have the same size, "
+             << number_of_target_points);
+
+  // Offsets of the corners of a cell from its lowest corner in the table.
+  // Note: first index varies fastest, as in `get_weights`
+  std::array<size_t, number_of_corners> corner_offsets{};
+  for (size_t corner = 0; corner < number_of_corners; ++corner) {
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      if (((corner >> d) & 1) == 1) {
+        gsl::at(corner_offsets, corner) += stride;
+      }
+      stride *= number_of_points_[d];
+    }
+  }
+
+  std::array<size_t, batch_size> cell_index{};
+  std::array<std::array<double, batch_size>, Dimension> relative_coordinates{};
+  for (size_t offset = 0; offset < number_of_target_points;
+       offset += batch_size) {
+    const size_t number_of_points =
+        std::min(batch_size, number_of_target_points - offset);
+    cell_index.fill(0);
+    size_t stride = 1;
+    for (size_t d = 0; d < Dimension; ++d) {
+      add_cell_indices(make_not_null(&cell_index),
+                       make_not_null(&gsl::at(relative_coordinates, d)), d,
+                       stride,
+                       {&gsl::at(target_points, d)[offset], number_of_points});
+      stride *= number_of_points_[d];
+    }
+
+    for (size_t s = 0; s < number_of_points; ++s) {
+      std::array<double, number_of_variables> values{};
+      for (size_t corner = 0; corner < number_of_corners; ++corner) {
+        double weight = 1.0;
+        for (size_t d = 0; d < Dimension; ++d) {
+          const double x = gsl::at(gsl::at(relative_coordinates, d), s);
+          weight *= ((corner >> d) & 1) == 1 ? x : 1.0 - x;
+        }
+        // The variables are contiguous at each point of the table
+        const size_t corner_index =
+            NumberOfVariables *
+            (gsl::at(cell_index, s) + gsl::at(corner_offsets, corner));
+        for (size_t i = 0; i < number_of_variables; ++i) {
+          gsl::at(values, i) +=
+              weight * y_[corner_index + gsl::at(variables, i)];
+        }
+      }
+      for (size_t i = 0; i < number_of_variables; ++i) {
+        gsl::at(results, i)[offset + s] = gsl::at(values, i);
+      }
+    }
+  }
+}
+
 /// Compute interpolation weights for 1D tables
 template <size_t Dimension, size_t NumberOfVariables, bool UniformSpacing>
 auto MultiLinearSpanInterpolation<Dimension, NumberOfVariables,
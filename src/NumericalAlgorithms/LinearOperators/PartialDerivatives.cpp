@@ -8,6 +8,7 @@
 #include <functional>
 #include <vector>
 
+#include "DataStructures/ApplyFixedSizeMatrix.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
@@ -40,6 +41,54 @@ void apply_matrix_in_first_dim(double* result, const double* const input,
 }
 }  // namespace
 
+namespace partial_derivatives_detail {
+template <size_t Dim>
+bool fixed_size_logical_partial_derivatives(
+    const std::array<double*, Dim>& logical_du, const double* const u,
+    const size_t number_of_independent_components, const Mesh<Dim>& mesh,
+    const LogicalDerivativeAlgorithm algorithm) {
+  if (algorithm == LogicalDerivativeAlgorithm::Blas) {
+    return false;
+  }
+  const size_t max_extent = algorithm == LogicalDerivativeAlgorithm::Automatic
+                                ? apply_fixed_size_matrix_preferred_max_size
+                                : apply_fixed_size_matrix_max_size;
+  for (size_t d = 0; d < Dim; ++d) {
+    if (mesh.extents(d) < apply_fixed_size_matrix_min_size or
+        mesh.extents(d) > max_extent) {
+      return false;
+    }
+  }
+  const size_t total_size =
+      number_of_independent_components * mesh.number_of_grid_points();
+  // Points along dimension `d` are `stride` apart, where `stride` is the
+  // number of grid points in a slice of all faster-varying dimensions
+  size_t stride = 1;
+  for (size_t d = 0; d < Dim; ++d) {
+    const size_t extent = mesh.extents(d);
+    apply_fixed_size_matrix(
+        make_not_null(gsl::at(logical_du, d)),
+        Spectral::differentiation_matrix(mesh.slice_through(d)), u, stride,
+        total_size / (stride * extent));
+    stride *= extent;
+  }
+  return true;
+}
+
+template bool fixed_size_logical_partial_derivatives(
+    const std::array<double*, 1>& logical_du, const double* u,
+    size_t number_of_independent_components, const Mesh<1>& mesh,
+    LogicalDerivativeAlgorithm algorithm);
+template bool fixed_size_logical_partial_derivatives(
+    const std::array<double*, 2>& logical_du, const double* u,
+    size_t number_of_independent_components, const Mesh<2>& mesh,
+    LogicalDerivativeAlgorithm algorithm);
+template bool fixed_size_logical_partial_derivatives(
+    const std::array<double*, 3>& logical_du, const double* u,
+    size_t number_of_independent_components, const Mesh<3>& mesh,
+    LogicalDerivativeAlgorithm algorithm);
+}  // namespace partial_derivatives_detail
+
 template <typename SymmList, typename IndexList, size_t Dim>
 void logical_partial_derivative(
     const gsl::not_null<TensorMetafunctions::prepend_spatial_index<
@@ -71,6 +120,16 @@ void logical_partial_derivative(
   // would also need to be the size of all components.
   for (size_t storage_index = 0; storage_index < u.size(); ++storage_index) {
     const auto u_tensor_index = u.get_tensor_index(storage_index);
+    std::array<double*, Dim> deriv_pointers{};
+    for (size_t i = 0; i < Dim; ++i) {
+      gsl::at(deriv_pointers, i) =
+          logical_derivative_of_u->get(prepend(u_tensor_index, i)).data();
+    }
+    if (partial_derivatives_detail::fixed_size_logical_partial_derivatives(
+            deriv_pointers, u[storage_index].data(), 1, mesh,
+            LogicalDerivativeAlgorithm::Automatic)) {
+      continue;
+    }
     const auto xi_deriv_tensor_index = prepend(u_tensor_index, 0_st);
     apply_matrix_in_first_dim(
         logical_derivative_of_u->get(xi_deriv_tensor_index).data(),
@@ -86,6 +86,40 @@ struct spacetime_deriv<Tag, Dim, Frame,
 
 }  // namespace Tags
 
+/// \ingroup NumericalAlgorithmsGroup
+/// \brief The algorithm used to apply the differentiation matrices when
+/// computing logical partial derivatives.
+///
+/// \see logical_partial_derivatives
+enum class LogicalDerivativeAlgorithm {
+  /// Use `FixedSize` if the mesh has at most
+  /// `apply_fixed_size_matrix_preferred_max_size` grid points in every
+  /// dimension, and `Blas` otherwise. On small meshes transposing the data for
+  /// BLAS costs more than the matrix multiplications themselves.
+  Automatic,
+  /// Transpose the data so that each dimension varies fastest in turn and
+  /// apply the differentiation matrices with BLAS.
+  Blas,
+  /// Apply the differentiation matrices along each dimension without
+  /// transposing, with kernels specialized on the number of grid points (see
+  /// `apply_fixed_size_matrix`). Falls back to `Blas` for extents that have no
+  /// specialized kernel.
+  FixedSize
+};
+
+namespace partial_derivatives_detail {
+// Computes the logical derivatives of the first
+// `number_of_independent_components` components of `u` in all dimensions
+// with `apply_fixed_size_matrix`, writing them to `logical_du`. Returns `false`
+// without computing anything if `algorithm` selects the BLAS implementation
+// for this `mesh`.
+template <size_t Dim>
+bool fixed_size_logical_partial_derivatives(
+    const std::array<double*, Dim>& logical_du, const double* u,
+    size_t number_of_independent_components, const Mesh<Dim>& mesh,
+    LogicalDerivativeAlgorithm algorithm);
+}  // namespace partial_derivatives_detail
+
 /// @{
 /// \ingroup NumericalAlgorithmsGroup
 /// \brief Compute the partial derivatives of each variable with respect to
@@ -96,17 +130,25 @@ struct spacetime_deriv<Tag, Dim, Frame,
 /// Returns a `Variables` with a spatial tensor index appended to the front
 /// of each tensor within `u` and each `Tag` wrapped with a `Tags::deriv`.
 ///
+/// The `algorithm` only needs to be specified for benchmarking and testing.
+/// All other functions in this file that compute logical derivatives use
+/// `LogicalDerivativeAlgorithm::Automatic`.
+///
 /// \tparam DerivativeTags the subset of `VariableTags` for which derivatives
 /// are computed.
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
 void logical_partial_derivatives(
     gsl::not_null<std::array<Variables<DerivativeTags>, Dim>*>
         logical_partial_derivatives_of_u,
-    const Variables<VariableTags>& u, const Mesh<Dim>& mesh);
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    LogicalDerivativeAlgorithm algorithm =
+        LogicalDerivativeAlgorithm::Automatic);
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
-auto logical_partial_derivatives(const Variables<VariableTags>& u,
-                                 const Mesh<Dim>& mesh)
+auto logical_partial_derivatives(
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    LogicalDerivativeAlgorithm algorithm =
+        LogicalDerivativeAlgorithm::Automatic)
     -> std::array<Variables<DerivativeTags>, Dim>;
 /// @}
 
@@ -9,6 +9,7 @@
 #include "DataStructures/DataBox/Prefixes.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Transpose.hpp"
 #include "DataStructures/Variables.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
@@ -18,7 +19,6 @@
 #include "Utilities/ContainerHelpers.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeArray.hpp"
-#include "Utilities/MemoryHelpers.hpp"
 #include "Utilities/StdArrayHelpers.hpp"
 
 namespace partial_derivatives_detail {
@@ -112,7 +112,8 @@ template <typename DerivativeTags, typename VariableTags, size_t Dim>
 void logical_partial_derivatives(
     const gsl::not_null<std::array<Variables<DerivativeTags>, Dim>*>
         logical_partial_derivatives_of_u,
-    const Variables<VariableTags>& u, const Mesh<Dim>& mesh) {
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const LogicalDerivativeAlgorithm algorithm) {
   if (UNLIKELY((*logical_partial_derivatives_of_u)[0].number_of_grid_points() !=
                u.number_of_grid_points())) {
     for (auto& deriv : *logical_partial_derivatives_of_u) {
@@ -124,13 +125,20 @@ void logical_partial_derivatives(
     gsl::at(deriv_pointers, i) =
         gsl::at(*logical_partial_derivatives_of_u, i).data();
   }
+  if (partial_derivatives_detail::fixed_size_logical_partial_derivatives(
+          deriv_pointers, u.data(),
+          Variables<DerivativeTags>::number_of_independent_components, mesh,
+          algorithm)) {
+    return;
+  }
   if constexpr (Dim == 1) {
     Variables<DerivativeTags>* temp = nullptr;
     partial_derivatives_detail::LogicalImpl<Dim, VariableTags, DerivativeTags>::
         apply(make_not_null(&deriv_pointers), temp, temp, u, mesh);
     return;
   } else {
-    auto buffer = cpp20::make_unique_for_overwrite<double[]>(
+    ScratchArena::Scope scratch{};
+    double* const buffer = scratch.allocate<double>(
         2 * u.number_of_grid_points() *
         Variables<DerivativeTags>::number_of_independent_components);
     Variables<DerivativeTags> temp0(
@@ -149,11 +157,12 @@ void logical_partial_derivatives(
 
 template <typename DerivativeTags, typename VariableTags, size_t Dim>
 std::array<Variables<DerivativeTags>, Dim> logical_partial_derivatives(
-    const Variables<VariableTags>& u, const Mesh<Dim>& mesh) {
+    const Variables<VariableTags>& u, const Mesh<Dim>& mesh,
+    const LogicalDerivativeAlgorithm algorithm) {
   auto logical_partial_derivatives_of_u =
       make_array<Dim>(Variables<DerivativeTags>(u.number_of_grid_points()));
   logical_partial_derivatives<DerivativeTags>(
-      make_not_null(&logical_partial_derivatives_of_u), u, mesh);
+      make_not_null(&logical_partial_derivatives_of_u), u, mesh, algorithm);
   return logical_partial_derivatives_of_u;
 }
 
@@ -209,20 +218,25 @@ void partial_derivatives(
   const size_t vars_size =
       u.number_of_grid_points() *
       Variables<DerivativeTags>::number_of_independent_components;
-  const auto logical_derivs_data = cpp20::make_unique_for_overwrite<double[]>(
-      (Dim > 1 ? (Dim + 1) : Dim) * vars_size);
+  ScratchArena::Scope scratch{};
+  double* const logical_derivs_data =
+      scratch.allocate<double>((Dim > 1 ? (Dim + 1) : Dim) * vars_size);
   std::array<double*, Dim> logical_derivs{};
   for (size_t i = 0; i < Dim; ++i) {
     gsl::at(logical_derivs, i) = &(logical_derivs_data[i * vars_size]);
   }
-  Variables<DerivativeTags> temp{};
-  if constexpr (Dim > 1) {
-    temp.set_data_ref(&logical_derivs_data[Dim * vars_size], vars_size);
+  if (not partial_derivatives_detail::fixed_size_logical_partial_derivatives(
+          logical_derivs, u.data(),
+          Variables<DerivativeTags>::number_of_independent_components, mesh,
+          LogicalDerivativeAlgorithm::Automatic)) {
+    Variables<DerivativeTags> temp{};
+    if constexpr (Dim > 1) {
+      temp.set_data_ref(&logical_derivs_data[Dim * vars_size], vars_size);
+    }
+    partial_derivatives_detail::LogicalImpl<Dim, VariableTags, DerivativeTags>::
+        apply(make_not_null(&logical_derivs), &partial_derivatives_of_u, &temp,
+              u, mesh);
   }
-  partial_derivatives_detail::LogicalImpl<
-      Dim, VariableTags, DerivativeTags>::apply(make_not_null(&logical_derivs),
-                                                &partial_derivatives_of_u,
-                                                &temp, u, mesh);
 
   std::array<const double*, Dim> const_logical_derivs{};
   for (size_t i = 0; i < Dim; ++i) {
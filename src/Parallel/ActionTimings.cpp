@@ -0,0 +1,46 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/ActionTimings.hpp"
+
+#include <cstddef>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace Parallel {
+ActionTimings::ActionTimings(const bool enabled) : enabled_(enabled) {}
+
+void ActionTimings::set_action_names(std::vector<std::string> action_names) {
+  action_names_ = std::move(action_names);
+  seconds_.assign(action_names_.size(), 0.0);
+  calls_.assign(action_names_.size(), 0);
+  measured_cost_ = 0.0;
+}
+
+void ActionTimings::pup(PUP::er& p) {
+  size_t version = 0;
+  p | version;
+  // Remember to increment the version number when making changes to this
+  // function. Retain support for unpacking data written by previous versions
+  // whenever possible. See `Domain` docs for details.
+  p | enabled_;
+  p | action_names_;
+  p | seconds_;
+  p | calls_;
+  p | measured_cost_;
+}
+
+bool operator==(const ActionTimings& lhs, const ActionTimings& rhs) {
+  return lhs.enabled_ == rhs.enabled_ and
+         lhs.action_names_ == rhs.action_names_ and
+         lhs.seconds_ == rhs.seconds_ and lhs.calls_ == rhs.calls_ and
+         lhs.measured_cost_ == rhs.measured_cost_;
+}
+
+bool operator!=(const ActionTimings& lhs, const ActionTimings& rhs) {
+  return not(lhs == rhs);
+}
+}  // namespace Parallel
@@ -0,0 +1,187 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <pup.h>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Options/String.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeString.hpp"
+#include "Utilities/PrettyType.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+/*!
+ * \brief The wall time spent in and the number of calls to each action of a
+ * parallel component, accumulated on one element.
+ *
+ * The actions are numbered consecutively over all phase-dependent action
+ * lists of the component, see `Parallel::action_timing_index()`, and are named
+ * `Phase/Index:Action` so that the same action in different places of the
+ * action lists can be told apart.
+ *
+ * Timings are only recorded if the object is `enabled()`. The algorithm loop
+ * records the time of every iterable action when
+ * `Parallel::Tags::ActionTimings` is in the DataBox, see
+ * `Parallel::invoke_and_time_action()`. The accumulated timings can be written
+ * to disk with `Events::ObserveActionTimings`.
+ */
+class ActionTimings {
+ public:
+  ActionTimings() = default;
+  explicit ActionTimings(bool enabled);
+
+  bool enabled() const { return enabled_; }
+
+  /// \brief Set the names of all actions, which also resets the timings.
+  void set_action_names(std::vector<std::string> action_names);
+
+  /// \brief Add `seconds` to the time spent in the action with index
+  /// `action_index` and count the call.
+  void record(const size_t action_index, const double seconds) {
+    ASSERT(action_index < seconds_.size(),
+           "Action index " << action_index << " is out of range. There are "
+                           << seconds_.size() << " actions.");
+    seconds_[action_index] += seconds;
+    ++calls_[action_index];
+    measured_cost_ += seconds;
+  }
+
+  size_t number_of_actions() const { return action_names_.size(); }
+  const std::vector<std::string>& action_names() const {
+    return action_names_;
+  }
+  /// The wall time in seconds spent in each action
+  const std::vector<double>& seconds() const { return seconds_; }
+  /// The number of calls to each action
+  const std::vector<size_t>& calls() const { return calls_; }
+
+  /// \brief The wall time in seconds spent in all actions since the last call
+  /// to `reset_measured_cost()`.
+  ///
+  /// This is the cost of the element used to rebalance the elements over the
+  /// processors, see `PhaseControl::RebalanceElements`.
+  double measured_cost() const { return measured_cost_; }
+  void reset_measured_cost() { measured_cost_ = 0.0; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p);
+
+ private:
+  friend bool operator==(const ActionTimings& lhs, const ActionTimings& rhs);
+
+  bool enabled_{false};
+  std::vector<std::string> action_names_{};
+  std::vector<double> seconds_{};
+  std::vector<size_t> calls_{};
+  double measured_cost_{0.0};
+};
+
+bool operator!=(const ActionTimings& lhs, const ActionTimings& rhs);
+
+/// \brief The index of the action at `action_index` in the action list of the
+/// phase at `phase_index` in `PhaseDepActionLists`, counting the actions of
+/// all phases consecutively.
+template <typename... PhaseDepActionLists>
+constexpr size_t action_timing_index(
+    tmpl::list<PhaseDepActionLists...> /*meta*/, const size_t phase_index,
+    const size_t action_index) {
+  const std::array<size_t, sizeof...(PhaseDepActionLists)> number_of_actions{
+      {PhaseDepActionLists::number_of_actions...}};
+  size_t result = action_index;
+  for (size_t i = 0; i < phase_index; ++i) {
+    result += gsl::at(number_of_actions, i);
+  }
+  return result;
+}
+
+/// \brief The names of all actions in `PhaseDepActionLists`, ordered as in
+/// `Parallel::action_timing_index()`.
+template <typename PhaseDepActionLists>
+std::vector<std::string> action_timing_names() {
+  std::vector<std::string> result{};
+  tmpl::for_each<PhaseDepActionLists>([&result](auto phase_dep_action_v) {
+    using phase_dep_action = tmpl::type_from<decltype(phase_dep_action_v)>;
+    size_t action_index = 0;
+    tmpl::for_each<typename phase_dep_action::action_list>(
+        [&result, &action_index](auto action_v) {
+          using action = tmpl::type_from<decltype(action_v)>;
+          result.push_back(MakeString{}
+                           << phase_dep_action::phase << '/' << action_index
+                           << ':' << pretty_type::name<action>());
+          ++action_index;
+        });
+  });
+  return result;
+}
+
+namespace OptionTags {
+/// \brief Whether to record the wall time spent in each action on each
+/// element.
+struct TimeActions {
+  using type = bool;
+  static constexpr Options::String help = {
+      "Record the wall time spent in each action on each element. Use the "
+      "ObserveActionTimings event to write the timings to disk."};
+};
+}  // namespace OptionTags
+
+namespace Tags {
+/// \brief The `Parallel::ActionTimings` of an element.
+///
+/// If this tag is in the DataBox of a parallel component, the algorithm
+/// records the time spent in each action when the timings are enabled in the
+/// input file.
+struct ActionTimings : db::SimpleTag {
+  using type = Parallel::ActionTimings;
+
+  using option_tags = tmpl::list<OptionTags::TimeActions>;
+  static constexpr bool pass_metavariables = false;
+  static type create_from_options(const bool time_actions) {
+    return Parallel::ActionTimings{time_actions};
+  }
+};
+}  // namespace Tags
+
+/*!
+ * \brief Call `invoke_action` and record the elapsed wall time in
+ * `Parallel::Tags::ActionTimings`.
+ *
+ * `PhaseIndex` and `ActionIndex` identify the action in
+ * `PhaseDepActionLists`. If the timings are disabled, only `invoke_action` is
+ * called.
+ */
+template <typename PhaseDepActionLists, size_t PhaseIndex, size_t ActionIndex,
+          typename DbTagsList, typename Invokable>
+void invoke_and_time_action(const gsl::not_null<db::DataBox<DbTagsList>*> box,
+                            const Invokable& invoke_action) {
+  if (not db::get<Tags::ActionTimings>(*box).enabled()) {
+    invoke_action();
+    return;
+  }
+  const auto start = std::chrono::steady_clock::now();
+  invoke_action();
+  const std::chrono::duration<double> elapsed =
+      std::chrono::steady_clock::now() - start;
+  db::mutate<Tags::ActionTimings>(
+      [&elapsed](const gsl::not_null<ActionTimings*> timings) {
+        if (timings->number_of_actions() == 0) {
+          timings->set_action_names(
+              action_timing_names<PhaseDepActionLists>());
+        }
+        timings->record(action_timing_index(PhaseDepActionLists{}, PhaseIndex,
+                                            ActionIndex),
+                        elapsed.count());
+      },
+      box);
+}
+}  // namespace Parallel
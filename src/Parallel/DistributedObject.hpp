@@ -22,6 +22,7 @@
 
 #include "DataStructures/DataBox/DataBox.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "Parallel/ActionTimings.hpp"
 #include "Parallel/AlgorithmExecution.hpp"
 #include "Parallel/AlgorithmMetafunctions.hpp"
 #include "Parallel/Algorithms/AlgorithmArrayDeclarations.hpp"
@@ -408,6 +409,13 @@ class DistributedObject<ParallelComponent,
   /// result to Main's did_all_elements_terminate member function.
   void contribute_termination_status_to_main();
 
+  /// Migrate this element of an array component to the processing element
+  /// `proc`. Does nothing if the element already lives on `proc`.
+  ///
+  /// This is used to redistribute the elements based on their measured cost,
+  /// see `Parallel::Actions::MigrateElementsByMeasuredCost`.
+  void migrate_to(int proc);
+
   /// Returns the name of the last "next iterable action" to be run before a
   /// deadlock occurred.
   const std::string& deadlock_analysis_next_iterable_action() const {
@@ -1110,10 +1118,20 @@ bool DistributedObject<
 
   AlgorithmExecution requested_execution{};
   std::optional<std::size_t> next_action_step{};
-  std::tie(requested_execution, next_action_step) = ThisAction::apply(
-      box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
-      std::as_const(array_index_), actions_list{},
-      std::add_pointer_t<ParallelComponent>{});
+  const auto invoke_action = [this, &requested_execution,
+                              &next_action_step]() {
+    std::tie(requested_execution, next_action_step) = ThisAction::apply(
+        box_, inboxes_, *Parallel::local_branch(global_cache_proxy_),
+        std::as_const(array_index_), actions_list{},
+        std::add_pointer_t<ParallelComponent>{});
+  };
+  if constexpr (db::tag_is_retrievable_v<Tags::ActionTimings, databox_type>) {
+    invoke_and_time_action<phase_dependent_action_lists, PhaseIndex::value,
+                           DataBoxIndex::value>(make_not_null(&box_),
+                                                invoke_action);
+  } else {
+    invoke_action();
+  }
 
   if (next_action_step.has_value()) {
     ASSERT(
@@ -1173,6 +1191,23 @@ void DistributedObject<ParallelComponent,
                    cb);
 }
 
+template <typename ParallelComponent, typename... PhaseDepActionListsPack>
+void DistributedObject<ParallelComponent,
+                       tmpl::list<PhaseDepActionListsPack...>>::
+    migrate_to(const int proc) {
+  if constexpr (Parallel::is_array<parallel_component>::value) {
+    if (proc != sys::my_proc()) {
+      // Charm++ packs the element after this entry method returns, so the
+      // migration must be the last thing we do here.
+      this->ckMigrate(proc);
+    }
+  } else {
+    (void)proc;
+    ERROR("Only elements of array components can migrate, but "
+          << pretty_type::name<parallel_component>() << " is not an array.");
+  }
+}
+
 template <typename ParallelComponent, typename... PhaseDepActionListsPack>
 void DistributedObject<ParallelComponent,
                        tmpl::list<PhaseDepActionListsPack...>>::
@@ -52,10 +52,18 @@
 
 #include "Parallel/Main.decl.h"
 
+/// \cond
+namespace PhaseControl::Tags {
+struct RebalanceReturnPhase;
+}  // namespace PhaseControl::Tags
+/// \endcond
+
 namespace Parallel {
 namespace detail {
 CREATE_IS_CALLABLE(run_deadlock_analysis_simple_actions)
 CREATE_IS_CALLABLE_V(run_deadlock_analysis_simple_actions)
+CREATE_IS_CALLABLE(execute_before_exit)
+CREATE_IS_CALLABLE_V(execute_before_exit)
 }  // namespace detail
 
 /// \ingroup ParallelGroup
@@ -113,6 +121,13 @@ class Main : public CBase_Main<Metavariables> {
   /// used as the callback after a quiescence detection.
   void start_write_checkpoint();
 
+  /// Start checking that all parallel components terminated, after which the
+  /// executable exits
+  ///
+  /// \details This call is wrapped within an entry method so that it may be
+  /// used as the callback after a quiescence detection.
+  void start_termination_check();
+
   /// Reduction target for data used in phase change decisions.
   ///
   /// It is required that the `Parallel::ReductionData` holds a single
@@ -156,6 +171,10 @@ class Main : public CBase_Main<Metavariables> {
   // Check if future checkpoint dirs are available; error if any already exist.
   void check_future_checkpoint_dirs_available() const;
 
+  // Whether the current LoadBalancing phase was requested by
+  // `PhaseControl::RebalanceElements`, which migrates the elements itself.
+  bool rebalancing_by_measured_cost() const;
+
   // Starts a reduction on the component specified by
   // the current_termination_check_index_ member variable, then increment
   // current_termination_check_index_
@@ -784,7 +803,26 @@ void Main<Metavariables>::execute_next_phase() {
   }
 
   if (Parallel::Phase::Exit == current_phase_) {
-    check_if_component_terminated_correctly();
+    // Components may have to finish some work, like writing buffered data to
+    // disk, before we exit
+    bool wait_before_exit = false;
+    tmpl::for_each<component_list>([this, &wait_before_exit](
+                                       auto parallel_component) {
+      using component = tmpl::type_from<decltype(parallel_component)>;
+      if constexpr (detail::is_execute_before_exit_callable_v<
+                        component, CProxy_GlobalCache<Metavariables>&>) {
+        if (component::execute_before_exit(global_cache_proxy_)) {
+          wait_before_exit = true;
+        }
+      }
+    });
+    if (wait_before_exit) {
+      CkStartQD(
+          CkCallback(CkIndex_Main<Metavariables>::start_termination_check(),
+                     this->thisProxy));
+    } else {
+      check_if_component_terminated_correctly();
+    }
     return;
   }
   tmpl::for_each<component_list>([this](auto parallel_component) {
@@ -804,7 +842,10 @@ void Main<Metavariables>::execute_next_phase() {
   // load balance or checkpoint work could be initiated *before* the call to
   // component::execute_next_phase and *without* the need for a quiescence
   // detection. This may be a slight optimization.
-  if (current_phase_ == Parallel::Phase::LoadBalancing) {
+  // The Charm++ load balancer would undo the migrations of
+  // `PhaseControl::RebalanceElements`, so it is skipped in that case.
+  if (current_phase_ == Parallel::Phase::LoadBalancing and
+      not rebalancing_by_measured_cost()) {
     CkStartQD(CkCallback(CkIndex_Main<Metavariables>::start_load_balance(),
                          this->thisProxy));
     return;
@@ -820,6 +861,19 @@ void Main<Metavariables>::execute_next_phase() {
                        this->thisProxy));
 }
 
+template <typename Metavariables>
+bool Main<Metavariables>::rebalancing_by_measured_cost() const {
+  if constexpr (tmpl::list_contains_v<
+                    phase_change_tags_and_combines_list,
+                    PhaseControl::Tags::RebalanceReturnPhase>) {
+    return tuples::get<PhaseControl::Tags::RebalanceReturnPhase>(
+               phase_change_decision_data_)
+        .has_value();
+  } else {
+    return false;
+  }
+}
+
 template <typename Metavariables>
 void Main<Metavariables>::start_load_balance() {
   at_sync_indicator_proxy_.IndicateAtSync();
@@ -843,6 +897,11 @@ void Main<Metavariables>::start_write_checkpoint() {
                               this->thisProxy));
 }
 
+template <typename Metavariables>
+void Main<Metavariables>::start_termination_check() {
+  check_if_component_terminated_correctly();
+}
+
 template <typename Metavariables>
 template <typename InvokeCombine, typename... Tags>
 void Main<Metavariables>::phase_change_reduction(
@@ -0,0 +1,78 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Parallel/PhaseControl/RebalanceElements.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <unordered_set>
+
+#include "Parallel/Phase.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/ErrorHandling/Error.hpp"
+
+namespace PhaseControl {
+
+namespace Tags {
+std::map<size_t, double> MeasuredCostPerProc::combine_method::operator()(
+    std::map<size_t, double> first_costs,
+    const std::map<size_t, double>& second_costs) {
+  for (const auto& [proc, cost] : second_costs) {
+    first_costs[proc] += cost;
+  }
+  return first_costs;
+}
+
+std::optional<Parallel::Phase> RebalanceReturnPhase::combine_method::operator()(
+    const std::optional<Parallel::Phase> /*first_phase*/,
+    const std::optional<Parallel::Phase>& /*second_phase*/) {
+  ERROR(
+      "The return phase should only be altered by the phase change "
+      "arbitration in the Main chare, so no reduction data should be "
+      "provided.");
+}
+}  // namespace Tags
+
+RebalanceElements::RebalanceElements(const double max_imbalance)
+    : max_imbalance_(max_imbalance) {}
+
+RebalanceElements::RebalanceElements(CkMigrateMessage* msg)
+    : PhaseChange(msg) {}
+
+double RebalanceElements::imbalance(
+    const std::map<size_t, double>& cost_per_proc,
+    const size_t number_of_procs,
+    const std::unordered_set<size_t>& procs_to_ignore) {
+  ASSERT(procs_to_ignore.size() < number_of_procs,
+         "Can't ignore all " << number_of_procs << " processors.");
+  double max_cost = 0.0;
+  double total_cost = 0.0;
+  for (const auto& proc_and_cost : cost_per_proc) {
+    const double cost = proc_and_cost.second;
+    max_cost = std::max(max_cost, cost);
+    total_cost += cost;
+  }
+  if (total_cost <= 0.0) {
+    return 1.0;
+  }
+  return max_cost *
+         static_cast<double>(number_of_procs - procs_to_ignore.size()) /
+         total_cost;
+}
+
+void RebalanceElements::pup(PUP::er& p) {
+  PhaseChange::pup(p);
+  size_t version = 0;
+  p | version;
+  // Remember to increment the version number when making changes to this
+  // function. Retain support for unpacking data written by previous versions
+  // whenever possible. See `Domain` docs for details.
+  p | max_imbalance_;
+}
+}  // namespace PhaseControl
+
+PUP::able::PUP_ID PhaseControl::RebalanceElements::my_PUP_ID = 0;  // NOLINT
@@ -0,0 +1,236 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <pup.h>
+#include <type_traits>
+#include <unordered_set>
+#include <utility>
+
+#include "Options/String.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/AlgorithmMetafunctions.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseControl/ContributeToPhaseChangeReduction.hpp"
+#include "Parallel/PhaseControl/PhaseChange.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+#include "Utilities/TMPL.hpp"
+#include "Utilities/TaggedTuple.hpp"
+
+namespace PhaseControl {
+
+namespace Tags {
+/// The measured cost of all elements on each processing element, summed over
+/// the elements.
+///
+/// Each element contributes a single (processing element, cost) pair, and the
+/// contributions are combined by adding the costs of the same processing
+/// element. Processing elements without elements don't appear in the map.
+struct MeasuredCostPerProc {
+  using type = std::map<size_t, double>;
+
+  struct combine_method {
+    std::map<size_t, double> operator()(
+        std::map<size_t, double> first_costs,
+        const std::map<size_t, double>& second_costs);
+  };
+
+  using main_combine_method = combine_method;
+};
+
+/// Storage in the phase change decision tuple so that the Main chare can record
+/// the phase to return to after rebalancing the elements.
+///
+/// \note This tag is not intended to participate in any of the reduction
+/// procedures, so will error if the combine method is called.
+struct RebalanceReturnPhase {
+  using type = std::optional<Parallel::Phase>;
+
+  struct combine_method {
+    [[noreturn]] std::optional<Parallel::Phase> operator()(
+        const std::optional<Parallel::Phase> /*first_phase*/,
+        const std::optional<Parallel::Phase>& /*second_phase*/);
+  };
+
+  using main_combine_method = combine_method;
+};
+}  // namespace Tags
+
+namespace detail {
+template <typename ParallelComponent>
+struct records_action_timings
+    : std::bool_constant<
+          std::is_same_v<typename ParallelComponent::chare_type,
+                         Parallel::Algorithms::Array> and
+          tmpl::list_contains_v<
+              Parallel::get_simple_tags_from_options<
+                  Parallel::get_initialization_actions_list<
+                      typename ParallelComponent::phase_dependent_action_list>>,
+              Parallel::Tags::ActionTimings>> {};
+}  // namespace detail
+
+/*!
+ * \brief Phase control object that runs the LoadBalancing phase when the
+ * measured cost of the elements is distributed unevenly over the processing
+ * elements, then returns to the original phase.
+ *
+ * The cost of an element is the wall time spent in its actions since the last
+ * rebalancing, as recorded by `Parallel::ActionTimings` (see
+ * `Parallel::ActionTimings::measured_cost()`). Only array components that
+ * record action timings participate, i.e. components that add
+ * `Parallel::Tags::ActionTimings` in their Initialization phase (see
+ * `Initialization::ActionTimings`), and the timings must be enabled in the
+ * input file.
+ *
+ * Every time this phase control is triggered, the costs of all elements are
+ * summed on each processing element. If the largest cost on a processing
+ * element exceeds the mean cost over all processing elements that are
+ * available for elements (i.e. not in
+ * `Parallel::ResourceInfo::procs_to_ignore()`) by more than a factor of
+ * `MaxImbalance`, the LoadBalancing phase is run. Processing elements without
+ * elements count towards the mean, so concentrating the elements on a few
+ * processing elements is detected as an imbalance.
+ *
+ * To actually move the elements, the phase-dependent action list of the
+ * element array must run `Parallel::Actions::MigrateElementsByMeasuredCost`
+ * in the LoadBalancing phase, which computes a new space-filling-curve
+ * partition of the elements from their measured costs on a singleton and
+ * migrates them. The measured costs are reset once they have been used to
+ * rebalance the elements. The Main chare doesn't start the Charm++ load
+ * balancer in a LoadBalancing phase requested by this phase control, since it
+ * would undo the migrations.
+ *
+ * As for the other phase controls, triggers must be selected so that the
+ * components halt at a globally-valid state, e.g. at slab boundaries.
+ */
+struct RebalanceElements : public PhaseChange {
+  explicit RebalanceElements(double max_imbalance);
+
+  explicit RebalanceElements(CkMigrateMessage* msg);
+
+  /// \cond
+  RebalanceElements() = default;
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(RebalanceElements);  // NOLINT
+  /// \endcond
+
+  struct MaxImbalance {
+    using type = double;
+    static constexpr Options::String help = {
+        "Rebalance the elements when the largest measured cost on a processor "
+        "exceeds the mean cost per processor by this factor."};
+    static type lower_bound() { return 1.0; }
+  };
+
+  using options = tmpl::list<MaxImbalance>;
+  static constexpr Options::String help{
+      "Run the LoadBalancing phase when the measured cost of the elements is "
+      "distributed unevenly over the processors, then return to the original "
+      "phase. Requires that the elements record action timings."};
+
+  using argument_tags = tmpl::list<Parallel::Tags::ActionTimings>;
+  using return_tags = tmpl::list<>;
+
+  using phase_change_tags_and_combines =
+      tmpl::list<Tags::MeasuredCostPerProc, Tags::RebalanceReturnPhase>;
+
+  template <typename Metavariables>
+  using participating_components =
+      tmpl::filter<typename Metavariables::component_list,
+                   detail::records_action_timings<tmpl::_1>>;
+
+  template <typename... DecisionTags>
+  void initialize_phase_data_impl(
+      const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+          phase_change_decision_data) const;
+
+  template <typename ParallelComponent, typename ArrayIndex,
+            typename Metavariables>
+  void contribute_phase_data_impl(
+      const Parallel::ActionTimings& action_timings,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ArrayIndex& array_index) const;
+
+  template <typename... DecisionTags, typename Metavariables>
+  typename std::optional<std::pair<Parallel::Phase, ArbitrationStrategy>>
+  arbitrate_phase_change_impl(
+      const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+          phase_change_decision_data,
+      const Parallel::Phase current_phase,
+      const Parallel::GlobalCache<Metavariables>& cache) const;
+
+  void pup(PUP::er& p) override;
+
+ private:
+  /// The ratio of the largest to the mean cost per processor, where the mean
+  /// is taken over all `number_of_procs` processors except the
+  /// `procs_to_ignore`. Returns 1 if no costs were measured.
+  static double imbalance(const std::map<size_t, double>& cost_per_proc,
+                          size_t number_of_procs,
+                          const std::unordered_set<size_t>& procs_to_ignore);
+
+  double max_imbalance_{1.0};
+};
+
+template <typename... DecisionTags>
+void RebalanceElements::initialize_phase_data_impl(
+    const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+        phase_change_decision_data) const {
+  tuples::get<Tags::MeasuredCostPerProc>(*phase_change_decision_data).clear();
+  tuples::get<Tags::RebalanceReturnPhase>(*phase_change_decision_data) =
+      std::nullopt;
+}
+
+template <typename ParallelComponent, typename ArrayIndex,
+          typename Metavariables>
+void RebalanceElements::contribute_phase_data_impl(
+    const Parallel::ActionTimings& action_timings,
+    Parallel::GlobalCache<Metavariables>& cache,
+    const ArrayIndex& array_index) const {
+  Parallel::contribute_to_phase_change_reduction<ParallelComponent>(
+      tuples::TaggedTuple<Tags::MeasuredCostPerProc>{std::map<size_t, double>{
+          {static_cast<size_t>(sys::my_proc()),
+           action_timings.measured_cost()}}},
+      cache, array_index);
+}
+
+template <typename... DecisionTags, typename Metavariables>
+typename std::optional<std::pair<Parallel::Phase, ArbitrationStrategy>>
+RebalanceElements::arbitrate_phase_change_impl(
+    const gsl::not_null<tuples::TaggedTuple<DecisionTags...>*>
+        phase_change_decision_data,
+    const Parallel::Phase current_phase,
+    const Parallel::GlobalCache<Metavariables>& cache) const {
+  auto& return_phase =
+      tuples::get<Tags::RebalanceReturnPhase>(*phase_change_decision_data);
+  if (return_phase.has_value()) {
+    // The elements have been rebalanced, so return to the original phase
+    const auto result = return_phase;
+    return_phase.reset();
+    return std::make_pair(result.value(),
+                          ArbitrationStrategy::PermitAdditionalJumps);
+  }
+
+  auto& cost_per_proc =
+      tuples::get<Tags::MeasuredCostPerProc>(*phase_change_decision_data);
+  const double measured_imbalance =
+      imbalance(cost_per_proc, Parallel::number_of_procs<size_t>(cache),
+                cache.get_resource_info().procs_to_ignore());
+  cost_per_proc.clear();
+  if (measured_imbalance > max_imbalance_) {
+    return_phase = current_phase;
+    return std::make_pair(Parallel::Phase::LoadBalancing,
+                          ArbitrationStrategy::RunPhaseImmediately);
+  }
+  return std::nullopt;
+}
+}  // namespace PhaseControl
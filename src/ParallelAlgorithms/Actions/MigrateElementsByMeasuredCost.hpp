@@ -0,0 +1,188 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/ElementDistribution.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Tags.hpp"
+#include "Domain/Tags/ElementDistribution.hpp"
+#include "NumericalAlgorithms/Spectral/Mesh.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/AlgorithmExecution.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Info.hpp"
+#include "Parallel/ParallelComponentHelpers.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/TypeTraits.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/System/ParallelInfo.hpp"
+
+/// \cond
+namespace tuples {
+template <typename... Tags>
+class TaggedTuple;
+}  // namespace tuples
+/// \endcond
+
+namespace Parallel::Actions {
+namespace detail {
+/// Return the measured cost of the element and reset it, so that the next
+/// rebalancing measures the cost of the element on its new processing element.
+template <typename DbTagsList>
+double take_measured_cost(const gsl::not_null<db::DataBox<DbTagsList>*> box) {
+  double measured_cost = 0.0;
+  db::mutate<Parallel::Tags::ActionTimings>(
+      [&measured_cost](const gsl::not_null<Parallel::ActionTimings*> timings) {
+        measured_cost = timings->measured_cost();
+        timings->reset_measured_cost();
+      },
+      box);
+  return measured_cost;
+}
+
+/// Receive the measured costs, current processing elements and estimated
+/// costs of all elements of `ElementComponent`, compute the new partition and
+/// send each element that has to move its new processing element.
+///
+/// Elements without a measured cost, e.g. ones created by AMR since the last
+/// rebalancing, get their estimated cost rescaled to the measured costs (see
+/// `domain::measured_element_costs()`).
+template <typename ElementComponent>
+struct ReceiveMeasuredElementCosts {
+  template <typename ParallelComponent, typename DbTagsList,
+            typename Metavariables, typename ArrayIndex, size_t Dim>
+  static void apply(db::DataBox<DbTagsList>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& cache,
+                    const ArrayIndex& /*array_index*/,
+                    const std::map<ElementId<Dim>, std::pair<double, size_t>>&
+                        measured_costs_and_procs,
+                    const std::map<ElementId<Dim>, double>& estimated_costs) {
+    // Without measured costs, e.g. if the action timings are disabled, there
+    // is nothing to balance
+    std::unordered_map<ElementId<Dim>, double> measured_costs{};
+    double total_cost = 0.0;
+    for (const auto& [element_id, cost_and_proc] : measured_costs_and_procs) {
+      measured_costs.emplace(element_id, cost_and_proc.first);
+      total_cost += cost_and_proc.first;
+    }
+    if (total_cost <= 0.0) {
+      return;
+    }
+    const std::unordered_map<ElementId<Dim>, double> element_costs =
+        domain::measured_element_costs(
+            std::unordered_map<ElementId<Dim>, double>(estimated_costs.begin(),
+                                                       estimated_costs.end()),
+            measured_costs);
+
+    const std::unordered_set<size_t>& procs_to_ignore =
+        cache.get_resource_info().procs_to_ignore();
+    domain::SpaceFillingCurve element_ordering =
+        domain::SpaceFillingCurve::ZCurve;
+    if constexpr (Parallel::is_in_global_cache<Metavariables,
+                                               domain::Tags::ElementOrdering>) {
+      element_ordering = Parallel::get<domain::Tags::ElementOrdering>(cache);
+    }
+    const std::unordered_map<ElementId<Dim>, size_t> procs =
+        domain::partition_elements_by_cost(
+            element_costs,
+            Parallel::number_of_procs<size_t>(cache) - procs_to_ignore.size(),
+            procs_to_ignore, element_ordering);
+    auto& element_proxy =
+        Parallel::get_parallel_component<ElementComponent>(cache);
+    for (const auto& [element_id, cost_and_proc] : measured_costs_and_procs) {
+      const size_t new_proc = procs.at(element_id);
+      if (new_proc != cost_and_proc.second) {
+        element_proxy[element_id].migrate_to(static_cast<int>(new_proc));
+      }
+    }
+  }
+};
+}  // namespace detail
+
+/*!
+ * \ingroup ActionsGroup
+ * \brief Redistribute the elements of an array over the processing elements
+ * based on their measured cost.
+ *
+ * The measured cost of an element is the wall time spent in its actions since
+ * the last rebalancing, see `Parallel::ActionTimings::measured_cost()`. The
+ * costs of all elements are collected in a reduction to the singleton
+ * `BalancingComponent` (any singleton of the executable, e.g.
+ * `amr::Component`). Elements that have not run since the last rebalancing,
+ * e.g. because AMR just created them, are given their number of grid points
+ * (or 1 if the DataBox has no `domain::Tags::Mesh`) rescaled to the measured
+ * costs with `domain::measured_element_costs()`. The singleton computes the
+ * new partition once with `domain::partition_elements_by_cost()`, ordering
+ * the elements along the `domain::Tags::ElementOrdering` space-filling curve
+ * (the Z-curve if the tag is not in the global cache), and tells each element
+ * that has to move its new processing element. The measured costs are reset
+ * so that the next rebalancing measures the costs of the elements on their new
+ * processing elements.
+ *
+ * This action is intended to be placed in the LoadBalancing phase of the
+ * element array, which can be requested by `PhaseControl::RebalanceElements`
+ * when the elements are distributed unevenly. In a LoadBalancing phase
+ * requested by `PhaseControl::RebalanceElements` the Main chare doesn't start
+ * the Charm++ load balancer, which would undo the migrations. The Main chare
+ * waits for quiescence before leaving the LoadBalancing phase, so all
+ * migrations have completed when the next phase starts. The action pauses the
+ * algorithm.
+ *
+ * Uses:
+ * - DataBox:
+ *   - `Parallel::Tags::ActionTimings`
+ *   - `domain::Tags::Mesh<Dim>` (optional)
+ *
+ * DataBox changes:
+ * - Modifies:
+ *   - `Parallel::Tags::ActionTimings`
+ */
+template <typename BalancingComponent>
+struct MigrateElementsByMeasuredCost {
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            size_t Dim, typename ActionList, typename ParallelComponent>
+  static Parallel::iterable_action_return_t apply(
+      db::DataBox<DbTagsList>& box,
+      const tuples::TaggedTuple<InboxTags...>& /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& cache,
+      const ElementId<Dim>& element_id, const ActionList /*meta*/,
+      const ParallelComponent* const /*meta*/) {
+    static_assert(
+        Parallel::is_singleton_v<BalancingComponent>,
+        "The elements are partitioned on a singleton parallel component.");
+    const double measured_cost =
+        detail::take_measured_cost(make_not_null(&box));
+    double estimated_cost = 1.0;
+    if constexpr (db::tag_is_retrievable_v<domain::Tags::Mesh<Dim>,
+                                           db::DataBox<DbTagsList>>) {
+      estimated_cost = static_cast<double>(
+          db::get<domain::Tags::Mesh<Dim>>(box).number_of_grid_points());
+    }
+    Parallel::contribute_to_reduction<
+        detail::ReceiveMeasuredElementCosts<ParallelComponent>>(
+        Parallel::ReductionData<
+            Parallel::ReductionDatum<
+                std::map<ElementId<Dim>, std::pair<double, size_t>>,
+                funcl::Merge<>>,
+            Parallel::ReductionDatum<std::map<ElementId<Dim>, double>,
+                                     funcl::Merge<>>>{
+            std::map<ElementId<Dim>, std::pair<double, size_t>>{
+                {element_id,
+                 {measured_cost, static_cast<size_t>(sys::my_proc())}}},
+            std::map<ElementId<Dim>, double>{{element_id, estimated_cost}}},
+        Parallel::get_parallel_component<ParallelComponent>(cache)[element_id],
+        Parallel::get_parallel_component<BalancingComponent>(cache));
+    return {Parallel::AlgorithmExecution::Pause, std::nullopt};
+  }
+};
+}  // namespace Parallel::Actions
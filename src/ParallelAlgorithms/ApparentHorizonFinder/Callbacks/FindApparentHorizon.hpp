@@ -112,6 +112,11 @@ namespace callbacks {
 ///  - |R_mesh| = L2 norm of residual over prolonged grid points.
 ///  - r        = min and max radius of trial horizon surface.
 ///
+/// At verbosity `Verbose` and above, if the initial guess was extrapolated in
+/// time from previous horizons, a second line on convergence reports the
+/// order of the extrapolation and the iterations it saved; see
+/// `FastFlow::IterInfo::iterations_saved`.
+///
 /// #### Difference between |R| and |R_mesh|:
 ///  The horizon is represented in a \f$Y_{lm}\f$ expansion up
 ///  to \f$l=l_{\mathrm{surface}}\f$;
@@ -163,12 +168,13 @@ struct FindApparentHorizon
       // search, because only now do we know the temporal_id of this horizon
       // search.
       db::mutate<ylm::Tags::Strahlkorper<Frame>,
-                 ylm::Tags::PreviousStrahlkorpers<Frame>>(
+                 ylm::Tags::PreviousStrahlkorpers<Frame>, ::ah::Tags::FastFlow>(
           [&temporal_id](
               const gsl::not_null<ylm::Strahlkorper<Frame>*> strahlkorper,
               const gsl::not_null<
                   std::deque<std::pair<double, ylm::Strahlkorper<Frame>>>*>
-                  previous_strahlkorpers) {
+                  previous_strahlkorpers,
+              const gsl::not_null<::FastFlow*> fast_flow) {
             // If we have zero previous_strahlkorpers, then the
             // initial guess is already in strahlkorper, so do
             // nothing.
@@ -219,6 +225,7 @@ struct FindApparentHorizon
                     fac_0 * (*previous_strahlkorpers)[0].second.coefficients() +
                     fac_1 * (*previous_strahlkorpers)[1].second.coefficients() +
                     fac_2 * (*previous_strahlkorpers)[2].second.coefficients();
+                fast_flow->set_initial_guess_extrapolation_order(2);
               } else {
                 // Linear extrapolation
                 const double new_time =
@@ -233,6 +240,7 @@ struct FindApparentHorizon
                 strahlkorper->coefficients() =
                     fac_0 * (*previous_strahlkorpers)[0].second.coefficients() +
                     fac_1 * (*previous_strahlkorpers)[1].second.coefficients();
+                fast_flow->set_initial_guess_extrapolation_order(1);
               }
             }
           },
@@ -290,6 +298,15 @@ struct FindApparentHorizon
             info.iteration, info.min_residual, info.max_residual,
             info.residual_ylm, info.residual_mesh, info.r_min, info.r_max);
       }
+      if (verbosity > ::Verbosity::Quiet and has_converged and
+          info.initial_guess_extrapolation_order > 0) {
+        Parallel::printf(
+            "%s: t=%.6g: initial guess extrapolated at order %zu, "
+            "its saved=%.3g\n",
+            pretty_type::name<InterpolationTargetTag>(),
+            InterpolationTarget_detail::get_temporal_id_value(temporal_id),
+            info.initial_guess_extrapolation_order, info.iterations_saved);
+      }
 
       if (status == FastFlow::Status::SuccessfulIteration) {
         // Do another iteration of the same horizon search.
@@ -25,6 +25,7 @@
 #include "PointwiseFunctions/GeneralRelativity/Surfaces/UnitNormalOneForm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/EqualWithinRoundoff.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/ErrorHandling/Error.hpp"
 #include "Utilities/GenerateInstantiations.hpp"
 #include "Utilities/Gsl.hpp"
@@ -199,7 +200,22 @@ FastFlow::iterate_horizon_finder(
                      *minmax_residual.first,
                      *minmax_residual.second,
                      residual_ylm_norm,
-                     residual_mesh_norm};
+                     residual_mesh_norm,
+                     initial_guess_extrapolation_order_};
+
+  // On convergence, compare the number of iterations with the mean over all
+  // converged finds that were not warm-started by extrapolation.
+  const auto record_convergence = [this, &iter_info]() {
+    if (initial_guess_extrapolation_order_ == 0) {
+      ++unextrapolated_finds_;
+      unextrapolated_find_iterations_ += current_iter_;
+    } else if (unextrapolated_finds_ > 0) {
+      iter_info.iterations_saved =
+          static_cast<double>(unextrapolated_find_iterations_) /
+              static_cast<double>(unextrapolated_finds_) -
+          static_cast<double>(current_iter_);
+    }
+  };
 
   // Exit if converged.
   // What should happen is that as iterations proceed,
@@ -219,6 +235,7 @@ FastFlow::iterate_horizon_finder(
   // first step, since previous_residual_mesh_norm_ is not defined, so
   // we skip this part of the check on the first iteration.
   if (residual_ylm_norm < abs_tol_) {
+    record_convergence();
     // clang-tidy: std::move of trivially-copyable type
     return std::make_pair(Status::AbsTol, std::move(iter_info));  // NOLINT
   } else if (residual_ylm_norm < trunc_tol_ * residual_mesh_norm) {
@@ -229,6 +246,7 @@ FastFlow::iterate_horizon_finder(
     if (previous_residual_mesh_norm_ == 0 or
         equal_within_roundoff(residual_mesh_norm, previous_residual_mesh_norm_,
                               divergence_tol_ - 1.0, 0.0)) {
+      record_convergence();
       // clang-tidy: std::move of trivially-copyable type
       return std::make_pair(Status::TruncationTol,
                             std::move(iter_info));  // NOLINT
@@ -275,6 +293,14 @@ FastFlow::iterate_horizon_finder(
                         std::move(iter_info));  // NOLINT
 }
 
+void FastFlow::set_initial_guess_extrapolation_order(const size_t order) {
+  ASSERT(current_iter_ == 0,
+         "The initial guess extrapolation order must be set before the first "
+         "iteration of a horizon find, but the current iteration is "
+             << current_iter_);
+  initial_guess_extrapolation_order_ = order;
+}
+
 std::ostream& operator<<(std::ostream& os,
                          const FastFlow::FlowType& flow_type) {
   switch (flow_type) {
@@ -304,6 +330,9 @@ void FastFlow::pup(PUP::er& p) {
   p | previous_residual_mesh_norm_;
   p | min_residual_mesh_norm_;
   p | iter_at_min_residual_mesh_norm_;
+  p | initial_guess_extrapolation_order_;
+  p | unextrapolated_finds_;
+  p | unextrapolated_find_iterations_;
 }
 
 std::ostream& operator<<(std::ostream& os, const FastFlow::Status& status) {
@@ -340,7 +369,12 @@ bool operator==(const FastFlow& lhs, const FastFlow& rhs) {
              rhs.previous_residual_mesh_norm_ and
          lhs.min_residual_mesh_norm_ == rhs.min_residual_mesh_norm_ and
          lhs.iter_at_min_residual_mesh_norm_ ==
-             rhs.iter_at_min_residual_mesh_norm_;
+             rhs.iter_at_min_residual_mesh_norm_ and
+         lhs.initial_guess_extrapolation_order_ ==
+             rhs.initial_guess_extrapolation_order_ and
+         lhs.unextrapolated_finds_ == rhs.unextrapolated_finds_ and
+         lhs.unextrapolated_find_iterations_ ==
+             rhs.unextrapolated_find_iterations_;
 }
 
 template <>
@@ -61,6 +61,17 @@ class FastFlow {
         max_residual{std::numeric_limits<double>::signaling_NaN()},
         residual_ylm{std::numeric_limits<double>::signaling_NaN()},
         residual_mesh{std::numeric_limits<double>::signaling_NaN()};
+    /// Order of the time extrapolation of previous horizons that gave the
+    /// initial guess of this horizon find, or 0 if the initial guess was not
+    /// extrapolated. See `set_initial_guess_extrapolation_order`.
+    size_t initial_guess_extrapolation_order{0};
+    /// Only set when a find with an extrapolated initial guess converges: the
+    /// mean number of iterations of all previous converged finds whose
+    /// initial guess was not extrapolated, minus the number of iterations of
+    /// this find. This estimates the iterations saved by the extrapolation,
+    /// and is negative if the extrapolation did worse than the previous
+    /// horizon as an initial guess. Zero otherwise.
+    double iterations_saved{0.0};
   };
 
   struct Flow {
@@ -173,6 +184,13 @@ class FastFlow {
 
   size_t current_iteration() const { return current_iter_; }
 
+  /// Records that the initial guess of the current horizon find was obtained
+  /// by extrapolating previous horizons in time with a polynomial of order
+  /// `order`, so that it and the iterations saved by the extrapolation can be
+  /// reported in `IterInfo`. Must be called before the first iteration of a
+  /// find; `reset_for_next_find` resets the order to 0.
+  void set_initial_guess_extrapolation_order(size_t order);
+
   /// Given a Strahlkorper defined up to some maximum Y_lm l called
   /// l_surface, returns a larger value of l, l_mesh, that is used for
   /// evaluating convergence.
@@ -185,6 +203,7 @@ class FastFlow {
     previous_residual_mesh_norm_ = 0.0;
     min_residual_mesh_norm_ = std::numeric_limits<double>::max();
     iter_at_min_residual_mesh_norm_ = 0;
+    initial_guess_extrapolation_order_ = 0;
   }
 
  private:
@@ -195,6 +214,11 @@ class FastFlow {
   size_t current_iter_;
   double previous_residual_mesh_norm_, min_residual_mesh_norm_;
   size_t iter_at_min_residual_mesh_norm_;
+  size_t initial_guess_extrapolation_order_{0};
+  // Number of converged finds whose initial guess was not extrapolated in
+  // time, and the total number of iterations they needed
+  size_t unextrapolated_finds_{0};
+  size_t unextrapolated_find_iterations_{0};
 };
 
 SPECTRE_ALWAYS_INLINE bool converged(const FastFlow::Status& status) {
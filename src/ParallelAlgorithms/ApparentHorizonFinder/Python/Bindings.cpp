@@ -33,7 +33,11 @@ PYBIND11_MODULE(_Pybindings, m) {  // NOLINT
       .def_readonly("min_residual", &FastFlow::IterInfo::min_residual)
       .def_readonly("max_residual", &FastFlow::IterInfo::max_residual)
       .def_readonly("residual_ylm", &FastFlow::IterInfo::residual_ylm)
-      .def_readonly("residual_mesh", &FastFlow::IterInfo::residual_mesh);
+      .def_readonly("residual_mesh", &FastFlow::IterInfo::residual_mesh)
+      .def_readonly("initial_guess_extrapolation_order",
+                    &FastFlow::IterInfo::initial_guess_extrapolation_order)
+      .def_readonly("iterations_saved",
+                    &FastFlow::IterInfo::iterations_saved);
   py::class_<FastFlow>(m, "FastFlow")
       .def(py::init<FastFlow::FlowType, double, double, double, double, double,
                     size_t, size_t>(),
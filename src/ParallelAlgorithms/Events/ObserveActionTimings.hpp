@@ -0,0 +1,197 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <cstddef>
+#include <optional>
+#include <pup.h>
+#include <pup_stl.h>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "IO/Observer/Helpers.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/ReductionActions.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/String.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/ArrayIndex.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Invoke.hpp"
+#include "Parallel/Local.hpp"
+#include "Parallel/Reduction.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/ErrorHandling/Assert.hpp"
+#include "Utilities/Functional.hpp"
+#include "Utilities/Literals.hpp"
+#include "Utilities/Serialization/CharmPupable.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Events {
+/*!
+ * \brief %Observe the wall time spent in each action
+ *
+ * Writes reduction quantities:
+ * - `%Time` (or the observation value)
+ * - `Number of elements`
+ * - `Phase/Index:Action Total` for each action: the time spent in the action,
+ *   summed over the elements
+ * - `Phase/Index:Action Max` for each action: the maximum time spent in the
+ *   action on any element
+ * - `Phase/Index:Action Calls` for each action: the number of calls to the
+ *   action, summed over the elements
+ *
+ * The times are in seconds and accumulated since the start of the run (or the
+ * last restart from a checkpoint), so the cost of an action between two
+ * observations is the difference between two rows.
+ *
+ * The timings are recorded by the algorithm when
+ * `Initialization::ActionTimings` is used to initialize the elements and the
+ * `TimeActions` input file option is enabled. Nothing is written otherwise.
+ */
+class ObserveActionTimings : public Event {
+ private:
+  using ReductionData = Parallel::ReductionData<
+      Parallel::ReductionDatum<double, funcl::AssertEqual<>>,
+      Parallel::ReductionDatum<size_t, funcl::Plus<>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Max<>>>,
+      Parallel::ReductionDatum<std::vector<double>,
+                               funcl::ElementWise<funcl::Plus<>>>>;
+
+ public:
+  /// The name of the subfile inside the HDF5 file
+  struct SubfileName {
+    using type = std::string;
+    static constexpr Options::String help = {
+        "The name of the subfile inside the HDF5 file without an extension and "
+        "without a preceding '/'."};
+  };
+
+  /// \cond
+  explicit ObserveActionTimings(CkMigrateMessage* /*unused*/) {}
+  using PUP::able::register_constructor;
+  WRAPPED_PUPable_decl_template(ObserveActionTimings);  // NOLINT
+  /// \endcond
+
+  using options = tmpl::list<SubfileName>;
+  static constexpr Options::String help =
+      "Observe the wall time spent in each action\n"
+      "\n"
+      "Writes reduction quantities:\n"
+      " - Time (or the observation value)\n"
+      " - Number of elements\n"
+      " - The time spent in each action, summed over the elements\n"
+      " - The maximum time spent in each action on any element\n"
+      " - The number of calls to each action, summed over the elements\n"
+      "\n"
+      "The times are in seconds and accumulated since the start of the run.\n"
+      "The timings are only recorded if the TimeActions option is enabled.";
+
+  ObserveActionTimings() = default;
+  explicit ObserveActionTimings(const std::string& subfile_name)
+      : subfile_path_("/" + subfile_name) {}
+
+  using observed_reduction_data_tags =
+      observers::make_reduction_data_tags<tmpl::list<ReductionData>>;
+
+  using compute_tags_for_observation_box = tmpl::list<>;
+
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<Parallel::Tags::ActionTimings>;
+
+  template <typename ArrayIndex, typename ParallelComponent,
+            typename Metavariables>
+  void operator()(const Parallel::ActionTimings& timings,
+                  Parallel::GlobalCache<Metavariables>& cache,
+                  const ArrayIndex& array_index,
+                  const ParallelComponent* const /*meta*/,
+                  const ObservationValue& observation_value) const {
+    // All elements have the same setting, so either all or none of them
+    // contribute to the reduction
+    if (not timings.enabled()) {
+      return;
+    }
+    // An element that hasn't finished an action yet has no timings, but must
+    // contribute as many values as the others
+    const std::vector<std::string> action_names =
+        Parallel::action_timing_names<
+            typename ParallelComponent::phase_dependent_action_list>();
+    std::vector<double> seconds(action_names.size(), 0.0);
+    std::vector<double> calls(action_names.size(), 0.0);
+    if (timings.number_of_actions() != 0) {
+      ASSERT(timings.action_names() == action_names,
+             "The action timings don't belong to this parallel component.");
+      seconds = timings.seconds();
+      calls.assign(timings.calls().begin(), timings.calls().end());
+    }
+    std::vector<std::string> legend{observation_value.name,
+                                    "Number of elements"};
+    for (const auto* const suffix : {" Total", " Max", " Calls"}) {
+      for (const std::string& action_name : action_names) {
+        legend.push_back(action_name + suffix);
+      }
+    }
+
+    auto& local_observer = *Parallel::local_branch(
+        Parallel::get_parallel_component<
+            tmpl::conditional_t<Parallel::is_nodegroup_v<ParallelComponent>,
+                                observers::ObserverWriter<Metavariables>,
+                                observers::Observer<Metavariables>>>(cache));
+    observers::ObservationId observation_id{observation_value.value,
+                                            subfile_path_ + ".dat"};
+    Parallel::ArrayComponentId array_component_id{
+        std::add_pointer_t<ParallelComponent>{nullptr},
+        Parallel::ArrayIndex<ArrayIndex>(array_index)};
+    ReductionData reduction_data{observation_value.value, 1_st, seconds,
+                                 seconds, std::move(calls)};
+
+    if constexpr (Parallel::is_nodegroup_v<ParallelComponent>) {
+      Parallel::threaded_action<
+          observers::ThreadedActions::CollectReductionDataOnNode>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    } else {
+      Parallel::simple_action<observers::Actions::ContributeReductionData>(
+          local_observer, std::move(observation_id),
+          std::move(array_component_id), subfile_path_, std::move(legend),
+          std::move(reduction_data));
+    }
+  }
+
+  using observation_registration_tags = tmpl::list<>;
+  std::pair<observers::TypeOfObservation, observers::ObservationKey>
+  get_observation_type_and_key_for_registration() const {
+    return {observers::TypeOfObservation::Reduction,
+            observers::ObservationKey(subfile_path_ + ".dat")};
+  }
+
+  using is_ready_argument_tags = tmpl::list<>;
+
+  template <typename Metavariables, typename ArrayIndex, typename Component>
+  bool is_ready(Parallel::GlobalCache<Metavariables>& /*cache*/,
+                const ArrayIndex& /*array_index*/,
+                const Component* const /*meta*/) const {
+    return true;
+  }
+
+  bool needs_evolved_variables() const override { return false; }
+
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& p) override {
+    Event::pup(p);
+    p | subfile_path_;
+  }
+
+ private:
+  std::string subfile_path_;
+};
+}  // namespace Events
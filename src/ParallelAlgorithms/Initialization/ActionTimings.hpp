@@ -0,0 +1,34 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include "Parallel/ActionTimings.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Initialization {
+/// \ingroup InitializationGroup
+/// \brief Add `Parallel::Tags::ActionTimings` to the DataBox so the algorithm
+/// records the time spent in each action.
+///
+/// Whether timings are recorded is set with the `TimeActions` input file
+/// option.
+///
+/// DataBox changes:
+/// - Adds:
+///   * `Parallel::Tags::ActionTimings`
+/// - Removes: nothing
+/// - Modifies: nothing
+struct ActionTimings {
+  using const_global_cache_tags = tmpl::list<>;
+  using mutable_global_cache_tags = tmpl::list<>;
+  using simple_tags_from_options = tmpl::list<Parallel::Tags::ActionTimings>;
+  using simple_tags = tmpl::list<>;
+  using compute_tags = tmpl::list<>;
+
+  using argument_tags = tmpl::list<>;
+  using return_tags = tmpl::list<>;
+
+  static void apply() {}
+};
+}  // namespace Initialization
@@ -58,6 +58,7 @@ CREATE_IS_CALLABLE_V(initialize)
 ///   - `Tags::TemporalIds<TemporalId>`
 ///   - `Tags::CompletedTemporalIds<TemporalId>`
 ///   - `Tags::InterpolatedVars<InterpolationTargetTag,TemporalId>`
+///   - `Tags::BlockSpatialIndex<Metavariables::volume_dim>`
 ///   - `::Tags::Variables<typename
 ///                   InterpolationTargetTag::vars_to_interpolate_to_target>`
 /// - Removes: nothing
@@ -73,6 +74,7 @@ struct InitializeInterpolationTarget {
       Tags::PendingTemporalIds<TemporalId>, Tags::TemporalIds<TemporalId>,
       Tags::CompletedTemporalIds<TemporalId>,
       Tags::InterpolatedVars<InterpolationTargetTag, TemporalId>,
+      Tags::BlockSpatialIndex<Metavariables::volume_dim>,
       ::Tags::Variables<
           typename InterpolationTargetTag::vars_to_interpolate_to_target>>;
 
@@ -58,7 +58,7 @@ struct SendPointsToInterpolator {
                     const TemporalId& temporal_id,
                     const size_t iteration = 0_st) {
     auto coords = InterpolationTarget_detail::block_logical_coords<
-        InterpolationTargetTag>(box, cache, temporal_id);
+        InterpolationTargetTag>(make_not_null(&box), cache, temporal_id);
     InterpolationTarget_detail::set_up_interpolation<InterpolationTargetTag>(
         make_not_null(&box), temporal_id, coords);
 
@@ -15,6 +15,7 @@
 #include "DataStructures/Tensor/Metafunctions.hpp"
 #include "DataStructures/VariablesTag.hpp"
 #include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSpatialIndex.hpp"
 #include "Domain/CoordinateMaps/Composition.hpp"
 #include "Domain/Creators/Tags/Domain.hpp"
 #include "Domain/ElementToBlockLogicalMap.hpp"
@@ -22,6 +23,7 @@
 #include "Parallel/GlobalCache.hpp"
 #include "Parallel/Invoke.hpp"
 #include "Parallel/ParallelComponentHelpers.hpp"
+#include "ParallelAlgorithms/Interpolation/Tags.hpp"
 #include "ParallelAlgorithms/Interpolation/TagsMetafunctions.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/Gsl.hpp"
@@ -509,6 +511,12 @@ void add_received_variables(
 ///
 /// block_logical_coords is called by an Action of InterpolationTarget.
 ///
+/// If a `spatial_index` is passed, only the maps of the blocks whose bounding
+/// boxes contain a point are inverted. The index is built from the `Domain`
+/// if it is empty, and refreshed at the time of `temporal_id` if the maps are
+/// time-dependent, so it should be kept (e.g. in
+/// `intrp::Tags::BlockSpatialIndex`) across calls.
+///
 /// Currently one Action directly calls this version of block_logical_coords:
 /// - InterpolationTargetSendTimeIndepPointsToElements
 ///   (in InterpolationTarget ActionList)
@@ -522,15 +530,32 @@ auto block_logical_coords(
     const tnsr::I<
         DataVector, Metavariables::volume_dim,
         typename InterpolationTargetTag::compute_target_points::frame>& coords,
-    const TemporalId& temporal_id) {
+    const TemporalId& temporal_id,
+    domain::BlockSpatialIndex<Metavariables::volume_dim>* const spatial_index =
+        nullptr) {
   const auto& domain =
       get<domain::Tags::Domain<Metavariables::volume_dim>>(cache);
+  if (spatial_index != nullptr and
+      spatial_index->number_of_blocks() != domain.blocks().size()) {
+    *spatial_index =
+        domain::BlockSpatialIndex<Metavariables::volume_dim>{domain};
+  }
+  const auto lookup = [&coords, &domain, &spatial_index](
+                          const auto&... time_and_functions_of_time) {
+    if (spatial_index != nullptr) {
+      return ::block_logical_coordinates(domain, *spatial_index, coords,
+                                         time_and_functions_of_time...);
+    } else {
+      return ::block_logical_coordinates(domain, coords,
+                                         time_and_functions_of_time...);
+    }
+  };
   if constexpr (std::is_same_v<typename InterpolationTargetTag::
                                    compute_target_points::frame,
                                ::Frame::Grid>) {
     // Frame is grid frame, so don't need any FunctionsOfTime,
     // whether or not the maps are time_dependent.
-    return ::block_logical_coordinates(domain, coords);
+    return lookup();
   }
 
   if (domain.is_time_dependent()) {
@@ -540,10 +565,12 @@ auto block_logical_coords(
       // time-dependent is responsible for ensuring
       // that functions_of_time are up to date at temporal_id.
       const auto& functions_of_time = get<domain::Tags::FunctionsOfTime>(cache);
-      return ::block_logical_coordinates(
-          domain, coords,
-          InterpolationTarget_detail::get_temporal_id_value(temporal_id),
-          functions_of_time);
+      const double time =
+          InterpolationTarget_detail::get_temporal_id_value(temporal_id);
+      if (spatial_index != nullptr and spatial_index->time() != time) {
+        spatial_index->update(domain, time, functions_of_time);
+      }
+      return lookup(time, functions_of_time);
     } else {
       // We error here because the maps are time-dependent, yet
       // the cache does not contain FunctionsOfTime.  It would be
@@ -561,7 +588,7 @@ auto block_logical_coords(
   }
 
   // Time-independent case.
-  return ::block_logical_coordinates(domain, coords);
+  return lookup();
 }
 
 /// Version of block_logical_coords that computes the interpolation
@@ -587,6 +614,35 @@ auto block_logical_coords(const db::DataBox<DbTags>& box,
       temporal_id);
 }
 
+/// Same as above, but uses and updates the `intrp::Tags::BlockSpatialIndex`
+/// in the DataBox, if there is one.
+template <typename InterpolationTargetTag, typename DbTags,
+          typename Metavariables, typename TemporalId>
+auto block_logical_coords(const gsl::not_null<db::DataBox<DbTags>*> box,
+                          const Parallel::GlobalCache<Metavariables>& cache,
+                          const TemporalId& temporal_id) {
+  using spatial_index_tag = Tags::BlockSpatialIndex<Metavariables::volume_dim>;
+  if constexpr (db::tag_is_retrievable_v<spatial_index_tag,
+                                         db::DataBox<DbTags>>) {
+    auto coords = InterpolationTargetTag::compute_target_points::points(
+        *box, tmpl::type_<Metavariables>{}, temporal_id);
+    std::vector<BlockLogicalCoords<Metavariables::volume_dim>> result{};
+    db::mutate<spatial_index_tag>(
+        [&cache, &coords, &result, &temporal_id](
+            const gsl::not_null<
+                domain::BlockSpatialIndex<Metavariables::volume_dim>*>
+                spatial_index) {
+          result = block_logical_coords<InterpolationTargetTag>(
+              cache, coords, temporal_id, spatial_index.get());
+        },
+        box);
+    return result;
+  } else {
+    return block_logical_coords<InterpolationTargetTag>(*box, cache,
+                                                        temporal_id);
+  }
+}
+
 /// Version of block_logical_coords for when the coords are
 /// time-independent.
 template <typename InterpolationTargetTag, typename DbTags,
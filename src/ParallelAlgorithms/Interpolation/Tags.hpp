@@ -13,6 +13,7 @@
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
 #include "DataStructures/DataBox/Tag.hpp"
 #include "DataStructures/Variables.hpp"
+#include "Domain/BlockSpatialIndex.hpp"
 #include "NumericalAlgorithms/Spectral/Mesh.hpp"
 #include "Options/String.hpp"
 #include "ParallelAlgorithms/Interpolation/InterpolatedVars.hpp"
@@ -108,6 +109,17 @@ struct CompletedTemporalIds : db::SimpleTag {
   using type = std::deque<TemporalId>;
 };
 
+/// Bounding boxes of the blocks of the `Domain`, used by an
+/// InterpolationTarget to skip blocks that cannot contain a target point.
+///
+/// The index is built from the `Domain` the first time it is needed, and the
+/// boxes of time-dependent blocks are refreshed with
+/// `domain::BlockSpatialIndex::update` when the time changes.
+template <size_t VolumeDim>
+struct BlockSpatialIndex : db::SimpleTag {
+  using type = domain::BlockSpatialIndex<VolumeDim>;
+};
+
 /// Holds interpolated variables on an InterpolationTarget.
 template <typename InterpolationTargetTag, typename TemporalId>
 struct InterpolatedVars : db::SimpleTag {
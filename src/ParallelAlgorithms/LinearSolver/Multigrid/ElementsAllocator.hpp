@@ -114,6 +114,8 @@ struct ElementsAllocator
         Parallel::get<elliptic::dg::Tags::Quadrature>(local_cache);
     const std::optional<domain::ElementWeight>& element_weight =
         get<domain::Tags::ElementDistribution>(local_cache);
+    const domain::SpaceFillingCurve element_ordering =
+        get<domain::Tags::ElementOrdering>(local_cache);
     std::optional<size_t> max_levels =
         get<Tags::MaxLevels<OptionsGroup>>(local_cache);
     const size_t number_of_procs =
@@ -190,7 +192,8 @@ struct ElementsAllocator
         const domain::BlockZCurveProcDistribution<Dim> element_distribution{
             element_costs,   num_of_procs_to_use,
             blocks,          initial_refinement_levels,
-            initial_extents, procs_to_ignore};
+            initial_extents, procs_to_ignore,
+            element_ordering};
 
         for (const auto& element_id : element_ids) {
           const size_t target_proc =
@@ -3,17 +3,44 @@
 
 #include "PointwiseFunctions/Hydro/EquationsOfState/Tabulated3d.hpp"
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <cstddef>
 #include <limits>
+#include <type_traits>
 
 #include "DataStructures/DataVector.hpp"  // IWYU pragma: keep
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "NumericalAlgorithms/RootFinding/TOMS748.hpp"
 #include "PointwiseFunctions/Hydro/Units.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Simd/Simd.hpp"
 
 // IWYU pragma: no_forward_declare Tensor
 
 namespace EquationsOfState {
+namespace {
+// Loads `simd::size<T>()` values, where `T` is either a SIMD batch or `double`
+template <typename T>
+T load(const double* const data) {
+  if constexpr (std::is_same_v<T, double>) {
+    return *data;
+  } else {
+    return simd::load_unaligned(data);
+  }
+}
+
+template <typename T>
+void store(const gsl::not_null<double*> data, const T& value) {
+  if constexpr (std::is_same_v<T, double>) {
+    *data = value;
+  } else {
+    simd::store_unaligned(data.get(), value);
+  }
+}
+}  // namespace
 
 EQUATION_OF_STATE_MEMBER_DEFINITIONS(template <bool IsRelativistic>,
                                      Tabulated3D<IsRelativistic>, double, 3)
@@ -306,6 +333,214 @@ void Tabulated3D<IsRelativistic>::enforce_physicality(
   }
 }
 
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::convert_batch_to_table_quantities(
+    const gsl::not_null<BatchBuffer*> converted_electron_fraction,
+    const gsl::not_null<BatchBuffer*> log_rest_mass_density,
+    const DataVector& electron_fraction, const DataVector& rest_mass_density,
+    const size_t offset, const size_t number_of_points) const {
+  const double electron_fraction_lower = electron_fraction_lower_bound();
+  const double electron_fraction_upper = electron_fraction_upper_bound();
+  const double rest_mass_density_lower = rest_mass_density_lower_bound();
+  const double rest_mass_density_upper = rest_mass_density_upper_bound();
+  for (size_t s = 0; s < number_of_points; ++s) {
+    gsl::at(*converted_electron_fraction, s) =
+        std::max(std::min(electron_fraction[offset + s],
+                          electron_fraction_upper),
+                 electron_fraction_lower);
+    gsl::at(*log_rest_mass_density, s) = std::log(
+        std::max(std::min(rest_mass_density[offset + s],
+                          rest_mass_density_upper),
+                 rest_mass_density_lower));
+  }
+}
+
+template <bool IsRelativistic>
+template <size_t... Variables>
+void Tabulated3D<IsRelativistic>::interpolate_in_batches(
+    const std::array<gsl::span<double>, sizeof...(Variables)>& results,
+    const DataVector& rest_mass_density, const DataVector& temperature,
+    const DataVector& electron_fraction) const {
+  const double temperature_lower = temperature_lower_bound();
+  const double temperature_upper = temperature_upper_bound();
+  BatchBuffer converted_electron_fraction{};
+  BatchBuffer log_rest_mass_density{};
+  BatchBuffer log_temperature{};
+  std::array<gsl::span<double>, sizeof...(Variables)> batch_results{};
+  const size_t total_number_of_points = electron_fraction.size();
+  for (size_t offset = 0; offset < total_number_of_points;
+       offset += batch_size_) {
+    const size_t number_of_points =
+        std::min(batch_size_, total_number_of_points - offset);
+    convert_batch_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), electron_fraction,
+        rest_mass_density, offset, number_of_points);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      gsl::at(log_temperature, s) = std::log(std::max(
+          std::min(temperature[offset + s], temperature_upper),
+          temperature_lower));
+    }
+    for (size_t i = 0; i < sizeof...(Variables); ++i) {
+      gsl::at(batch_results, i) =
+          gsl::span<double>{&gsl::at(results, i)[offset], number_of_points};
+    }
+    interpolator_.template interpolate<Variables...>(
+        batch_results,
+        {{gsl::span<const double>{log_temperature.data(), number_of_points},
+          gsl::span<const double>{log_rest_mass_density.data(),
+                                  number_of_points},
+          gsl::span<const double>{converted_electron_fraction.data(),
+                                  number_of_points}}});
+  }
+}
+
+template <bool IsRelativistic>
+void Tabulated3D<IsRelativistic>::
+    temperature_from_density_and_energy_in_batches(
+        const gsl::not_null<DataVector*> temperature,
+        const DataVector& rest_mass_density,
+        const DataVector& specific_internal_energy,
+        const DataVector& electron_fraction) const {
+  using simd_type =
+      std::decay_t<decltype(simd::load_unaligned(temperature->data()))>;
+  constexpr size_t simd_width = simd::size<simd_type>();
+  static_assert(batch_size_ % simd_width == 0,
+                "The batch size must be a multiple of the SIMD width.");
+
+  // Same bounds as in the `double` overload
+  const double log_temperature_lower = table_log_temperature_.front();
+  const double log_temperature_upper =
+      upper_bound_tolerance_ * table_log_temperature_.back();
+  const double log_temperature_at_energy_lower =
+      log(temperature_lower_bound());
+  const double log_temperature_at_energy_upper =
+      log(upper_bound_tolerance_ * temperature_upper_bound());
+
+  BatchBuffer converted_electron_fraction{};
+  BatchBuffer log_rest_mass_density{};
+  BatchBuffer log_temperature{};
+  BatchBuffer log_specific_internal_energy{};
+  BatchBuffer f_at_lower_bound{};
+  BatchBuffer f_at_upper_bound{};
+  const size_t total_number_of_points = electron_fraction.size();
+  for (size_t offset = 0; offset < total_number_of_points;
+       offset += batch_size_) {
+    const size_t number_of_points =
+        std::min(batch_size_, total_number_of_points - offset);
+    convert_batch_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), electron_fraction,
+        rest_mass_density, offset, number_of_points);
+
+    // Interpolates the log of the shifted specific internal energy at fixed
+    // temperature to all points in the batch
+    const auto interpolate_energy = [this, &converted_electron_fraction,
+                                     &log_rest_mass_density, &log_temperature,
+                                     number_of_points](
+                                        const gsl::not_null<BatchBuffer*>
+                                            result,
+                                        const double log_T) {
+      std::fill(log_temperature.begin(),
+                log_temperature.begin() + number_of_points, log_T);
+      interpolator_.template interpolate<Epsilon>(
+          {{gsl::span<double>{result->data(), number_of_points}}},
+          {{gsl::span<const double>{log_temperature.data(), number_of_points},
+            gsl::span<const double>{log_rest_mass_density.data(),
+                                    number_of_points},
+            gsl::span<const double>{converted_electron_fraction.data(),
+                                    number_of_points}}});
+    };
+
+    // Check bounds on eps, note that eps may be negative
+    interpolate_energy(make_not_null(&f_at_lower_bound),
+                       log_temperature_at_energy_lower);
+    interpolate_energy(make_not_null(&f_at_upper_bound),
+                       log_temperature_at_energy_upper);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      gsl::at(log_specific_internal_energy, s) =
+          log(std::max(std::min(specific_internal_energy[offset + s],
+                                exp(gsl::at(f_at_upper_bound, s)) +
+                                    energy_shift_),
+                       exp(gsl::at(f_at_lower_bound, s)) + energy_shift_) -
+              energy_shift_);
+    }
+
+    interpolate_energy(make_not_null(&f_at_lower_bound),
+                       log_temperature_lower);
+    interpolate_energy(make_not_null(&f_at_upper_bound),
+                       log_temperature_upper);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      gsl::at(f_at_lower_bound, s) =
+          gsl::at(log_specific_internal_energy, s) -
+          gsl::at(f_at_lower_bound, s);
+      gsl::at(f_at_upper_bound, s) =
+          gsl::at(log_specific_internal_energy, s) -
+          gsl::at(f_at_upper_bound, s);
+    }
+
+    // Finds the roots of the `simd::size<T>()` points starting at `s`, where
+    // `T` is either a SIMD batch or `double`
+    const auto invert_table = [this, &temperature, &converted_electron_fraction,
+                               &log_rest_mass_density,
+                               &log_specific_internal_energy, &f_at_lower_bound,
+                               &f_at_upper_bound, offset, log_temperature_lower,
+                               log_temperature_upper](const size_t s,
+                                                      const auto type_tag) {
+      using T = std::decay_t<decltype(type_tag)>;
+      constexpr size_t width = simd::size<T>();
+      const T log_eps = load<T>(&gsl::at(log_specific_internal_energy, s));
+      const T f_lower = load<T>(&gsl::at(f_at_lower_bound, s));
+      const T f_upper = load<T>(&gsl::at(f_at_upper_bound, s));
+
+      // Check bounds to avoid error in TOMS748 if bracket is zero
+      const auto lower_is_root = simd::abs(f_lower) <= T(1.0e-14);
+      const auto upper_is_root = simd::abs(f_upper) <= T(1.0e-14);
+      const auto ignore = lower_is_root or upper_is_root;
+      T root = simd::select(upper_is_root, T(table_log_temperature_.back()),
+                            T(log_temperature_lower));
+      if (not simd::all(ignore)) {
+        const auto f = [this, &converted_electron_fraction,
+                        &log_rest_mass_density, &log_eps, &ignore, &root,
+                        s](const T& log_T) {
+          std::array<double, width> trial_log_temperature{};
+          std::array<double, width> interpolated_log_eps{};
+          // TOMS748 also evaluates the ignored points, at arbitrary and
+          // possibly non-finite values that can't be looked up in the table
+          store(make_not_null(trial_log_temperature.data()),
+                simd::select(ignore, root, log_T));
+          interpolator_.template interpolate<Epsilon>(
+              {{gsl::span<double>{interpolated_log_eps.data(), width}}},
+              {{gsl::span<const double>{trial_log_temperature.data(), width},
+                gsl::span<const double>{&gsl::at(log_rest_mass_density, s),
+                                        width},
+                gsl::span<const double>{
+                    &gsl::at(converted_electron_fraction, s), width}}});
+          return log_eps - load<T>(interpolated_log_eps.data());
+        };
+        // The ignored points get a valid bracket so TOMS748 doesn't error
+        root = simd::select(
+            ignore, root,
+            RootFinder::toms748(f, T(log_temperature_lower),
+                                T(log_temperature_upper),
+                                simd::select(ignore, T(-1.0), f_lower),
+                                simd::select(ignore, T(1.0), f_upper), 1.0e-14,
+                                1.0e-15, 100, ignore));
+      }
+      store(make_not_null(&(*temperature)[offset + s]), simd::exp(root));
+    };
+
+    const size_t vectorized_size =
+        number_of_points - number_of_points % simd_width;
+    for (size_t s = 0; s < vectorized_size; s += simd_width) {
+      invert_table(s, simd_type{});
+    }
+    for (size_t s = vectorized_size; s < number_of_points; ++s) {
+      invert_table(s, double{});
+    }
+  }
+}
+
 template <bool IsRelativistic>
 template <class DataType>
 Scalar<DataType>
@@ -327,19 +562,19 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
     const Scalar<DataType>& rest_mass_density,
     const Scalar<DataType>& temperature,
     const Scalar<DataType>& electron_fraction) const {
-  Scalar<DataType> converted_electron_fraction;
-  Scalar<DataType> log_rest_mass_density;
-  Scalar<DataType> log_temperature;
-
-  convert_to_table_quantities(
-      make_not_null(&converted_electron_fraction),
-      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
-      electron_fraction, rest_mass_density, temperature);
-
   Scalar<DataType> pressure =
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
+    Scalar<DataType> converted_electron_fraction;
+    Scalar<DataType> log_rest_mass_density;
+    Scalar<DataType> log_temperature;
+
+    convert_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+        electron_fraction, rest_mass_density, temperature);
+
     auto weights = interpolator_.get_weights(get(log_temperature),
                                              get(log_rest_mass_density),
                                              get(converted_electron_fraction));
@@ -348,14 +583,10 @@ Tabulated3D<IsRelativistic>::pressure_from_density_and_temperature_impl(
     get(pressure) = std::exp(interpolated_state[0]);
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Pressure>(weights);
-      get(pressure)[s] = std::exp(interpolated_state[0]);
-    }
+    interpolate_in_batches<Pressure>(
+        {{gsl::span<double>{get(pressure).data(), get(pressure).size()}}},
+        get(rest_mass_density), get(temperature), get(electron_fraction));
+    get(pressure) = exp(get(pressure));
   }
 
   return pressure;
@@ -383,46 +614,35 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
     const Scalar<DataType>& rest_mass_density,
     const Scalar<DataType>& specific_internal_energy,
     const Scalar<DataType>& electron_fraction) const {
-  Scalar<DataType> converted_electron_fraction;
-  Scalar<DataType> log_rest_mass_density;
+  if constexpr (std::is_same_v<DataType, double>) {
+    Scalar<DataType> converted_electron_fraction;
+    Scalar<DataType> log_rest_mass_density;
 
-  Scalar<DataType> log_temperature;
-  Scalar<DataType> temperature;
+    Scalar<DataType> log_temperature;
+    Scalar<DataType> temperature;
 
-  temperature = make_with_value<Scalar<DataType>>(rest_mass_density,
-                                                  temperature_lower_bound());
+    temperature = make_with_value<Scalar<DataType>>(rest_mass_density,
+                                                    temperature_lower_bound());
 
-  convert_to_table_quantities(
-      make_not_null(&converted_electron_fraction),
-      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
-      electron_fraction, rest_mass_density, temperature);
+    convert_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+        electron_fraction, rest_mass_density, temperature);
 
-  // Check bounds on eps, note that eps may be negative
-  Scalar<DataType> log_specific_internal_energy = specific_internal_energy;
+    // Check bounds on eps, note that eps may be negative
+    Scalar<DataType> log_specific_internal_energy = specific_internal_energy;
 
-  if constexpr (std::is_same_v<DataType, double>) {
     get(log_specific_internal_energy) =
         std::max(std::min(get(specific_internal_energy),
                           specific_internal_energy_upper_bound(
                               get(rest_mass_density), get(electron_fraction))),
                  specific_internal_energy_lower_bound(get(rest_mass_density),
                                                       get(electron_fraction)));
-  } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      get(log_specific_internal_energy)[s] = std::max(
-          std::min(get(specific_internal_energy)[s],
-                   specific_internal_energy_upper_bound(
-                       get(rest_mass_density)[s], get(electron_fraction)[s])),
-          specific_internal_energy_lower_bound(get(rest_mass_density)[s],
-                                               get(electron_fraction)[s]));
-    }
-  }
 
-  // Correct for negative eps
-  get(log_specific_internal_energy) -= energy_shift_;
-  get(log_specific_internal_energy) = log(get(log_specific_internal_energy));
+    // Correct for negative eps
+    get(log_specific_internal_energy) -= energy_shift_;
+    get(log_specific_internal_energy) = log(get(log_specific_internal_energy));
 
-  if constexpr (std::is_same_v<DataType, double>) {
     const auto& log_eps = get(log_specific_internal_energy);
     const auto& log_rho = get(log_rest_mass_density);
     const auto& ye = get(converted_electron_fraction);
@@ -458,45 +678,14 @@ Tabulated3D<IsRelativistic>::temperature_from_density_and_energy_impl(
 
     get(temperature) = exp(root_from_lambda);
 
-  } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      const auto& log_eps = get(log_specific_internal_energy)[s];
-      const auto& log_rho = get(log_rest_mass_density)[s];
-      const auto& ye = get(converted_electron_fraction)[s];
-
-      // Root-finding appropriate between reference density and maximum density
-      // We can use x=0 and x=x_max as bounds
-      const auto f = [this, log_eps, log_rho, ye](const double log_T) {
-        const auto weights = interpolator_.get_weights(log_T, log_rho, ye);
-        const auto interpolated_values =
-            interpolator_.template interpolate<Epsilon>(weights);
-
-        return log_eps - interpolated_values[0];
-      };
-
-      // Check bounds to avoid error in TOMS748 if bracket is zero
-      bool need_root_finding = true;
-      double root_from_lambda = table_log_temperature_.front();
-      if (fabs(f(table_log_temperature_.front())) <= 1.0e-14) {
-        need_root_finding = false;
-      }
-
-      if (fabs(f(upper_bound_tolerance_ * table_log_temperature_.back())) <=
-          1.0e-14) {
-        root_from_lambda = table_log_temperature_.back();
-        need_root_finding = false;
-      }
-      if (need_root_finding) {
-        root_from_lambda = RootFinder::toms748(
-            f, table_log_temperature_.front(),
-            upper_bound_tolerance_ * table_log_temperature_.back(), 1.0e-14,
-            1.0e-15);
-      }
-
-      get(temperature)[s] = exp(root_from_lambda);
-    }
+    return temperature;
+  } else {
+    Scalar<DataVector> temperature{get(rest_mass_density).size()};
+    temperature_from_density_and_energy_in_batches(
+        make_not_null(&get(temperature)), get(rest_mass_density),
+        get(specific_internal_energy), get(electron_fraction));
+    return temperature;
   }
-  return temperature;
 }
 
 template <bool IsRelativistic>
@@ -506,19 +695,19 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
         const Scalar<DataType>& rest_mass_density,
         const Scalar<DataType>& temperature,
         const Scalar<DataType>& electron_fraction) const {
-  Scalar<DataType> converted_electron_fraction;
-  Scalar<DataType> log_rest_mass_density;
-  Scalar<DataType> log_temperature;
-
-  convert_to_table_quantities(
-      make_not_null(&converted_electron_fraction),
-      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
-      electron_fraction, rest_mass_density, temperature);
-
   Scalar<DataType> specific_internal_energy =
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
+    Scalar<DataType> converted_electron_fraction;
+    Scalar<DataType> log_rest_mass_density;
+    Scalar<DataType> log_temperature;
+
+    convert_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+        electron_fraction, rest_mass_density, temperature);
+
     auto weights = interpolator_.get_weights(get(log_temperature),
                                              get(log_rest_mass_density),
                                              get(converted_electron_fraction));
@@ -527,15 +716,12 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(specific_internal_energy) =
         std::exp(interpolated_state[0]) + energy_shift_;
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<Epsilon>(weights);
-      get(specific_internal_energy)[s] =
-          std::exp(interpolated_state[0]) + energy_shift_;
-    }
+    interpolate_in_batches<Epsilon>(
+        {{gsl::span<double>{get(specific_internal_energy).data(),
+                            get(specific_internal_energy).size()}}},
+        get(rest_mass_density), get(temperature), get(electron_fraction));
+    get(specific_internal_energy) =
+        exp(get(specific_internal_energy)) + energy_shift_;
   }
 
   return specific_internal_energy;
@@ -548,19 +734,19 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
         const Scalar<DataType>& rest_mass_density,
         const Scalar<DataType>& temperature,
         const Scalar<DataType>& electron_fraction) const {
-  Scalar<DataType> converted_electron_fraction;
-  Scalar<DataType> log_rest_mass_density;
-  Scalar<DataType> log_temperature;
-
-  convert_to_table_quantities(
-      make_not_null(&converted_electron_fraction),
-      make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
-      electron_fraction, rest_mass_density, temperature);
-
   Scalar<DataType> cs2 =
       make_with_value<Scalar<DataType>>(get(rest_mass_density), 0.0);
 
   if constexpr (std::is_same_v<DataType, double>) {
+    Scalar<DataType> converted_electron_fraction;
+    Scalar<DataType> log_rest_mass_density;
+    Scalar<DataType> log_temperature;
+
+    convert_to_table_quantities(
+        make_not_null(&converted_electron_fraction),
+        make_not_null(&log_rest_mass_density), make_not_null(&log_temperature),
+        electron_fraction, rest_mass_density, temperature);
+
     auto weights = interpolator_.get_weights(get(log_temperature),
                                              get(log_rest_mass_density),
                                              get(converted_electron_fraction));
@@ -569,14 +755,9 @@ Scalar<DataType> Tabulated3D<IsRelativistic>::
     get(cs2) = interpolated_state[0];
 
   } else if constexpr (std::is_same_v<DataType, DataVector>) {
-    for (size_t s = 0; s < get(electron_fraction).size(); ++s) {
-      auto weights = interpolator_.get_weights(
-          get(log_temperature)[s], get(log_rest_mass_density)[s],
-          get(converted_electron_fraction)[s]);
-      auto interpolated_state =
-          interpolator_.template interpolate<CsSquared>(weights);
-      get(cs2)[s] = interpolated_state[0];
-    }
+    interpolate_in_batches<CsSquared>(
+        {{gsl::span<double>{get(cs2).data(), get(cs2).size()}}},
+        get(rest_mass_density), get(temperature), get(electron_fraction));
   }
 
   return cs2;
@@ -10,6 +10,8 @@
 #include <boost/preprocessor/repetition/for.hpp>
 #include <boost/preprocessor/repetition/repeat.hpp>
 #include <boost/preprocessor/tuple/to_list.hpp>
+#include <array>
+#include <cstddef>
 #include <limits>
 #include <pup.h>
 
@@ -20,6 +22,7 @@
 #include "Options/String.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/EquationOfState.hpp"  // IWYU pragma: keep
 #include "PointwiseFunctions/Hydro/Units.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/Serialization/CharmPupable.hpp"
 #include "Utilities/TMPL.hpp"
 
@@ -224,6 +227,38 @@ class Tabulated3D : public EquationOfState<IsRelativistic, 3> {
 
   void initialize_interpolator();
 
+  /// Number of points the `DataVector` overloads convert to table coordinates
+  /// at once. The converted points are kept in buffers of this size on the
+  /// stack instead of in temporaries of the size of the input.
+  static constexpr size_t batch_size_ = 64;
+  using BatchBuffer = std::array<double, batch_size_>;
+
+  /// Clamps the `number_of_points` points starting at `offset` to the table
+  /// bounds and stores \f$Y_e\f$ and \f$\log \rho\f$ in the buffers
+  void convert_batch_to_table_quantities(
+      gsl::not_null<BatchBuffer*> converted_electron_fraction,
+      gsl::not_null<BatchBuffer*> log_rest_mass_density,
+      const DataVector& electron_fraction, const DataVector& rest_mass_density,
+      size_t offset, size_t number_of_points) const;
+
+  /// Interpolates the tabulated `Variables` to all points, which are
+  /// converted to table coordinates and interpolated in batches of
+  /// `batch_size_`
+  template <size_t... Variables>
+  void interpolate_in_batches(
+      const std::array<gsl::span<double>, sizeof...(Variables)>& results,
+      const DataVector& rest_mass_density, const DataVector& temperature,
+      const DataVector& electron_fraction) const;
+
+  /// Inverts the table for the temperature at all points. The root finds of
+  /// the points in a SIMD batch run simultaneously, interpolating the table to
+  /// all of them at once.
+  void temperature_from_density_and_energy_in_batches(
+      gsl::not_null<DataVector*> temperature,
+      const DataVector& rest_mass_density,
+      const DataVector& specific_internal_energy,
+      const DataVector& electron_fraction) const;
+
   /// Energy shift used to account for negative specific internal energies,
   /// which are only stored logarithmically
   double energy_shift_ = 0.;
@@ -228,6 +228,15 @@ class BoundaryHistory {
     void insert_initial(const TimeStepId& id, size_t integration_order,
                         Data data) const;
 
+    /// Remove and return the data of the entry most recently removed by
+    /// `pop_front()` or `clear_substeps()`, if any.
+    ///
+    /// This allows the memory owned by removed entries to be reused for new
+    /// entries instead of being freed.  The removed data is not serialized.
+    /// Only the local side keeps removed data: the remote data is built from
+    /// received messages, so there is no allocation to reuse.
+    std::optional<Data> take_removed_data() const;
+
    private:
     friend class BoundaryHistory;
     friend class ConstSideAccess<Local>;
@@ -345,6 +354,9 @@ class BoundaryHistory {
   StaticDeque<StepData<LocalData>, history_max_past_steps + 2> local_data_{};
   CircularDeque<StepData<RemoteData>> remote_data_{};
 
+  // The data of the most recently removed local entry, kept for reuse
+  std::optional<LocalData> removed_local_data_{};
+
   template <typename Data>
   using CouplingSubsteps =
       boost::container::static_vector<Data, history_max_substeps + 1>;
@@ -439,6 +451,16 @@ void BoundaryHistory<LocalData, RemoteData, CouplingResult>::MutableSideAccess<
   }
 }
 
+template <typename LocalData, typename RemoteData, typename CouplingResult>
+template <bool Local>
+auto BoundaryHistory<LocalData, RemoteData, CouplingResult>::MutableSideAccess<
+    Local>::take_removed_data() const -> std::optional<Data> {
+  static_assert(Local, "Removed data is only kept for the local side.");
+  std::optional<Data> result = std::move(this->parent_->removed_local_data_);
+  this->parent_->removed_local_data_.reset();
+  return result;
+}
+
 template <typename LocalData, typename RemoteData, typename CouplingResult>
 template <typename Coupling>
 auto BoundaryHistory<LocalData, RemoteData, CouplingResult>::EvaluatorImpl<
@@ -598,6 +620,8 @@ void BoundaryHistory<LocalData, RemoteData, CouplingResult>::
 
 template <typename LocalData, typename RemoteData, typename CouplingResult>
 void BoundaryHistory<LocalData, RemoteData, CouplingResult>::pop_local() {
+  removed_local_data_.emplace(
+      std::move(local_data_.front().substeps.back().data));
   local_data_.pop_front();
   for (auto& remote_step : couplings_) {
     for (auto& remote_substep : remote_step) {
@@ -615,6 +639,9 @@ void BoundaryHistory<LocalData, RemoteData, CouplingResult>::pop_remote() {
 template <typename LocalData, typename RemoteData, typename CouplingResult>
 void BoundaryHistory<LocalData, RemoteData,
                      CouplingResult>::clear_substeps_local(const size_t n) {
+  if (local_data_[n].substeps.size() > 1) {
+    removed_local_data_.emplace(std::move(local_data_[n].substeps.back().data));
+  }
   local_data_[n].substeps.erase(local_data_[n].substeps.begin() + 1,
                                 local_data_[n].substeps.end());
   for (auto& remote_step : couplings_) {
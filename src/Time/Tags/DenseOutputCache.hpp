@@ -0,0 +1,49 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#pragma once
+
+#include <limits>
+#include <optional>
+#include <pup.h>
+
+#include "DataStructures/DataBox/Tag.hpp"
+#include "Time/Time.hpp"
+#include "Time/TimeStepId.hpp"
+
+namespace Tags {
+/// \ingroup DataBoxTagsGroup
+/// \ingroup TimeGroup
+/// \brief The result of a dense output of the variables in `VariablesTag`
+/// that may be needed again.
+///
+/// \details Dense output only depends on the time-stepper history, so the
+/// result for a given step and time can be reused.
+/// `evolution::Actions::RunEventsAndDenseTriggers` stores the result here if
+/// it has to wait for data before it can run the events, so that the dense
+/// output is not recomputed when the action is retried.  The stored value is
+/// only valid for the `time_step_id`, `time_step`, and `time` it was computed
+/// for.  The action empties the cache when it is retried, so the copy of the
+/// variables is not held once it has been used.
+///
+/// \tparam VariablesTag tag for the evolved variables
+template <typename VariablesTag>
+struct DenseOutputCache : db::SimpleTag {
+  struct Entry {
+    TimeStepId time_step_id{};
+    TimeDelta time_step{};
+    double time = std::numeric_limits<double>::signaling_NaN();
+    typename VariablesTag::type value{};
+
+    // NOLINTNEXTLINE(google-runtime-references)
+    void pup(PUP::er& p) {
+      p | time_step_id;
+      p | time_step;
+      p | time;
+      p | value;
+    }
+  };
+
+  using type = std::optional<Entry>;
+};
+}  // namespace Tags
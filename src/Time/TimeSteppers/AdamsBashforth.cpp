@@ -4,13 +4,17 @@
 #include "Time/TimeSteppers/AdamsBashforth.hpp"
 
 #include <algorithm>
+#include <array>
 #include <boost/container/small_vector.hpp>
 #include <boost/iterator/transform_iterator.hpp>
+#include <complex>
 #include <cstddef>
 #include <iterator>
 #include <limits>
 #include <pup.h>
+#include <type_traits>
 #include <utility>
+#include <vector>
 
 #include "NumericalAlgorithms/Interpolation/LagrangePolynomial.hpp"
 #include "Time/ApproximateTime.hpp"
@@ -280,7 +284,6 @@ void AdamsBashforth::boundary_dense_output_impl(
 }
 
 namespace {
-template <typename T>
 class SmallStepIterator {
  public:
   using iterator_category = std::forward_iterator_tag;
@@ -291,7 +294,7 @@ class SmallStepIterator {
 
   enum class Side { Local, Remote, Both };
 
-  using history_iterator = typename ConstBoundaryHistoryTimes::const_iterator;
+  using history_iterator = ConstBoundaryHistoryTimes::const_iterator;
 
   SmallStepIterator() = default;
 
@@ -360,8 +363,7 @@ class SmallStepIterator {
   history_iterator remote_end_{};
 };
 
-template <typename T>
-bool operator==(const SmallStepIterator<T>& a, const SmallStepIterator<T>& b) {
+bool operator==(const SmallStepIterator& a, const SmallStepIterator& b) {
   if (a.done() and b.done()) {
     return true;
   }
@@ -371,19 +373,16 @@ bool operator==(const SmallStepIterator<T>& a, const SmallStepIterator<T>& b) {
   return *a == *b;
 }
 
-template <typename T>
-bool operator!=(const SmallStepIterator<T>& a, const SmallStepIterator<T>& b) {
+bool operator!=(const SmallStepIterator& a, const SmallStepIterator& b) {
   return not(a == b);
 }
 
-template <typename T>
-bool operator<(const SmallStepIterator<T>& a, const SmallStepIterator<T>& b) {
+bool operator<(const SmallStepIterator& a, const SmallStepIterator& b) {
   return a.local_iterator() < b.local_iterator() or
          a.remote_iterator() < b.remote_iterator();
 }
 
-template <typename T>
-bool operator>(const SmallStepIterator<T>& a, const SmallStepIterator<T>& b) {
+bool operator>(const SmallStepIterator& a, const SmallStepIterator& b) {
   return b < a;
 }
 
@@ -414,22 +413,48 @@ It bounded_next(const It& it, const It& bound, const size_t n) {
       typename std::iterator_traits<It>::iterator_category{}, it, bound,
       static_cast<typename std::iterator_traits<It>::difference_type>(n));
 }
-}  // namespace
 
-template <typename T, typename TimeType>
-void AdamsBashforth::boundary_impl(
-    const gsl::not_null<T*> result,
-    const ConstBoundaryHistoryTimes& local_times,
-    const ConstBoundaryHistoryTimes& remote_times,
-    const BoundaryHistoryEvaluator<T>& coupling,
-    const TimeType& end_time) const {
-  // Might be different from order_ during self-start.
+// A contribution `coefficient * coupling(local_times[local],
+// remote_times[remote])` to a boundary step.
+struct BoundaryTerm {
+  size_t local;
+  size_t remote;
+  double coefficient;
+};
+
+// Large enough for all common cases.
+using BoundaryTerms = boost::container::small_vector<BoundaryTerm, 32>;
+
+template <typename TimeType>
+void compute_boundary_terms(const gsl::not_null<BoundaryTerms*> terms,
+                            const size_t order,
+                            const ConstBoundaryHistoryTimes& local_times,
+                            const ConstBoundaryHistoryTimes& remote_times,
+                            const TimeType& end_time) {
+  terms->clear();
+  const auto add_term = [&local_times, &remote_times, &terms](
+                            const auto& local_it, const auto& remote_it,
+                            const double coefficient) {
+    const auto local = static_cast<size_t>(local_it - local_times.begin());
+    const auto remote = static_cast<size_t>(remote_it - remote_times.begin());
+    const auto existing_term =
+        alg::find_if(*terms, [&local, &remote](const BoundaryTerm& term) {
+          return term.local == local and term.remote == remote;
+        });
+    if (existing_term != terms->end()) {
+      existing_term->coefficient += coefficient;
+    } else {
+      terms->push_back({local, remote, coefficient});
+    }
+  };
+
+  // Might be different from order during self-start.
   const auto current_order =
       local_times.integration_order(local_times.size() - 1);
 
-  ASSERT(current_order <= order_,
+  ASSERT(current_order <= order,
          "Local history is too long for target order (" << current_order
-         << " should not exceed " << order_ << ")");
+         << " should not exceed " << order << ")");
   ASSERT(remote_times.size() >= current_order,
          "Remote history is too short (" << remote_times.size()
          << " should be at least " << current_order << ")");
@@ -466,12 +491,12 @@ void AdamsBashforth::boundary_impl(
     for (auto coefficients_it = coefficients.begin();
          coefficients_it != coefficients.end();
          ++coefficients_it, ++local_it, ++remote_it) {
-      *result += *coefficients_it * *coupling(*local_it, *remote_it);
+      add_term(local_it, remote_it, *coefficients_it);
     }
     return;
   }
 
-  ASSERT(current_order == order_,
+  ASSERT(current_order == order,
          "Cannot perform local time-stepping while self-starting.");
 
   const evolution_less<> less{time_step.is_positive()};
@@ -493,9 +518,9 @@ void AdamsBashforth::boundary_impl(
 
   using difference_type = std::ptrdiff_t;
 
-  SmallStepIterator<T> contributing_small_step(
+  SmallStepIterator contributing_small_step(
       local_begin, remote_begin, local_times.end(), remote_times.end());
-  SmallStepIterator<T> small_step_of_current_step = std::next(
+  SmallStepIterator small_step_of_current_step = std::next(
       contributing_small_step, static_cast<difference_type>(current_order - 1));
   while (*small_step_of_current_step != start_time) {
     ++contributing_small_step;
@@ -510,9 +535,9 @@ void AdamsBashforth::boundary_impl(
   {
     auto coefficient_eval_begin = contributing_small_step;
     auto coefficient_eval_end = small_step_of_current_step;
-    while (coefficient_eval_end != SmallStepIterator<T>{}) {
+    while (coefficient_eval_end != SmallStepIterator{}) {
       auto next_end = std::next(coefficient_eval_end);
-      const double next_time = next_end == SmallStepIterator<T>{}
+      const double next_time = next_end == SmallStepIterator{}
                                    ? end_time.value()
                                    : next_end->value();
       small_step_coefficients.push_back(adams_coefficients::coefficients(
@@ -526,9 +551,9 @@ void AdamsBashforth::boundary_impl(
   // Sum over the small steps that contribute to this step, doing the
   // appropriate interpolation for each.
   for (size_t contributing_step_index = 0;
-       contributing_small_step != SmallStepIterator<T>{};
+       contributing_small_step != SmallStepIterator{};
        ++contributing_small_step, ++contributing_step_index) {
-    if (contributing_small_step.side() != SmallStepIterator<T>::Side::Local) {
+    if (contributing_small_step.side() != SmallStepIterator::Side::Local) {
       double overall_prefactor = 0.0;
       auto small_step_within_current_step = static_cast<size_t>(
           std::max(static_cast<difference_type>(contributing_step_index + 1 -
@@ -544,10 +569,9 @@ void AdamsBashforth::boundary_impl(
                                    [contributing_step_index -
                                     small_step_within_current_step];
       }
-      if (contributing_small_step.side() == SmallStepIterator<T>::Side::Both) {
-        *result += overall_prefactor *
-                   *coupling(*contributing_small_step.local_iterator(),
-                             *contributing_small_step.remote_iterator());
+      if (contributing_small_step.side() == SmallStepIterator::Side::Both) {
+        add_term(contributing_small_step.local_iterator(),
+                 contributing_small_step.remote_iterator(), overall_prefactor);
       } else {
         // Side::Remote
         OrderVector<double> past_steps(current_order);
@@ -566,9 +590,8 @@ void AdamsBashforth::boundary_impl(
               lagrange_polynomial(interpolation_index,
                                   contributing_small_step->value(),
                                   past_steps.begin(), past_steps.end());
-          *result += coefficient *
-                     *coupling(*interpolation_time,
-                               *contributing_small_step.remote_iterator());
+          add_term(interpolation_time,
+                   contributing_small_step.remote_iterator(), coefficient);
         }
       }
     } else {
@@ -578,7 +601,7 @@ void AdamsBashforth::boundary_impl(
                    contributing_small_step.remote_iterator()) -
           static_cast<difference_type>(current_order - 1);
       const auto interpolation_time_end =
-          bounded_next(contributing_small_step, SmallStepIterator<T>{},
+          bounded_next(contributing_small_step, SmallStepIterator{},
                        current_order)
               .remote_iterator();
       for (; interpolation_time != interpolation_time_end;
@@ -596,7 +619,7 @@ void AdamsBashforth::boundary_impl(
             bounded_next(interpolation_time, remote_times.end(), current_order);
         for (size_t i = 0;
              i < current_order and
-             small_step_within_current_step_end != SmallStepIterator<T>{} and
+             small_step_within_current_step_end != SmallStepIterator{} and
              small_step_within_current_step_end.remote_iterator() <
                  bound_from_interpolation_time;
              ++i) {
@@ -629,13 +652,123 @@ void AdamsBashforth::boundary_impl(
                                      [contributing_step_index -
                                       small_step_within_current_step_index];
         }
-        *result +=
-            coefficient * *coupling(*contributing_small_step.local_iterator(),
-                                    *interpolation_time);
+        add_term(contributing_small_step.local_iterator(), interpolation_time,
+                 coefficient);
+      }
+    }
+  }
+}
+
+// The terms only depend on the times in the histories, which are
+// usually the same for all the mortars of an element (and for many
+// elements on the same core), so the most recently computed terms are
+// remembered and the coefficients are only computed once for all of
+// them.
+struct BoundaryTermsCacheEntry {
+  bool exact_end_time{false};
+  double end_time{std::numeric_limits<double>::signaling_NaN()};
+  size_t order{0};
+  std::vector<TimeStepId> local_ids{};
+  std::vector<TimeStepId> remote_ids{};
+  BoundaryTerms terms{};
+};
+
+template <typename TimeType>
+const BoundaryTerms& cached_boundary_terms(
+    const size_t order, const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times, const TimeType& end_time) {
+  static constexpr size_t cache_size = 4;
+  thread_local std::array<BoundaryTermsCacheEntry, cache_size> cache{};
+  thread_local size_t next_entry = 0;
+
+  constexpr bool exact_end_time = std::is_same_v<TimeType, Time>;
+  const auto current_order =
+      local_times.integration_order(local_times.size() - 1);
+  for (const auto& entry : cache) {
+    if (entry.exact_end_time == exact_end_time and
+        entry.end_time == end_time.value() and
+        entry.order == current_order and
+        entry.local_ids.size() == local_times.size() and
+        entry.remote_ids.size() == remote_times.size() and
+        std::equal(local_times.begin(), local_times.end(),
+                   entry.local_ids.begin()) and
+        std::equal(remote_times.begin(), remote_times.end(),
+                   entry.remote_ids.begin())) {
+      return entry.terms;
+    }
+  }
+
+  auto& entry = gsl::at(cache, next_entry);
+  next_entry = (next_entry + 1) % cache_size;
+  entry.exact_end_time = exact_end_time;
+  entry.end_time = end_time.value();
+  entry.order = current_order;
+  entry.local_ids.assign(local_times.begin(), local_times.end());
+  entry.remote_ids.assign(remote_times.begin(), remote_times.end());
+  compute_boundary_terms(make_not_null(&entry.terms), order, local_times,
+                         remote_times, end_time);
+  return entry.terms;
+}
+
+template <typename T>
+void add_boundary_terms(const gsl::not_null<T*> result,
+                        const BoundaryTerms& terms,
+                        const ConstBoundaryHistoryTimes& local_times,
+                        const ConstBoundaryHistoryTimes& remote_times,
+                        const BoundaryHistoryEvaluator<T>& coupling) {
+  if constexpr (std::is_same_v<T, double> or
+                std::is_same_v<T, std::complex<double>>) {
+    for (const auto& term : terms) {
+      *result += term.coefficient *
+                 *coupling(local_times[term.local], remote_times[term.remote]);
+    }
+  } else {
+    // Evaluate all the couplings first and then sum them block by
+    // block, so that each block of the result stays in cache while
+    // all the terms are added to it instead of the whole result being
+    // streamed through memory once per term.
+    static constexpr size_t block_size = 256;
+    using value_type = typename T::value_type;
+    boost::container::small_vector<const value_type*, 32> coupling_data{};
+    for (const auto& term : terms) {
+      const T& term_coupling =
+          *coupling(local_times[term.local], remote_times[term.remote]);
+      ASSERT(term_coupling.size() == result->size(),
+             "Coupling has size " << term_coupling.size()
+             << " but the result has size " << result->size());
+      coupling_data.push_back(term_coupling.data());
+    }
+    const size_t size = result->size();
+    value_type* const result_data = result->data();
+    for (size_t block_start = 0; block_start < size;
+         block_start += block_size) {
+      const size_t block_end = std::min(size, block_start + block_size);
+      for (size_t term = 0; term < terms.size(); ++term) {
+        const double coefficient = terms[term].coefficient;
+        const value_type* const term_data = coupling_data[term];
+        for (size_t i = block_start; i < block_end; ++i) {
+          // NOLINTNEXTLINE(cppcoreguidelines-pro-bounds-pointer-arithmetic)
+          result_data[i] += coefficient * term_data[i];
+        }
       }
     }
   }
 }
+}  // namespace
+
+template <typename T, typename TimeType>
+void AdamsBashforth::boundary_impl(
+    const gsl::not_null<T*> result,
+    const ConstBoundaryHistoryTimes& local_times,
+    const ConstBoundaryHistoryTimes& remote_times,
+    const BoundaryHistoryEvaluator<T>& coupling,
+    const TimeType& end_time) const {
+  // Copied so that the cache can be safely reused while the couplings
+  // are evaluated.
+  const BoundaryTerms terms =
+      cached_boundary_terms(order_, local_times, remote_times, end_time);
+  add_boundary_terms(result, terms, local_times, remote_times, coupling);
+}
 
 bool operator==(const AdamsBashforth& lhs, const AdamsBashforth& rhs) {
   return lhs.order_ == rhs.order_;
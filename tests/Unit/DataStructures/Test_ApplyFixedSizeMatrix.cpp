@@ -0,0 +1,76 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <random>
+
+#include "DataStructures/ApplyFixedSizeMatrix.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Matrix.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+void check(const gsl::not_null<std::mt19937*> gen, const size_t rows,
+           const size_t columns, const size_t stride,
+           const size_t number_of_slices) {
+  CAPTURE(rows);
+  CAPTURE(columns);
+  CAPTURE(stride);
+  CAPTURE(number_of_slices);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  Matrix matrix(rows, columns);
+  for (size_t r = 0; r < rows; ++r) {
+    for (size_t c = 0; c < columns; ++c) {
+      matrix(r, c) = dist(*gen);
+    }
+  }
+  const auto data = make_with_random_values<DataVector>(
+      gen, make_not_null(&dist),
+      DataVector(stride * columns * number_of_slices));
+
+  DataVector expected(stride * rows * number_of_slices, 0.0);
+  for (size_t s = 0; s < number_of_slices; ++s) {
+    for (size_t r = 0; r < rows; ++r) {
+      for (size_t c = 0; c < columns; ++c) {
+        for (size_t i = 0; i < stride; ++i) {
+          expected[i + stride * (r + rows * s)] +=
+              matrix(r, c) * data[i + stride * (c + columns * s)];
+        }
+      }
+    }
+  }
+
+  DataVector result(expected.size(), 0.0);
+  const bool is_supported = rows >= apply_fixed_size_matrix_min_size and
+                            rows <= apply_fixed_size_matrix_max_size and
+                            columns >= apply_fixed_size_matrix_min_size and
+                            columns <= apply_fixed_size_matrix_max_size;
+  CHECK(apply_fixed_size_matrix(make_not_null(result.data()), matrix,
+                                data.data(), stride,
+                                number_of_slices) == is_supported);
+  if (is_supported) {
+    CHECK_ITERABLE_APPROX(result, expected);
+  } else {
+    // Unsupported sizes must leave the result untouched
+    CHECK(result == DataVector(expected.size(), 0.0));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ApplyFixedSizeMatrix",
+                  "[DataStructures][Unit]") {
+  MAKE_GENERATOR(gen);
+  for (size_t rows = 1; rows <= apply_fixed_size_matrix_max_size + 1; ++rows) {
+    for (size_t columns = 1; columns <= apply_fixed_size_matrix_max_size + 1;
+         ++columns) {
+      // Multiplying along the first, a middle, and the last dimension
+      check(make_not_null(&gen), rows, columns, 1, 5);
+      check(make_not_null(&gen), rows, columns, 3, 2);
+      check(make_not_null(&gen), rows, columns, 12, 1);
+    }
+  }
+}
@@ -198,6 +198,87 @@ void test_interpolation() {
     }
   }
 }
+// Applies the matrices one dimension at a time by explicit summation
+template <typename VectorType, size_t Dim>
+VectorType naive_apply_matrices(const std::array<Matrix, Dim>& matrices,
+                                VectorType data, Index<Dim> extents) {
+  const size_t number_of_independent_components =
+      data.size() / extents.product();
+  for (size_t d = 0; d < Dim; ++d) {
+    const Matrix& matrix = gsl::at(matrices, d);
+    if (matrix == Matrix{}) {
+      continue;
+    }
+    size_t stride = 1;
+    for (size_t i = 0; i < d; ++i) {
+      stride *= extents[i];
+    }
+    const size_t number_of_slices = number_of_independent_components *
+                                    extents.product() /
+                                    (stride * matrix.columns());
+    VectorType result(number_of_slices * stride * matrix.rows(), 0.0);
+    for (size_t s = 0; s < number_of_slices; ++s) {
+      for (size_t r = 0; r < matrix.rows(); ++r) {
+        for (size_t c = 0; c < matrix.columns(); ++c) {
+          for (size_t i = 0; i < stride; ++i) {
+            result[i + stride * (r + matrix.rows() * s)] +=
+                matrix(r, c) * data[i + stride * (c + matrix.columns() * s)];
+          }
+        }
+      }
+    }
+    data = std::move(result);
+    extents[d] = matrix.rows();
+  }
+  return data;
+}
+
+// Checks matrix sizes on both sides of the range handled by the fixed-size
+// kernels, as well as skipped empty matrices and explicit identity matrices.
+template <typename VectorType>
+void test_matrix_sizes() {
+  MAKE_GENERATOR(gen);
+  UniformCustomDistribution<double> dist{-1.0, 1.0};
+  const auto random_matrix = [&gen, &dist](const size_t rows,
+                                           const size_t columns) {
+    Matrix matrix(rows, columns);
+    for (size_t i = 0; i < rows; ++i) {
+      for (size_t j = 0; j < columns; ++j) {
+        matrix(i, j) = dist(gen);
+      }
+    }
+    return matrix;
+  };
+  const auto check = [&gen, &dist](const auto& matrices, const auto& extents) {
+    CAPTURE(extents);
+    const auto data = make_with_random_values<VectorType>(
+        make_not_null(&gen), make_not_null(&dist),
+        VectorType(2 * extents.product()));
+    CHECK_ITERABLE_APPROX(apply_matrices(matrices, data, extents),
+                          naive_apply_matrices(matrices, data, extents));
+  };
+  Matrix identity(4, 4, 0.0);
+  for (size_t i = 0; i < 4; ++i) {
+    identity(i, i) = 1.0;
+  }
+  for (size_t rows = 1; rows <= 13; ++rows) {
+    for (size_t columns = 1; columns <= 13; ++columns) {
+      CAPTURE(rows);
+      CAPTURE(columns);
+      check(std::array<Matrix, 1>{{random_matrix(rows, columns)}},
+            Index<1>{columns});
+      check(std::array<Matrix, 2>{{Matrix{}, random_matrix(rows, columns)}},
+            Index<2>{3, columns});
+      check(std::array<Matrix, 3>{{random_matrix(rows, columns), identity,
+                                   random_matrix(columns, rows)}},
+            Index<3>{columns, 4, rows});
+      check(std::array<Matrix, 3>{{random_matrix(3, 2), random_matrix(2, 5),
+                                   random_matrix(rows, columns)}},
+            Index<3>{2, 5, columns});
+    }
+  }
+  check(std::array<Matrix, 2>{{identity, Matrix{}}}, Index<2>{4, 5});
+}
 }  // namespace
 
 // [[TimeOut, 8]]
@@ -215,6 +296,11 @@ SPECTRE_TEST_CASE("Unit.DataStructures.ApplyMatrices",
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 2>();
     test_interpolation<ComplexScalarTag, ComplexTensorTag, 3>();
   }
+  {
+    INFO("Matrix sizes");
+    test_matrix_sizes<DataVector>();
+    test_matrix_sizes<ComplexDataVector>();
+  }
   // Can't use test_interpolation for 0 because Tensor errors on
   // Dim=0.
   const Index<0> extents{};
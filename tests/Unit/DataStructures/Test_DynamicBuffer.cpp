@@ -11,6 +11,7 @@
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/DynamicBuffer.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Utilities/Gsl.hpp"
@@ -123,11 +124,44 @@ void test_dynamic_buffer() {
   check_results(dynamic_buffer_moved, expected);
 }
 
+void test_scratch_dynamic_buffer() {
+  ScratchArena arena{};
+  DynamicBuffer<DataVector> copied{};
+  {
+    ScratchArena::Scope scratch{arena};
+    DynamicBuffer<DataVector> dynamic_buffer(3, 4, make_not_null(&scratch));
+    CHECK(dynamic_buffer.size() == 3);
+    CHECK(arena.bytes_in_use() >= 12 * sizeof(double));
+    for (size_t i = 0; i < 3; ++i) {
+      CHECK(dynamic_buffer[i].size() == 4);
+      CHECK(not dynamic_buffer[i].is_owning());
+      dynamic_buffer[i] = static_cast<double>(i);
+    }
+    // The vectors are stored contiguously in the arena
+    CHECK(dynamic_buffer[1].data() == dynamic_buffer[0].data() + 4);
+    copied = dynamic_buffer;
+    const DynamicBuffer<DataVector> copy_constructed(dynamic_buffer);
+    check_results(copy_constructed,
+                  {DataVector(4, 0.0), DataVector(4, 1.0), DataVector(4, 2.0)});
+  }
+  CHECK(arena.bytes_in_use() == 0);
+  // The copy owns its memory, so it is still valid and can be serialized
+  copied = serialize_and_deserialize(copied);
+  check_results(copied,
+                {DataVector(4, 0.0), DataVector(4, 1.0), DataVector(4, 2.0)});
+
+  ScratchArena::Scope scratch{arena};
+  DynamicBuffer<double> fundamental_buffer(2, 1, make_not_null(&scratch));
+  CHECK(fundamental_buffer.size() == 2);
+  CHECK(arena.bytes_in_use() == 0);
+}
 }  // namespace
+
 SPECTRE_TEST_CASE("Unit.DataStructures.DynamicBuffer",
                   "[DataStructures][Unit]") {
   for (size_t i = 0; i < 20; ++i) {
     test_dynamic_buffer<DataVector>();
     test_dynamic_buffer<double>();
   }
+  test_scratch_dynamic_buffer();
 }
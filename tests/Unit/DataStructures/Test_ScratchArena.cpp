@@ -0,0 +1,138 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <complex>
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+
+#include "DataStructures/ScratchArena.hpp"
+
+namespace {
+template <typename T>
+bool is_aligned(const T* const pointer) {
+  return reinterpret_cast<std::uintptr_t>(pointer) % ScratchArena::alignment ==
+         0;
+}
+
+void test_allocate() {
+  ScratchArena arena{};
+  CHECK(arena.bytes_in_use() == 0);
+  CHECK(arena.capacity() == 0);
+  CHECK(arena.number_of_heap_allocations() == 0);
+  {
+    ScratchArena::Scope scratch{arena};
+    CHECK(&scratch.arena() == &arena);
+    CHECK(scratch.allocate<double>(0) == nullptr);
+    CHECK(arena.capacity() == 0);
+
+    double* const a = scratch.allocate<double>(5);
+    CHECK(is_aligned(a));
+    CHECK(arena.capacity() == ScratchArena::minimum_block_size);
+    CHECK(arena.number_of_heap_allocations() == 1);
+    std::complex<double>* const b = scratch.allocate<std::complex<double>>(3);
+    CHECK(is_aligned(b));
+    // The second allocation starts at the next aligned offset
+    CHECK(static_cast<size_t>(reinterpret_cast<std::byte*>(b) -
+                              reinterpret_cast<std::byte*>(a)) ==
+          ScratchArena::alignment);
+    CHECK(arena.bytes_in_use() ==
+          ScratchArena::alignment + 3 * sizeof(std::complex<double>));
+    for (size_t i = 0; i < 5; ++i) {
+      a[i] = static_cast<double>(i);
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      b[i] = std::complex<double>(1.0, static_cast<double>(i));
+    }
+    for (size_t i = 0; i < 5; ++i) {
+      CHECK(a[i] == static_cast<double>(i));
+    }
+#ifdef SPECTRE_DEBUG
+    CHECK(std::isnan(scratch.allocate<double>(1)[0]));
+#endif  // SPECTRE_DEBUG
+  }
+  CHECK(arena.bytes_in_use() == 0);
+  CHECK(arena.peak_bytes_in_use() > 0);
+  CHECK(arena.capacity() == ScratchArena::minimum_block_size);
+}
+
+void test_nested_scopes() {
+  ScratchArena arena{};
+  ScratchArena::Scope outer{arena};
+  double* const a = outer.allocate<double>(10);
+  const size_t bytes_after_outer = arena.bytes_in_use();
+  double* inner_pointer = nullptr;
+  {
+    ScratchArena::Scope inner{arena};
+    inner_pointer = inner.allocate<double>(10);
+    CHECK(inner_pointer != a);
+    CHECK(arena.bytes_in_use() > bytes_after_outer);
+  }
+  CHECK(arena.bytes_in_use() == bytes_after_outer);
+  {
+    // The memory released by the inner scope is reused
+    ScratchArena::Scope inner{arena};
+    CHECK(inner.allocate<double>(10) == inner_pointer);
+  }
+  CHECK(arena.number_of_heap_allocations() == 1);
+}
+
+void test_growth() {
+  ScratchArena arena{};
+  const size_t number_of_doubles =
+      ScratchArena::minimum_block_size / sizeof(double);
+  {
+    ScratchArena::Scope scratch{arena};
+    scratch.allocate<double>(number_of_doubles / 2);
+    // Doesn't fit into the first block anymore
+    double* const large = scratch.allocate<double>(number_of_doubles);
+    CHECK(is_aligned(large));
+    large[number_of_doubles - 1] = 1.0;
+    CHECK(arena.number_of_heap_allocations() == 2);
+    CHECK(arena.capacity() >= 2 * ScratchArena::minimum_block_size);
+  }
+  CHECK(arena.bytes_in_use() == 0);
+  const size_t capacity = arena.capacity();
+  // The blocks were merged when all memory was released, so the same
+  // allocations now fit into a single block.
+  CHECK(arena.number_of_heap_allocations() == 3);
+  arena.reset_statistics();
+  CHECK(arena.number_of_heap_allocations() == 0);
+  CHECK(arena.peak_bytes_in_use() == 0);
+  {
+    ScratchArena::Scope scratch{arena};
+    scratch.allocate<double>(number_of_doubles / 2);
+    scratch.allocate<double>(number_of_doubles);
+  }
+  CHECK(arena.number_of_heap_allocations() == 0);
+  CHECK(arena.capacity() == capacity);
+  CHECK(arena.peak_bytes_in_use() > ScratchArena::minimum_block_size);
+
+  ScratchArena moved_arena = std::move(arena);
+  CHECK(moved_arena.capacity() == capacity);
+}
+
+void test_thread_local_arena() {
+  ScratchArena& arena = ScratchArena::thread_local_arena();
+  CHECK(&arena == &ScratchArena::thread_local_arena());
+  const size_t bytes_in_use = arena.bytes_in_use();
+  {
+    ScratchArena::Scope scratch{};
+    CHECK(&scratch.arena() == &arena);
+    scratch.allocate<double>(100);
+    CHECK(arena.bytes_in_use() > bytes_in_use);
+  }
+  CHECK(arena.bytes_in_use() == bytes_in_use);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.DataStructures.ScratchArena",
+                  "[DataStructures][Unit]") {
+  test_allocate();
+  test_nested_scopes();
+  test_growth();
+  test_thread_local_arena();
+}
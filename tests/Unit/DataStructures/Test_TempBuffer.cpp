@@ -4,12 +4,15 @@
 #include "Framework/TestingFramework.hpp"
 
 #include "DataStructures/DataVector.hpp"
+#include "DataStructures/ScratchArena.hpp"
 #include "DataStructures/Tags/TempTensor.hpp"
 #include "DataStructures/TempBuffer.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
 #include "DataStructures/Tensor/Tensor.hpp"
+#include "DataStructures/Variables.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/ContainerHelpers.hpp"
+#include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
 #include "Utilities/TaggedTuple.hpp"
@@ -38,9 +41,40 @@ void test_temp_buffer(const DataType& x) {
   auto& scalar2 = get<::Tags::TempScalar<1, DataType>>(buffer);
   CHECK_ITERABLE_APPROX(scalar2, expected_scalar);
 }
+void test_scratch_buffer() {
+  using tags = tmpl::list<::Tags::TempI<0, 3, Frame::Inertial, DataVector>,
+                          ::Tags::TempScalar<1, DataVector>>;
+  ScratchArena arena{};
+  {
+    ScratchArena::Scope scratch{arena};
+    auto buffer =
+        make_scratch_buffer<TempBuffer<tags>>(make_not_null(&scratch), 5);
+    CHECK(buffer.number_of_grid_points() == 5);
+    CHECK(arena.bytes_in_use() >= 20 * sizeof(double));
+    auto& scalar = get<::Tags::TempScalar<1, DataVector>>(buffer);
+    get(scalar) = 2.0;
+    CHECK(get(get<::Tags::TempScalar<1, DataVector>>(buffer)) ==
+          DataVector(5, 2.0));
+
+    auto vars =
+        make_scratch_buffer<Variables<tags>>(make_not_null(&scratch), 3);
+    CHECK(vars.number_of_grid_points() == 3);
+    CHECK(vars.data() != buffer.data());
+  }
+  CHECK(arena.bytes_in_use() == 0);
+  {
+    ScratchArena::Scope scratch{arena};
+    const auto buffer = make_scratch_buffer<
+        TempBuffer<tmpl::list<::Tags::TempScalar<0, double>>>>(
+        make_not_null(&scratch), 1);
+    CHECK(buffer.number_of_grid_points() == 1);
+    CHECK(arena.bytes_in_use() == 0);
+  }
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.DataStructures.TempBuffer", "[DataStructures][Unit]") {
   test_temp_buffer(2.0);
   test_temp_buffer(DataVector(5, 2.0));
+  test_scratch_buffer();
 }
@@ -6,6 +6,7 @@
 #include <cstddef>
 #include <memory>
 #include <random>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Tensor/EagerMath/Magnitude.hpp"
@@ -185,12 +186,66 @@ void test_3d() {
   CHECK_ITERABLE_APPROX((get<2, 0>(identity)), DataVector(5, 0.));
   CHECK_ITERABLE_APPROX((get<2, 1>(identity)), DataVector(5, 0.));
 }
+
+void test_batched_inverse() {
+  INFO("Batched inverse");
+
+  MAKE_GENERATOR(generator);
+  std::uniform_real_distribution<double> dist{-4., 4.};
+
+  const ElementId<3> element_id{0, {{{1, 0}, {1, 0}, {2, 0}}}};
+  const Composition map{
+      element_to_block_logical_map(element_id),
+      std::make_unique<
+          CoordinateMap<Frame::BlockLogical, Frame::Inertial, Wedge<3>>>(
+          Wedge<3>{1., 3., 1., 1., {}, true})};
+
+  const size_t num_points = 20;
+  auto x = make_with_random_values<tnsr::I<DataVector, 3, Frame::Inertial>>(
+      make_not_null(&generator), make_not_null(&dist), DataVector(num_points));
+  // The wedge can't invert points with negative z, so the element map is only
+  // inverted at the other points. Make sure there are points of both kinds.
+  get<0>(x)[0] = 0.1;
+  get<1>(x)[0] = 0.2;
+  get<2>(x)[0] = 2.;
+  get<2>(x)[1] = -2.;
+
+  const auto check_batched_inverse = [&map](const auto& target) {
+    const size_t local_num_points = get<0>(target).size();
+    tnsr::I<DataVector, 3, Frame::ElementLogical> xi{};
+    std::vector<bool> is_valid{};
+    map.inverse(make_not_null(&xi), make_not_null(&is_valid), target);
+    REQUIRE(is_valid.size() == local_num_points);
+    size_t num_valid = 0;
+    for (size_t s = 0; s < local_num_points; ++s) {
+      const auto expected = map.inverse(tnsr::I<double, 3, Frame::Inertial>{
+          {{get<0>(target)[s], get<1>(target)[s], get<2>(target)[s]}}});
+      CHECK(is_valid[s] == expected.has_value());
+      if (expected.has_value()) {
+        ++num_valid;
+        for (size_t d = 0; d < 3; ++d) {
+          CHECK(xi.get(d)[s] == approx(expected->get(d)));
+        }
+      }
+    }
+    return num_valid;
+  };
+
+  const size_t num_valid = check_batched_inverse(x);
+  CHECK(num_valid > 0);
+  CHECK(num_valid < num_points);
+
+  // No point is valid after the first map is inverted
+  get<2>(x) = -abs(get<2>(x)) - 1.;
+  CHECK(check_batched_inverse(x) == 0);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMaps.Composition", "[Domain][Unit]") {
   test_composition();
   test_identity();
   test_3d();
+  test_batched_inverse();
 }
 
 }  // namespace domain::CoordinateMaps
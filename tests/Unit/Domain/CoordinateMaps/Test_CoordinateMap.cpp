@@ -21,6 +21,7 @@
 #include "Domain/CoordinateMaps/CoordinateMap.hpp"
 #include "Domain/CoordinateMaps/CoordinateMap.tpp"
 #include "Domain/CoordinateMaps/DiscreteRotation.hpp"
+#include "Domain/CoordinateMaps/Equiangular.hpp"
 #include "Domain/CoordinateMaps/EquatorialCompression.hpp"
 #include "Domain/CoordinateMaps/Frustum.hpp"
 #include "Domain/CoordinateMaps/Identity.hpp"
@@ -1490,6 +1491,90 @@ void test_coords_frame_velocity_jacobians() {
               functions_of_time)) == expected_velocity);
   }
 }
+
+template <typename Map>
+void check_batched_inverse(
+    const Map& map,
+    const tnsr::I<DataVector, Map::dim, typename Map::target_frame>&
+        target_points,
+    const double time,
+    const std::unordered_map<
+        std::string, std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>&
+        functions_of_time) {
+  constexpr size_t dim = Map::dim;
+  tnsr::I<DataVector, dim, typename Map::source_frame> source_points{};
+  std::vector<bool> is_valid{};
+  map.inverse(make_not_null(&source_points), make_not_null(&is_valid),
+              target_points, time, functions_of_time);
+  const size_t num_points = get<0>(target_points).size();
+  REQUIRE(is_valid.size() == num_points);
+  size_t num_valid = 0;
+  for (size_t s = 0; s < num_points; ++s) {
+    tnsr::I<double, dim, typename Map::target_frame> target_point{};
+    for (size_t d = 0; d < dim; ++d) {
+      target_point.get(d) = target_points.get(d)[s];
+    }
+    const auto expected = map.inverse(target_point, time, functions_of_time);
+    CHECK(is_valid[s] == expected.has_value());
+    if (expected.has_value()) {
+      ++num_valid;
+      for (size_t d = 0; d < dim; ++d) {
+        CHECK(source_points.get(d)[s] == approx(expected->get(d)));
+      }
+    }
+  }
+  // Make sure both valid and invalid points were tested
+  CHECK(num_valid > 0);
+  CHECK(num_valid < num_points);
+}
+
+void test_batched_inverse() {
+  INFO("Batched inverse");
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-4.0, 4.0);
+  const size_t num_points = 50;
+  const auto target_points =
+      make_with_random_values<tnsr::I<DataVector, 3, Frame::Inertial>>(
+          make_not_null(&gen), make_not_null(&dist), DataVector(num_points));
+
+  const std::array<DataVector, 4> init_func{
+      {{0.1, -0.2, 0.3}, {0.5, 0.0, -1.0}, {0.0, 0.0, 0.0}, {0.0, 0.0, 0.0}}};
+  std::unordered_map<std::string,
+                     std::unique_ptr<domain::FunctionsOfTime::FunctionOfTime>>
+      functions_of_time{};
+  functions_of_time["Translation"] =
+      std::make_unique<domain::FunctionsOfTime::PiecewisePolynomial<3>>(
+          0.0, init_func, 10.0);
+
+  using Affine = CoordinateMaps::Affine;
+  using Equiangular = CoordinateMaps::Equiangular;
+  using Equiangular3D =
+      CoordinateMaps::ProductOf3Maps<Equiangular, Equiangular, Equiangular>;
+  // The product of Equiangular maps is invertible everywhere, so follow it by
+  // a Wedge that rejects all points with negative z
+  const auto time_independent_map =
+      make_coordinate_map<Frame::BlockLogical, Frame::Inertial>(
+          Equiangular3D{Equiangular{-1.0, 1.0, -2.0, 2.0},
+                        Equiangular{-1.0, 1.0, -2.0, 2.0},
+                        Equiangular{-1.0, 1.0, -2.0, 2.0}},
+          CoordinateMaps::Wedge<3>{1.0, 6.0, 0.0, 1.0, OrientationMap<3>{},
+                                   true});
+  check_batched_inverse(time_independent_map, target_points, 2.0,
+                        functions_of_time);
+
+  using Affine2D = CoordinateMaps::ProductOf2Maps<Affine, Affine>;
+  const auto time_dependent_map =
+      make_coordinate_map<Frame::BlockLogical, Frame::Inertial>(
+          CoordinateMaps::ProductOf2Maps<Affine2D, Affine>{
+              Affine2D{Affine{-1.0, 1.0, -2.0, 2.0},
+                       Affine{-1.0, 1.0, -3.0, 1.0}},
+              Affine{-1.0, 1.0, 1.0, 2.0}},
+          CoordinateMaps::Wedge<3>{2.0, 5.0, 1.0, 1.0, OrientationMap<3>{},
+                                   false},
+          CoordinateMaps::TimeDependent::Translation<3>{"Translation"});
+  check_batched_inverse(time_dependent_map, target_points, 2.0,
+                        functions_of_time);
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
@@ -1504,5 +1589,6 @@ SPECTRE_TEST_CASE("Unit.Domain.CoordinateMap", "[Domain][Unit]") {
   test_push_back();
   test_jacobian_is_time_dependent();
   test_coords_frame_velocity_jacobians();
+  test_batched_inverse();
 }
 }  // namespace domain
@@ -10,6 +10,7 @@
 #include <optional>
 #include <string>
 #include <unordered_map>
+#include <vector>
 
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/Matrix.hpp"
@@ -27,6 +28,7 @@
 #include "Helpers/Domain/CoordinateMaps/TestMapHelpers.hpp"
 #include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 class DataVector;
 namespace domain::FunctionsOfTime {
@@ -250,6 +252,35 @@ void test_rotation_map() {
   CHECK(rotation_map == rotation_map_deserialized);
   CHECK_FALSE(rotation_map != rotation_map_deserialized);
 
+  {
+    INFO("Batched inverse");
+    const size_t num_points = 5;
+    const auto target_points =
+        make_with_random_values<std::array<DataVector, Dim>>(
+            make_not_null(&generator), dist, DataVector(num_points));
+    auto source_points = target_points;
+    // The map is invertible everywhere, so the validity of the points is left
+    // unchanged
+    std::vector<bool> is_valid(num_points, true);
+    is_valid[1] = false;
+    const std::vector<bool> expected_is_valid = is_valid;
+    rotation_map.inverse(make_not_null(&source_points),
+                         make_not_null(&is_valid), t, f_of_t_list);
+    CHECK(is_valid == expected_is_valid);
+    for (size_t s = 0; s < num_points; ++s) {
+      std::array<double, Dim> target_point{};
+      for (size_t d = 0; d < Dim; ++d) {
+        gsl::at(target_point, d) = gsl::at(target_points, d)[s];
+      }
+      const auto expected_source_point =
+          rotation_map.inverse(target_point, t, f_of_t_list).value();
+      for (size_t d = 0; d < Dim; ++d) {
+        CHECK(gsl::at(source_points, d)[s] ==
+              custom_approx(gsl::at(expected_source_point, d)));
+      }
+    }
+  }
+
   test_coordinate_map_argument_types(rotation_map, initial_unmapped_point, t,
                                      f_of_t_list);
   CHECK(
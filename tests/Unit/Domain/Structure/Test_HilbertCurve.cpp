@@ -0,0 +1,75 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/HilbertCurve.hpp"
+#include "Domain/Structure/InitialElementIds.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/MakeArray.hpp"
+
+namespace {
+// Check that the Hilbert-curve indices of all elements of a block enumerate
+// the elements densely, and, if `check_adjacency`, that consecutive elements
+// share a face.
+template <size_t Dim>
+void check_hilbert_curve(const std::array<size_t, Dim>& refinement_levels,
+                         const bool check_adjacency) {
+  const auto element_ids = initial_element_ids(0, refinement_levels);
+  std::vector<const ElementId<Dim>*> elements_by_index(element_ids.size(),
+                                                        nullptr);
+  for (const auto& element_id : element_ids) {
+    const size_t index = domain::hilbert_curve_index(element_id);
+    REQUIRE(index < element_ids.size());
+    CHECK(elements_by_index[index] == nullptr);
+    elements_by_index[index] = &element_id;
+  }
+  if (not check_adjacency) {
+    return;
+  }
+  for (size_t i = 1; i < elements_by_index.size(); ++i) {
+    size_t distance = 0;
+    for (size_t d = 0; d < Dim; ++d) {
+      const size_t index = elements_by_index[i]->segment_id(d).index();
+      const size_t previous_index =
+          elements_by_index[i - 1]->segment_id(d).index();
+      distance += index > previous_index ? index - previous_index
+                                         : previous_index - index;
+    }
+    CHECK(distance == 1);
+  }
+}
+
+void test_hilbert_curve_index_2d() {
+  // The sketch in the documentation of `domain::hilbert_curve_index`
+  const std::array<std::array<size_t, 4>, 4> expected_indices{
+      {{{0, 3, 4, 5}}, {{1, 2, 7, 6}}, {{14, 13, 8, 9}}, {{15, 12, 11, 10}}}};
+  for (size_t x = 0; x < 4; ++x) {
+    for (size_t y = 0; y < 4; ++y) {
+      const ElementId<2> element_id(
+          0, make_array(SegmentId(2, x), SegmentId(2, y)));
+      CHECK(domain::hilbert_curve_index(element_id) ==
+            gsl::at(gsl::at(expected_indices, x), y));
+    }
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.Structure.HilbertCurve", "[Domain][Unit]") {
+  test_hilbert_curve_index_2d();
+  check_hilbert_curve(std::array<size_t, 1>{{0}}, true);
+  check_hilbert_curve(std::array<size_t, 1>{{3}}, true);
+  check_hilbert_curve(std::array<size_t, 2>{{3, 3}}, true);
+  check_hilbert_curve(std::array<size_t, 3>{{2, 2, 2}}, true);
+  check_hilbert_curve(std::array<size_t, 3>{{3, 0, 3}}, true);
+  // With anisotropic refinement the elements within a cell are ordered
+  // lexicographically, so only the enumeration is dense
+  check_hilbert_curve(std::array<size_t, 2>{{1, 3}}, false);
+  check_hilbert_curve(std::array<size_t, 3>{{2, 1, 3}}, false);
+}
@@ -65,4 +65,16 @@ SPECTRE_TEST_CASE("Unit.Domain.Tags.ElementDistribution", "[Unit][Domain]") {
           Catch::Matchers::ContainsSubstring(
               "Please choose another element distribution."));
   CHECK(make_option_without_lts_metavars("RoundRobin") == std::nullopt);
+
+  TestHelpers::db::test_simple_tag<domain::Tags::ElementOrdering>(
+      "ElementOrdering");
+  CHECK(TestHelpers::test_option_tag<domain::OptionTags::ElementOrdering>(
+            "ZCurve") == domain::SpaceFillingCurve::ZCurve);
+  CHECK(TestHelpers::test_option_tag<domain::OptionTags::ElementOrdering>(
+            "HilbertCurve") == domain::SpaceFillingCurve::HilbertCurve);
+  CHECK_THROWS_WITH(
+      TestHelpers::test_option_tag<domain::OptionTags::ElementOrdering>(
+          "PeanoCurve"),
+      Catch::Matchers::ContainsSubstring(
+          "SpaceFillingCurve must be 'ZCurve' or 'HilbertCurve'"));
 }
@@ -0,0 +1,142 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <random>
+
+#include "DataStructures/DataVector.hpp"
+#include "DataStructures/Tensor/Tensor.hpp"
+#include "Domain/BlockLogicalCoordinates.hpp"
+#include "Domain/BlockSpatialIndex.hpp"
+#include "Domain/Creators/Brick.hpp"
+#include "Domain/Creators/Sphere.hpp"
+#include "Domain/Creators/TimeDependence/UniformTranslation.hpp"
+#include "Domain/Domain.hpp"
+#include "Domain/FunctionsOfTime/FunctionOfTime.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
+
+namespace {
+template <typename Frame>
+void check_lookup(
+    const Domain<3>& domain, const domain::BlockSpatialIndex<3>& spatial_index,
+    const tnsr::I<DataVector, 3, Frame>& points,
+    const double time = std::numeric_limits<double>::signaling_NaN(),
+    const domain::FunctionsOfTimeMap& functions_of_time = {}) {
+  const auto expected =
+      block_logical_coordinates(domain, points, time, functions_of_time);
+  const auto result = block_logical_coordinates(domain, spatial_index, points,
+                                                time, functions_of_time);
+  REQUIRE(result.size() == expected.size());
+  for (size_t s = 0; s < expected.size(); ++s) {
+    REQUIRE(result[s].has_value() == expected[s].has_value());
+    if (not expected[s].has_value()) {
+      continue;
+    }
+    CHECK(result[s]->id == expected[s]->id);
+    CHECK_ITERABLE_APPROX(result[s]->data, expected[s]->data);
+    // A block that contains a point must never be discarded by the index
+    std::array<double, 3> point{};
+    for (size_t d = 0; d < 3; ++d) {
+      gsl::at(point, d) = points.get(d)[s];
+    }
+    CHECK(spatial_index.template may_contain<Frame>(
+        expected[s]->id.get_index(), point, time));
+  }
+}
+
+void test_time_independent() {
+  const auto shell = domain::creators::Sphere(
+      1.5, 2.5, domain::creators::Sphere::Excision{}, 0_st, 3_st, true);
+  const auto domain = shell.create_domain();
+  const domain::BlockSpatialIndex<3> spatial_index{domain};
+  CHECK(spatial_index.number_of_blocks() == domain.blocks().size());
+  CHECK(std::isnan(spatial_index.time()));
+
+  // Points far outside the shell are in no box
+  for (size_t block_id = 0; block_id < domain.blocks().size(); ++block_id) {
+    CHECK_FALSE(spatial_index.may_contain<Frame::Inertial>(
+        block_id, {{10.0, 0.0, 0.0}}));
+    CHECK_FALSE(
+        spatial_index.may_contain<Frame::Grid>(block_id, {{0.0, 0.0, -10.0}}));
+  }
+  // A point on the +x axis is not in the box of the -x wedge
+  size_t num_candidates = 0;
+  for (size_t block_id = 0; block_id < domain.blocks().size(); ++block_id) {
+    if (spatial_index.may_contain<Frame::Inertial>(block_id,
+                                                   {{2.0, 0.0, 0.0}})) {
+      ++num_candidates;
+    }
+  }
+  CHECK(num_candidates > 0);
+  CHECK(num_candidates < domain.blocks().size());
+
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-3.0, 3.0);
+  const auto points = make_with_random_values<tnsr::I<DataVector, 3>>(
+      make_not_null(&gen), make_not_null(&dist), DataVector{200});
+  check_lookup(domain, spatial_index, points);
+
+  const auto deserialized_index = serialize_and_deserialize(spatial_index);
+  for (size_t block_id = 0; block_id < domain.blocks().size(); ++block_id) {
+    CHECK(deserialized_index.may_contain<Frame::Inertial>(block_id,
+                                                          {{2.0, 0.0, 0.0}}) ==
+          spatial_index.may_contain<Frame::Inertial>(block_id,
+                                                     {{2.0, 0.0, 0.0}}));
+  }
+}
+
+void test_time_dependent() {
+  const auto uniform_translation =
+      domain::creators::time_dependence::UniformTranslation<3>(
+          0.0, {{1.0, 0.0, 0.0}}, {{0.0, 2.0, 0.0}});
+  const auto brick = domain::creators::Brick(
+      {{-0.5, -0.5, -0.5}}, {{0.5, 0.5, 0.5}}, {{0, 0, 0}}, {{3, 3, 3}},
+      {{false, false, false}}, uniform_translation.get_clone());
+  const auto domain = brick.create_domain();
+  const auto functions_of_time = uniform_translation.functions_of_time();
+  domain::BlockSpatialIndex<3> spatial_index{domain};
+
+  // The grid frame doesn't move
+  CHECK(spatial_index.may_contain<Frame::Grid>(0, {{0.0, 0.0, 0.0}}));
+  CHECK_FALSE(spatial_index.may_contain<Frame::Grid>(0, {{5.0, 0.0, 0.0}}));
+  // Without an update the index can't discard any inertial point
+  CHECK(spatial_index.may_contain<Frame::Inertial>(0, {{50.0, 0.0, 0.0}},
+                                                   5.0));
+
+  spatial_index.update(domain, 5.0, functions_of_time);
+  CHECK(spatial_index.time() == 5.0);
+  // The block is translated by 5 in x from the grid to the distorted frame,
+  // and by another 10 in y from the distorted to the inertial frame
+  CHECK(
+      spatial_index.may_contain<Frame::Distorted>(0, {{5.0, 0.0, 0.0}}, 5.0));
+  CHECK_FALSE(
+      spatial_index.may_contain<Frame::Distorted>(0, {{0.0, 0.0, 0.0}}, 5.0));
+  CHECK(
+      spatial_index.may_contain<Frame::Inertial>(0, {{5.0, 10.0, 0.0}}, 5.0));
+  CHECK_FALSE(
+      spatial_index.may_contain<Frame::Inertial>(0, {{5.0, 0.0, 0.0}}, 5.0));
+  // At a different time the index is conservative
+  CHECK(spatial_index.may_contain<Frame::Inertial>(0, {{0.0, 0.0, 0.0}}, 4.0));
+
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-1.0, 11.0);
+  const auto points = make_with_random_values<tnsr::I<DataVector, 3>>(
+      make_not_null(&gen), make_not_null(&dist), DataVector{200});
+  check_lookup(domain, spatial_index, points, 5.0, functions_of_time);
+  // Stale index gives the same results as no index
+  check_lookup(domain, spatial_index, points, 4.0, functions_of_time);
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Domain.BlockSpatialIndex", "[Domain][Unit]") {
+  test_time_independent();
+  test_time_dependent();
+}
@@ -19,11 +19,14 @@
 #include "Domain/Domain.hpp"
 #include "Domain/ElementDistribution.hpp"
 #include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/HilbertCurve.hpp"
 #include "Domain/Structure/InitialElementIds.hpp"
 #include "Domain/Structure/ZCurve.hpp"
 #include "Utilities/Algorithm.hpp"
 #include "Utilities/ConstantExpressions.hpp"
+#include "Utilities/GetOutput.hpp"
 #include "Utilities/Gsl.hpp"
+#include "Utilities/Literals.hpp"
 
 namespace {
 // Test the weighting done by `domain::get_element_costs` for a uniform cost
@@ -422,6 +425,86 @@ void test_weighted_element_distribution_construction(
   }
 }
 
+// Test `domain::measured_element_costs`
+void test_measured_element_costs() {
+  const std::vector<ElementId<1>> element_ids =
+      initial_element_ids(0, std::array{2_st});
+  std::unordered_map<ElementId<1>, double> estimated_costs{};
+  for (const auto& element_id : element_ids) {
+    estimated_costs.insert({element_id, 2.0});
+  }
+  CHECK(domain::measured_element_costs(estimated_costs, {}) ==
+        estimated_costs);
+
+  // The first two elements were measured. Their total measured cost is 3 times
+  // their total estimated cost, so the estimates of the others are scaled by 3.
+  // Non-positive measurements are ignored.
+  const std::unordered_map<ElementId<1>, double> measured_costs{
+      {element_ids[0], 2.0}, {element_ids[1], 10.0}, {element_ids[2], 0.0}};
+  const auto costs =
+      domain::measured_element_costs(estimated_costs, measured_costs);
+  REQUIRE(costs.size() == element_ids.size());
+  CHECK(costs.at(element_ids[0]) == approx(2.0));
+  CHECK(costs.at(element_ids[1]) == approx(10.0));
+  CHECK(costs.at(element_ids[2]) == approx(6.0));
+  CHECK(costs.at(element_ids[3]) == approx(6.0));
+}
+
+// Test `domain::partition_elements_by_cost`
+void test_partition_elements_by_cost() {
+  // Block 0 is refined once in x and the upper half is refined again, so the
+  // elements have different refinement levels. Block 1 is a single element.
+  const ElementId<1> lower{0, {{{1, 0}}}};
+  const ElementId<1> middle{0, {{{2, 2}}}};
+  const ElementId<1> upper{0, {{{2, 3}}}};
+  const ElementId<1> other_block{1, {{{0, 0}}}};
+  const std::unordered_map<ElementId<1>, double> element_costs{
+      {upper, 1.0}, {other_block, 2.0}, {lower, 2.0}, {middle, 1.0}};
+
+  CHECK(domain::partition_elements_by_cost(element_costs, 1) ==
+        std::unordered_map<ElementId<1>, size_t>{
+            {lower, 0}, {middle, 0}, {upper, 0}, {other_block, 0}});
+  // The elements are traversed in the order lower, middle, upper, other_block
+  // with a target cost of 3 per processor
+  CHECK(domain::partition_elements_by_cost(element_costs, 2) ==
+        std::unordered_map<ElementId<1>, size_t>{
+            {lower, 0}, {middle, 0}, {upper, 1}, {other_block, 1}});
+  CHECK(domain::partition_elements_by_cost(element_costs, 2, {0, 2}) ==
+        std::unordered_map<ElementId<1>, size_t>{
+            {lower, 1}, {middle, 1}, {upper, 3}, {other_block, 3}});
+  CHECK(domain::partition_elements_by_cost(
+            element_costs, 3, {}, domain::SpaceFillingCurve::HilbertCurve) ==
+        std::unordered_map<ElementId<1>, size_t>{
+            {lower, 0}, {middle, 1}, {upper, 1}, {other_block, 2}});
+  // More processors than elements leaves the last processors empty
+  CHECK(domain::partition_elements_by_cost(element_costs, 6) ==
+        std::unordered_map<ElementId<1>, size_t>{
+            {lower, 0}, {middle, 1}, {upper, 2}, {other_block, 3}});
+
+  // A mixed-refinement 2D block. The measured costs in the upper right
+  // element are high, so it gets a processor to itself.
+  const ElementId<2> lower_left{0, {{{1, 0}, {1, 0}}}};
+  const ElementId<2> lower_right{0, {{{1, 1}, {1, 0}}}};
+  const ElementId<2> upper_left{0, {{{1, 0}, {1, 1}}}};
+  const ElementId<2> upper_right_0{0, {{{2, 2}, {2, 2}}}};
+  const ElementId<2> upper_right_1{0, {{{2, 3}, {2, 2}}}};
+  const ElementId<2> upper_right_2{0, {{{2, 2}, {2, 3}}}};
+  const ElementId<2> upper_right_3{0, {{{2, 3}, {2, 3}}}};
+  const std::unordered_map<ElementId<2>, double> element_costs_2d{
+      {lower_left, 1.0},    {lower_right, 1.0},   {upper_left, 1.0},
+      {upper_right_0, 1.0}, {upper_right_1, 1.0}, {upper_right_2, 1.0},
+      {upper_right_3, 6.0}};
+  const auto procs_2d = domain::partition_elements_by_cost(element_costs_2d, 2);
+  CHECK(procs_2d == std::unordered_map<ElementId<2>, size_t>{
+                        {lower_left, 0},
+                        {lower_right, 0},
+                        {upper_left, 0},
+                        {upper_right_0, 0},
+                        {upper_right_1, 0},
+                        {upper_right_2, 0},
+                        {upper_right_3, 1}});
+}
+
 // Test the retrieval of the assigned processor that is done by
 // `domain::BlockZCurveProcDistribution::get_proc_for_element`
 template <size_t Dim>
@@ -429,7 +512,9 @@ void test_proc_retrieval(
     const domain::ElementWeight element_weight,
     const DomainCreator<Dim>& domain_creator,
     const size_t number_of_procs_with_elements,
-    const std::unordered_set<size_t>& global_procs_to_ignore = {}) {
+    const std::unordered_set<size_t>& global_procs_to_ignore = {},
+    const domain::SpaceFillingCurve space_filling_curve =
+        domain::SpaceFillingCurve::ZCurve) {
   const auto domain = domain_creator.create_domain();
   const auto& blocks = domain.blocks();
   const auto initial_refinement_levels =
@@ -442,10 +527,19 @@ void test_proc_retrieval(
   for (size_t i = 0; i < num_blocks; i++) {
     element_ids_in_z_curve_order[i] =
         initial_element_ids(i, gsl::at(initial_refinement_levels, i), 0);
-    alg::sort(element_ids_in_z_curve_order[i],
-              [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
-                return domain::z_curve_index(lhs) < domain::z_curve_index(rhs);
-              });
+    if (space_filling_curve == domain::SpaceFillingCurve::HilbertCurve) {
+      alg::sort(element_ids_in_z_curve_order[i],
+                [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
+                  return domain::hilbert_curve_index(lhs) <
+                         domain::hilbert_curve_index(rhs);
+                });
+    } else {
+      alg::sort(element_ids_in_z_curve_order[i],
+                [](const ElementId<Dim>& lhs, const ElementId<Dim>& rhs) {
+                  return domain::z_curve_index(lhs) <
+                         domain::z_curve_index(rhs);
+                });
+    }
   }
 
   const auto costs = domain::get_element_costs(
@@ -454,7 +548,7 @@ void test_proc_retrieval(
 
   const domain::BlockZCurveProcDistribution<Dim> element_distribution(
       costs, number_of_procs_with_elements, blocks, initial_refinement_levels,
-      initial_extents, global_procs_to_ignore);
+      initial_extents, global_procs_to_ignore, space_filling_curve);
   const auto proc_map = element_distribution.block_element_distribution();
 
   const size_t total_number_of_procs =
@@ -543,4 +637,16 @@ SPECTRE_TEST_CASE("Unit.Domain.ElementDistribution", "[Domain][Unit]") {
   // `Element`s in the domain
   test_proc_retrieval(domain::ElementWeight::NumGridPointsAndGridSpacing,
                       lattice_2d, 100, std::unordered_set<size_t>{17});
+  // Test processor retrieval with Hilbert-curve ordering
+  test_proc_retrieval(domain::ElementWeight::NumGridPoints, lattice_2d, 7,
+                      std::unordered_set<size_t>{2},
+                      domain::SpaceFillingCurve::HilbertCurve);
+  test_proc_retrieval(domain::ElementWeight::NumGridPoints, lattice_3d, 13, {},
+                      domain::SpaceFillingCurve::HilbertCurve);
+
+  test_measured_element_costs();
+  test_partition_elements_by_cost();
+
+  CHECK(get_output(domain::SpaceFillingCurve::ZCurve) == "ZCurve");
+  CHECK(get_output(domain::SpaceFillingCurve::HilbertCurve) == "HilbertCurve");
 }
@@ -43,6 +43,7 @@
 #include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
 #include "Time/History.hpp"
 #include "Time/Slab.hpp"
+#include "Time/Tags/DenseOutputCache.hpp"
 #include "Time/Tags/HistoryEvolvedVariables.hpp"
 #include "Time/Tags/Time.hpp"
 #include "Time/Tags/TimeStep.hpp"
@@ -272,6 +273,7 @@ struct Component {
       tmpl::push_front<extra_data, Tags::TimeStepId, Tags::TimeStep, Tags::Time,
                        ::Tags::PreviousTriggerTime, variables_tag,
                        Tags::HistoryEvolvedVariables<variables_tag>,
+                       Tags::DenseOutputCache<variables_tag>,
                        ::Tags::EventsAndDenseTriggers,
                        domain::Tags::NeighborMesh<1>, domain::Tags::Element<1>>;
   using compute_tags = time_stepper_ref_tags<TimeStepper>;
@@ -377,6 +379,7 @@ void test(const bool time_runs_forward) {
               runner, ActionTesting::NodeId{0}, ActionTesting::LocalCoreId{0},
               0, {}, time_step_id, exact_step_size, start_time,
               std::optional<double>{}, stored_vars, std::move(history),
+              typename Tags::DenseOutputCache<variables_tag>::type{},
               EventsAndDenseTriggers(std::move(events_and_dense_triggers)),
               typename domain::Tags::NeighborMesh<1>::type{},
               Element<1>{ElementId<1>{0}, {}},
@@ -636,6 +639,27 @@ struct NotReady {
     return false;
   }
 };
+
+struct ReadyOnRetry {
+  using return_tags = tmpl::list<>;
+  using argument_tags = tmpl::list<>;
+  static void apply() {}
+
+  template <typename DbTagsList, typename... InboxTags, typename Metavariables,
+            typename ArrayIndex, typename ParallelComponent>
+  static bool is_ready(
+      const gsl::not_null<db::DataBox<DbTagsList>*> /*box*/,
+      const gsl::not_null<tuples::TaggedTuple<InboxTags...>*> /*inboxes*/,
+      Parallel::GlobalCache<Metavariables>& /*cache*/,
+      const ArrayIndex& /*array_index*/,
+      const ParallelComponent* const /*component*/) {
+    return ready;
+  }
+
+  static bool ready;
+};
+
+bool ReadyOnRetry::ready = false;
 }  // namespace test_postprocessors
 
 namespace test_cases {
@@ -664,6 +688,43 @@ struct NotReady {
   }
 };
 
+struct RetryUntilReady {
+  using postprocessors = tmpl::list<test_postprocessors::ReadyOnRetry>;
+  using metavariables = Metavariables<postprocessors>;
+  using MockRuntimeSystem = ActionTesting::MockRuntimeSystem<metavariables>;
+  static void check_dense(
+      const gsl::not_null<MockRuntimeSystem*> runner, const bool should_run,
+      const std::vector<std::pair<double, EvolvedVariables>>& expected_calls) {
+    using cache_tag = Tags::DenseOutputCache<System::variables_tag>;
+    test_postprocessors::ReadyOnRetry::ready = false;
+    CHECK(not run_if_ready(runner));
+    TestEvent::check_calls({});
+
+    auto& box = ActionTesting::get_databox<Component<metavariables>>(runner, 0);
+    const auto& cache = db::get<cache_tag>(box);
+    REQUIRE(cache.has_value());
+    CHECK(cache->time == expected_calls.front().first);
+    CHECK(cache->value == expected_calls.front().second);
+
+    // The retry should use the cached dense output instead of
+    // recomputing it, so modifications to the cache are seen by the
+    // events.
+    db::mutate<cache_tag>(
+        [](const gsl::not_null<typename cache_tag::type*> dense_output_cache) {
+          get(get<EvolvedVar>((*dense_output_cache)->value)) *= 2.0;
+        },
+        make_not_null(&box));
+    auto modified_calls = expected_calls;
+    get(get<EvolvedVar>(modified_calls.front().second)) *= 2.0;
+
+    test_postprocessors::ReadyOnRetry::ready = true;
+    CHECK(run_if_ready(runner) == should_run);
+    TestEvent::check_calls(modified_calls);
+    // The cached copy is not kept once it has been used.
+    CHECK_FALSE(db::get<cache_tag>(box).has_value());
+  }
+};
+
 struct PostprocessA {
   using postprocessors =
       tmpl::list<AlwaysReadyPostprocessor<test_postprocessors::SetA>>;
@@ -782,6 +843,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.RunEventsAndDenseTriggers",
   for (const auto time_runs_forward : {true, false}) {
     test<test_cases::NoPostprocessors>(time_runs_forward);
     test<test_cases::NotReady>(time_runs_forward);
+    test<test_cases::RetryUntilReady>(time_runs_forward);
     test<test_cases::PostprocessA>(time_runs_forward);
     test<test_cases::PostprocessAll>(time_runs_forward);
     test<test_cases::PostprocessEvolved>(time_runs_forward);
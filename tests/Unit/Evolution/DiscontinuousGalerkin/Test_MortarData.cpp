@@ -268,6 +268,33 @@ void test_local_time_stepping_usage(const bool use_gauss_points) {
 
   CHECK(mortar_data == deserialized_mortar_data);
   CHECK_FALSE(mortar_data != deserialized_mortar_data);
+
+  {
+    INFO("Reuse the memory");
+    const double* const local_data_pointer =
+        mortar_data.local_mortar_data()->second.data();
+    mortar_data.reset_keeping_allocations();
+    CHECK(mortar_data.time_step_id() == TimeStepId{});
+    CHECK(mortar_data.current_buffer_index() == 0);
+    CHECK_FALSE(mortar_data.neighbor_mortar_data().has_value());
+    REQUIRE(mortar_data.local_mortar_data().has_value());
+    CHECK(mortar_data.local_mortar_data()->second.data() ==
+          local_data_pointer);
+
+    // The kind of geometric quantities may change after the reset
+    if (use_gauss_points) {
+      mortar_data.insert_local_face_normal_magnitude(
+          local_face_normal_magnitude);
+    } else {
+      mortar_data.insert_local_geometric_quantities(
+          local_volume_det_inv_jacobian, local_face_det_jacobian,
+          local_face_normal_magnitude);
+    }
+    Scalar<DataVector> retrieved_local_face_normal_magnitude{};
+    mortar_data.get_local_face_normal_magnitude(
+        &retrieved_local_face_normal_magnitude);
+    CHECK(retrieved_local_face_normal_magnitude == local_face_normal_magnitude);
+  }
 }
 
 template <size_t Dim>
@@ -84,11 +84,11 @@ void test_klein_gordon_h5_initialization(const gsl::not_null<Generator*> gen) {
   ActionTesting::emplace_component<component>(
       &runner, 0,
       Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-          l_max, filename, buffer_size,
+          l_max, filename, buffer_size, false, false,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
           false, false, std::optional<double>{}),
       Tags::KleinGordonH5WorldtubeBoundaryDataManager::create_from_options(
-          l_max, filename, buffer_size,
+          l_max, filename, buffer_size, false, false,
           std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
           std::optional<double>{}));
 
@@ -3,9 +3,12 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
+#include <complex>
 #include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
+#include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/TagName.hpp"
 #include "DataStructures/DataVector.hpp"
 #include "DataStructures/SpinWeighted.hpp"
@@ -17,6 +20,8 @@
 #include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "Helpers/Evolution/Systems/Cce/BoundaryTestHelpers.hpp"
 #include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshCollocation.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshDerivatives.hpp"
+#include "NumericalAlgorithms/SpinWeightedSphericalHarmonics/SwshTransform.hpp"
 #include "PointwiseFunctions/AnalyticSolutions/GeneralRelativity/KerrSchild.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/Phi.hpp"
 #include "PointwiseFunctions/GeneralRelativity/GeneralizedHarmonic/Pi.hpp"
@@ -150,6 +155,59 @@ void test_trigonometric_function_identities(
   }
 }
 
+template <typename Generator>
+void test_batched_transforms(const gsl::not_null<Generator*> gen) {
+  UniformCustomDistribution<size_t> l_dist(3, 6);
+  const size_t l_max = l_dist(*gen);
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  UniformCustomDistribution<double> value_dist{0.1, 0.5};
+
+  std::array<ComplexModalVector, 3> coefficients{};
+  std::array<DataVector, 3> expected_collocations{};
+  std::array<DataVector, 3> expected_theta_derivatives{};
+  std::array<DataVector, 3> expected_phi_derivatives{};
+  for (size_t i = 0; i < 3; ++i) {
+    const auto random_values = make_with_random_values<DataVector>(
+        gen, make_not_null(&value_dist), number_of_angular_points);
+    SpinWeighted<ComplexDataVector, 0> complex_random_values{
+        ComplexDataVector{std::complex<double>(1.0, 0.0) * random_values}};
+    gsl::at(coefficients, i) =
+        Spectral::Swsh::swsh_transform(l_max, 1, complex_random_values).data();
+    const SpinWeighted<ComplexModalVector, 0> modes{gsl::at(coefficients, i)};
+    const auto collocation =
+        Spectral::Swsh::inverse_swsh_transform(l_max, 1, modes);
+    gsl::at(expected_collocations, i) = real(collocation.data());
+    SpinWeighted<ComplexDataVector, 0> real_collocation{
+        ComplexDataVector{std::complex<double>(1.0, 0.0) *
+                          gsl::at(expected_collocations, i)}};
+    const auto eth_value =
+        Spectral::Swsh::angular_derivative<Spectral::Swsh::Tags::Eth>(
+            l_max, 1, real_collocation);
+    gsl::at(expected_theta_derivatives, i) = -real(eth_value.data());
+    gsl::at(expected_phi_derivatives, i) = -imag(eth_value.data());
+  }
+
+  std::array<DataVector, 3> collocations{};
+  detail::batched_real_inverse_swsh_transform<3>(
+      {{&collocations[0], &collocations[1], &collocations[2]}},
+      {{&coefficients[0], &coefficients[1], &coefficients[2]}}, l_max);
+  std::array<DataVector, 3> theta_derivatives{};
+  std::array<DataVector, 3> phi_derivatives{};
+  detail::batched_real_angular_derivatives<3>(
+      {{&theta_derivatives[0], &theta_derivatives[1], &theta_derivatives[2]}},
+      {{&phi_derivatives[0], &phi_derivatives[1], &phi_derivatives[2]}},
+      {{&collocations[0], &collocations[1], &collocations[2]}}, l_max);
+  for (size_t i = 0; i < 3; ++i) {
+    CHECK_ITERABLE_APPROX(gsl::at(collocations, i),
+                          gsl::at(expected_collocations, i));
+    CHECK_ITERABLE_APPROX(gsl::at(theta_derivatives, i),
+                          gsl::at(expected_theta_derivatives, i));
+    CHECK_ITERABLE_APPROX(gsl::at(phi_derivatives, i),
+                          gsl::at(expected_phi_derivatives, i));
+  }
+}
+
 template <typename Generator>
 void test_bondi_r(const gsl::not_null<Generator*> gen) {
   UniformCustomDistribution<size_t> l_dist(3, 6);
@@ -606,6 +664,7 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.BoundaryData", "[Unit][Cce]") {
 
   MAKE_GENERATOR(gen);
   test_trigonometric_function_identities(make_not_null(&gen));
+  test_batched_transforms(make_not_null(&gen));
   test_bondi_r(make_not_null(&gen));
   test_d_bondi_r_identities(make_not_null(&gen));
   test_dyad_identities(make_not_null(&gen));
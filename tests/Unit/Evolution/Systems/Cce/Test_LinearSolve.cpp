@@ -4,10 +4,13 @@
 #include "Framework/TestingFramework.hpp"
 
 #include <algorithm>
+#include <complex>
+#include <cstddef>
 
 #include "DataStructures/ComplexDataVector.hpp"
 #include "DataStructures/ComplexModalVector.hpp"
 #include "DataStructures/DataBox/PrefixHelpers.hpp"
+#include "DataStructures/DataVector.hpp"
 #include "Evolution/Systems/Cce/LinearSolve.hpp"
 #include "Evolution/Systems/Cce/OptionTags.hpp"
 #include "Evolution/Systems/Cce/Tags.hpp"
@@ -466,6 +469,32 @@ void test_pole_integration_with_linear_operator(
                                numerical_differentiation_approximation);
 }
 
+template <typename Generator>
+void test_transpose_to_radial_stripes(const gsl::not_null<Generator*> gen,
+                                      const size_t number_of_radial_grid_points,
+                                      const size_t l_max) {
+  UniformCustomDistribution<double> dist(-1.0, 1.0);
+  const size_t number_of_angular_points =
+      Spectral::Swsh::number_of_swsh_collocation_points(l_max);
+  const auto input = make_with_random_values<ComplexDataVector>(
+      gen, make_not_null(&dist),
+      number_of_radial_grid_points * number_of_angular_points);
+  DataVector result{2 * input.size()};
+  detail::transpose_to_reals_then_imags_radial_stripes(
+      make_not_null(&result), input, number_of_radial_grid_points,
+      number_of_angular_points);
+  for (size_t angular = 0; angular < number_of_angular_points; ++angular) {
+    for (size_t radial = 0; radial < number_of_radial_grid_points; ++radial) {
+      const std::complex<double> value =
+          input[radial * number_of_angular_points + angular];
+      CHECK(result[2 * angular * number_of_radial_grid_points + radial] ==
+            real(value));
+      CHECK(result[(2 * angular + 1) * number_of_radial_grid_points +
+                   radial] == imag(value));
+    }
+  }
+}
+
 SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
   MAKE_GENERATOR(gen);
   UniformCustomDistribution<size_t> sdist{3, 6};
@@ -482,6 +511,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.LinearSolve", "[Unit][Cce]") {
                                       number_of_radial_grid_points, l_max);
   test_pole_integration_with_linear_operator<Tags::BondiH>(
       make_not_null(&gen), number_of_radial_grid_points, l_max);
+  test_transpose_to_radial_stripes(make_not_null(&gen),
+                                   number_of_radial_grid_points, l_max);
 }
 }  // namespace
 }  // namespace Cce
@@ -119,6 +119,8 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
         "OptionTagsKleinGordonCceR0100.h5");
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5LookaheadTimes>("5") ==
         5_st);
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5Prefetch>("true"));
+  CHECK(TestHelpers::test_option_tag<Cce::OptionTags::H5LoadAllData>("true"));
   CHECK(TestHelpers::test_option_tag<Cce::OptionTags::ScriInterpolationOrder>(
             "4") == 4_st);
 
@@ -184,8 +186,14 @@ SPECTRE_TEST_CASE("Unit.Evolution.Systems.Cce.OptionTags", "[Unit][Cce]") {
       filename, 4.0, 100.0, 0.0, 0.1, 8);
 
   CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
-            8, filename, 3, std::make_unique<intrp::CubicSpanInterpolator>(),
-            false, true, std::nullopt)
+            8, filename, 3, false, false,
+            std::make_unique<intrp::CubicSpanInterpolator>(), false, true,
+            std::nullopt)
+            ->get_l_max() == 8);
+  CHECK(Cce::Tags::H5WorldtubeBoundaryDataManager::create_from_options(
+            8, filename, 3, true, true,
+            std::make_unique<intrp::CubicSpanInterpolator>(), false, true,
+            std::nullopt)
             ->get_l_max() == 8);
 
   CHECK(Cce::Tags::FilePrefix::create_from_options("Shrek 2") == "Shrek 2");
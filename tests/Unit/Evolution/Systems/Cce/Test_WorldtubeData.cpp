@@ -727,6 +727,55 @@ void test_reduced_spec_worldtube_buffer_updater(
       make_not_null(&time_span_end_from_serialized), target_time,
       computation_l_max, interpolator_length, buffer_size);
 
+  {
+    INFO("Prefetching and loading all data");
+    Parallel::NodeLock hdf5_lock{};
+    // Prefetching and loading all data only change when the data is read, so
+    // the boundary data must be identical to that of a manager that reads
+    // each span when it is needed.
+    const BondiWorldtubeDataManager expected_manager{
+        std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
+                                                        extraction_radius),
+        file_l_max, 2,
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u)};
+    const BondiWorldtubeDataManager prefetching_manager{
+        std::make_unique<BondiWorldtubeH5BufferUpdater>(filename,
+                                                        extraction_radius),
+        file_l_max, 2,
+        std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u, 4u),
+        true};
+    const auto preloaded_manager =
+        serialize_and_deserialize(BondiWorldtubeDataManager{
+            std::make_unique<BondiWorldtubeH5BufferUpdater>(
+                filename, extraction_radius, true),
+            file_l_max, 2,
+            std::make_unique<intrp::BarycentricRationalSpanInterpolator>(3u,
+                                                                         4u),
+            true});
+    Variables<
+        Tags::characteristic_worldtube_boundary_tags<Tags::BoundaryValue>>
+        expected_boundary_data{number_of_angular_points};
+    auto prefetched_boundary_data = expected_boundary_data;
+    auto preloaded_boundary_data = expected_boundary_data;
+    for (size_t step = 0; step < 50; ++step) {
+      const double time =
+          target_time - 0.07 + 0.003 * static_cast<double>(step);
+      CHECK(expected_manager.populate_hypersurface_boundary_data(
+          make_not_null(&expected_boundary_data), time,
+          make_not_null(&hdf5_lock)));
+      CHECK(prefetching_manager.populate_hypersurface_boundary_data(
+          make_not_null(&prefetched_boundary_data), time,
+          make_not_null(&hdf5_lock)));
+      CHECK(preloaded_manager.populate_hypersurface_boundary_data(
+          make_not_null(&preloaded_boundary_data), time,
+          make_not_null(&hdf5_lock)));
+      CHECK(prefetched_boundary_data == expected_boundary_data);
+      CHECK(preloaded_boundary_data == expected_boundary_data);
+      CHECK(prefetching_manager.get_time_span() ==
+            expected_manager.get_time_span());
+    }
+  }
+
   if (file_system::check_if_file_exists(filename)) {
     file_system::rm(filename, true);
   }
@@ -3,9 +3,11 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cmath>
 #include <cstddef>
 #include <limits>
+#include <optional>
 #include <random>
 
 #include "DataStructures/DataVector.hpp"
@@ -13,6 +15,7 @@
 #include "DataStructures/Tensor/Tensor.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/ConservativeFromPrimitive.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.hpp"
+#include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAl.tpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/KastaunEtAlHydro.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/NewmanHamlin.hpp"
 #include "Evolution/Systems/GrMhd/ValenciaDivClean/PalenzuelaEtAl.hpp"
@@ -27,6 +30,7 @@
 #include "PointwiseFunctions/Hydro/EquationsOfState/HybridEos.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/IdealFluid.hpp"
 #include "PointwiseFunctions/Hydro/EquationsOfState/PolytropicFluid.hpp"
+#include "Utilities/ConstantExpressions.hpp"
 #include "Utilities/Gsl.hpp"
 #include "Utilities/MakeWithValue.hpp"
 #include "Utilities/TMPL.hpp"
@@ -410,6 +414,112 @@ void test_primitive_from_conservative_known(const DataVector& used_for_size) {
   }
 }
 
+// Checks that recovering a batch of points with KastaunEtAl::apply_simd gives
+// the same result as recovering each point with KastaunEtAl::apply, including
+// at points where the recovery fails or that apply_simd hands off to apply.
+template <bool EnforcePhysicality>
+void test_kastaun_simd(
+    const gsl::not_null<std::mt19937*> generator,
+    const EquationsOfState::Equilibrium3D<EquationsOfState::IdealFluid<true>>&
+        equation_of_state) {
+  using grmhd::ValenciaDivClean::PrimitiveRecoverySchemes::KastaunEtAl;
+  constexpr size_t width = KastaunEtAl::simd_width;
+  const grmhd::ValenciaDivClean::PrimitiveFromConservativeOptions
+      primitive_from_conservative_options(0.0, 0.0,
+                                          std::numeric_limits<double>::max());
+  std::uniform_real_distribution<double> distribution(0.0, 1.0);
+  for (size_t trial = 0; trial < 20; ++trial) {
+    std::array<double, width> tau{};
+    std::array<double, width> momentum_density_squared{};
+    std::array<double, width> momentum_density_dot_magnetic_field{};
+    std::array<double, width> magnetic_field_squared{};
+    std::array<double, width> rest_mass_density_times_lorentz_factor{};
+    std::array<double, width> electron_fraction{};
+    for (size_t i = 0; i < width; ++i) {
+      // Conserved variables in flat space of a state with density and
+      // specific internal energy spanning several orders of magnitude
+      const double rest_mass_density =
+          1.0e-8 * exp(log(1.0e10) * distribution(*generator));
+      const double specific_internal_energy =
+          1.0e-3 * exp(log(1.0e4) * distribution(*generator));
+      const double pressure =
+          get(equation_of_state.pressure_from_density_and_energy(
+              Scalar<double>{rest_mass_density},
+              Scalar<double>{specific_internal_energy}, Scalar<double>{0.1}));
+      const double speed = 0.05 + 0.9 * distribution(*generator);
+      const double lorentz_factor = 1.0 / sqrt(1.0 - square(speed));
+      const double enthalpy_density_times_w_squared =
+          (rest_mass_density * (1.0 + specific_internal_energy) + pressure) *
+          square(lorentz_factor);
+      // Velocity along x, magnetic field in the x-y plane
+      const std::array<double, 2> magnetic_field{
+          {sqrt(pressure) * distribution(*generator),
+           sqrt(pressure) * distribution(*generator)}};
+      const double b_squared =
+          square(magnetic_field[0]) + square(magnetic_field[1]);
+      const double b_dot_v = magnetic_field[0] * speed;
+      const std::array<double, 2> momentum_density{
+          {(enthalpy_density_times_w_squared + b_squared) * speed -
+               b_dot_v * magnetic_field[0],
+           -b_dot_v * magnetic_field[1]}};
+      gsl::at(rest_mass_density_times_lorentz_factor, i) =
+          rest_mass_density * lorentz_factor;
+      gsl::at(tau, i) =
+          enthalpy_density_times_w_squared + b_squared - pressure -
+          0.5 * (square(b_dot_v) + b_squared / square(lorentz_factor)) -
+          gsl::at(rest_mass_density_times_lorentz_factor, i);
+      gsl::at(momentum_density_squared, i) =
+          square(momentum_density[0]) + square(momentum_density[1]);
+      gsl::at(momentum_density_dot_magnetic_field, i) =
+          momentum_density[0] * magnetic_field[0] +
+          momentum_density[1] * magnetic_field[1];
+      gsl::at(magnetic_field_squared, i) = b_squared;
+      gsl::at(electron_fraction, i) = 0.1;
+    }
+    // Give one point a NaN and, when physicality isn't enforced, make another
+    // one unphysical so that the recovery fails at some of the points
+    if (trial % 2 == 1) {
+      gsl::at(momentum_density_squared, trial % width) =
+          std::numeric_limits<double>::quiet_NaN();
+      if constexpr (not EnforcePhysicality and width > 1) {
+        gsl::at(tau, (trial + 1) % width) = -1.0;
+      }
+    }
+
+    const auto batch_result = KastaunEtAl::apply_simd<EnforcePhysicality>(
+        tau.data(), momentum_density_squared.data(),
+        momentum_density_dot_magnetic_field.data(),
+        magnetic_field_squared.data(),
+        rest_mass_density_times_lorentz_factor.data(), electron_fraction.data(),
+        equation_of_state, primitive_from_conservative_options);
+    Approx custom_approx = Approx::custom().epsilon(1.0e-12).scale(1.0);
+    for (size_t i = 0; i < width; ++i) {
+      CAPTURE(i);
+      const auto expected = KastaunEtAl::apply<EnforcePhysicality>(
+          0.0, gsl::at(tau, i), gsl::at(momentum_density_squared, i),
+          gsl::at(momentum_density_dot_magnetic_field, i),
+          gsl::at(magnetic_field_squared, i),
+          gsl::at(rest_mass_density_times_lorentz_factor, i),
+          gsl::at(electron_fraction, i), equation_of_state,
+          primitive_from_conservative_options);
+      const auto& result = gsl::at(batch_result, i);
+      REQUIRE(result.has_value() == expected.has_value());
+      if (expected.has_value()) {
+        CHECK(result->rest_mass_density ==
+              custom_approx(expected->rest_mass_density));
+        CHECK(result->lorentz_factor ==
+              custom_approx(expected->lorentz_factor));
+        CHECK(result->pressure == custom_approx(expected->pressure));
+        CHECK(result->specific_internal_energy ==
+              custom_approx(expected->specific_internal_energy));
+        CHECK(result->rho_h_w_squared ==
+              custom_approx(expected->rho_h_w_squared));
+        CHECK(result->electron_fraction == expected->electron_fraction);
+      }
+    }
+  }
+}
+
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
@@ -535,4 +645,8 @@ SPECTRE_TEST_CASE("Unit.GrMhd.ValenciaDivClean.PrimitiveFromConservative",
       wrapped_3d_polytrope_hot, make_with_value<Scalar<DataVector>>(dv, 1e-4),
       make_with_value<Scalar<DataVector>>(dv, 1e-1),
       make_with_value<Scalar<DataVector>>(dv, 1.0), &generator);
+
+  INFO("Batched Kastaun");
+  test_kastaun_simd<true>(make_not_null(&generator), wrapped_ideal_fluid);
+  test_kastaun_simd<false>(make_not_null(&generator), wrapped_ideal_fluid);
 }
@@ -507,6 +507,10 @@ class MockDistributedObjectProxy : public CProxyElement_ArrayElement {
 
   void set_terminate(bool t) { mock_distributed_object_->set_terminate(t); }
 
+  void migrate_to(const int new_proc) {
+    mock_distributed_object_->migrate_to(new_proc);
+  }
+
   // Actions may call this, but since tests step through actions manually it has
   // no effect.
   void perform_algorithm() {}
@@ -380,6 +380,13 @@ class MockDistributedObject {
   void set_terminate(bool t) { terminate_ = t; }
   bool get_terminate() const { return terminate_; }
 
+  // Migration isn't supported, so we only record the processing element that
+  // the distributed object was asked to migrate to
+  void migrate_to(const int new_proc) { migrated_to_proc_ = new_proc; }
+  const std::optional<int>& migrated_to_proc() const {
+    return migrated_to_proc_;
+  }
+
   // There are no phase bookmarks in mock distributed objects, so we just
   // return an empty map
   std::unordered_map<Parallel::Phase, size_t> phase_bookmarks() { return {}; }
@@ -706,6 +713,7 @@ class MockDistributedObject {
 
   bool terminate_{false};
   bool halt_algorithm_until_next_phase_{false};
+  std::optional<int> migrated_to_proc_{};
   databox_type box_;
   // The next action we should execute.
   size_t algorithm_step_ = 0;
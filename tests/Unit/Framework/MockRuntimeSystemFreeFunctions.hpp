@@ -7,6 +7,7 @@
 #pragma once
 
 #include <cstddef>
+#include <optional>
 #include <random>
 #include <utility>
 #include <vector>
@@ -374,6 +375,18 @@ bool get_terminate(const MockRuntimeSystem<Metavariables>& runner,
       .get_terminate();
 }
 
+/// Returns the processing element that the `Component` with index
+/// `array_index` was asked to migrate to, or `std::nullopt` if it wasn't. The
+/// mock distributed objects don't actually migrate.
+template <typename Component, typename Metavariables>
+const std::optional<int>& migrated_to_proc(
+    const MockRuntimeSystem<Metavariables>& runner,
+    const typename Component::array_index& array_index) {
+  return runner.template mock_distributed_objects<Component>()
+      .at(array_index)
+      .migrated_to_proc();
+}
+
 /// Returns the GlobalCache of `Component` with index `array_index`.
 template <typename Component, typename Metavariables, typename ArrayIndex>
 Parallel::GlobalCache<Metavariables>& cache(
@@ -0,0 +1,145 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <random>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataVector.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/Compression.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+
+namespace {
+template <typename T>
+void test_round_mantissa(const gsl::not_null<std::mt19937*> generator) {
+  std::uniform_real_distribution<T> mantissa_distribution(-1.0, 1.0);
+  std::uniform_int_distribution<int> exponent_distribution(-30, 30);
+  std::vector<T> data(1000);
+  for (auto& value : data) {
+    value = std::ldexp(mantissa_distribution(*generator),
+                       exponent_distribution(*generator));
+  }
+  data[0] = 0.0;
+  data[1] = -0.0;
+  data[2] = 1.0;
+  data[3] = std::numeric_limits<T>::max();
+  data[4] = std::numeric_limits<T>::infinity();
+  data[5] = -std::numeric_limits<T>::infinity();
+  data[6] = std::numeric_limits<T>::quiet_NaN();
+  for (const double max_relative_error : {0.4, 1.0e-3, 1.0e-6, 1.0e-30}) {
+    CAPTURE(max_relative_error);
+    std::vector<T> rounded = data;
+    h5::round_mantissa(gsl::make_span(rounded), max_relative_error);
+    for (size_t i = 0; i < data.size(); ++i) {
+      CAPTURE(data[i]);
+      if (std::isnan(data[i])) {
+        CHECK(std::isnan(rounded[i]));
+      } else if (std::isinf(data[i]) or data[i] == 0.0) {
+        CHECK(rounded[i] == data[i]);
+      } else {
+        CHECK(std::isfinite(rounded[i]));
+        CHECK(std::abs(static_cast<double>(rounded[i]) - data[i]) <=
+              max_relative_error * std::abs(static_cast<double>(data[i])));
+      }
+    }
+    CHECK(rounded[2] == 1.0);
+    // Rounding is idempotent
+    std::vector<T> rounded_twice = rounded;
+    h5::round_mantissa(gsl::make_span(rounded_twice), max_relative_error);
+    for (size_t i = 7; i < data.size(); ++i) {
+      CHECK(rounded_twice[i] == rounded[i]);
+    }
+  }
+  // Bounds tighter than the precision of `T` leave the data unchanged
+  std::vector<T> unchanged = data;
+  h5::round_mantissa(gsl::make_span(unchanged), 1.0e-30);
+  for (size_t i = 7; i < data.size(); ++i) {
+    CHECK(unchanged[i] == data[i]);
+  }
+}
+
+void test_volume_data() {
+  const std::string h5_file_name{"Unit.IO.H5.Compression.VolumeData.h5"};
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const DataVector data{1.0 / 3.0, 2.0 / 3.0, 1.0 / 7.0, 100.0 / 7.0};
+  const std::vector<float> float_data{1.0f / 3.0f, 2.0f / 3.0f, 1.0f / 7.0f,
+                                      100.0f / 7.0f};
+  const double max_relative_error = 1.0e-4;
+  h5::Compression compression{};
+  compression.chunk_bytes = 16;
+  compression.deflate_level = 9;
+  compression.max_relative_error = max_relative_error;
+  {
+    h5::H5File<h5::AccessType::ReadWrite> h5_file{h5_file_name};
+    auto& volume_file = h5_file.insert<h5::VolumeData>("/element_data", 0);
+    volume_file.write_volume_data(
+        0, 1.0,
+        {ElementVolumeData{
+            "[B0,(L0I0,L0I0)]",
+            {TensorComponent{"U", data}, TensorComponent{"V", float_data}},
+            {2, 2},
+            std::vector<Spectral::Basis>(2, Spectral::Basis::Legendre),
+            std::vector<Spectral::Quadrature>(
+                2, Spectral::Quadrature::GaussLobatto)}},
+        std::nullopt, std::nullopt, compression);
+    volume_file.write_tensor_component(0, "W", data, false, compression);
+  }
+  const h5::H5File<h5::AccessType::ReadOnly> h5_file{h5_file_name};
+  const auto& volume_file = h5_file.get<h5::VolumeData>("/element_data");
+  const auto check_component = [&volume_file, &max_relative_error](
+                                   const std::string& name,
+                                   const auto& expected_data) {
+    using DataType = std::decay_t<decltype(expected_data)>;
+    const auto read_data =
+        std::get<DataType>(volume_file.get_tensor_component(0, name).data);
+    REQUIRE(read_data.size() == expected_data.size());
+    bool any_rounded = false;
+    for (size_t i = 0; i < read_data.size(); ++i) {
+      CHECK(std::abs(read_data[i] - expected_data[i]) <=
+            max_relative_error * std::abs(expected_data[i]));
+      any_rounded = any_rounded or read_data[i] != expected_data[i];
+    }
+    CHECK(any_rounded);
+  };
+  check_component("U", data);
+  check_component("V", float_data);
+  check_component("W", data);
+  // Reading by element works unchanged
+  const auto data_by_element =
+      volume_file.get_data_by_element(std::nullopt, std::nullopt, std::nullopt);
+  REQUIRE(data_by_element.size() == 1);
+  CHECK(std::get<2>(data_by_element[0]).size() == 1);
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.H5.Compression", "[Unit][IO][H5]") {
+  MAKE_GENERATOR(generator);
+  test_round_mantissa<float>(make_not_null(&generator));
+  test_round_mantissa<double>(make_not_null(&generator));
+  test_volume_data();
+  test_serialization(h5::Compression{});
+  test_serialization(h5::Compression{65'536, 9, false, 1.0e-4});
+  CHECK(h5::Compression{} != h5::Compression::none());
+}
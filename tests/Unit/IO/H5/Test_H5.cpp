@@ -20,6 +20,7 @@
 #include "DataStructures/Matrix.hpp"
 #include "IO/H5/AccessType.hpp"
 #include "IO/H5/CheckH5.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/H5/Dat.hpp"
 #include "IO/H5/File.hpp"
 #include "IO/H5/Header.hpp"
@@ -167,6 +168,89 @@ void test_read_data() {
   }
 }
 
+// Check that datasets are chunked and filtered as requested and read back
+// unchanged
+void test_compression() {
+  const std::string h5_file_name("Unit.IO.H5.Compression.h5");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+  const hid_t file_id = H5Fcreate(h5_file_name.c_str(), h5::h5f_acc_trunc(),
+                                  h5::h5p_default(), h5::h5p_default());
+  h5::detail::OpenGroup my_group(file_id, "Compression",
+                                 h5::AccessType::ReadWrite);
+  const hid_t group_id = my_group.id();
+
+  const auto check_layout = [&group_id](const std::string& dataset_name,
+                                        const H5D_layout_t expected_layout,
+                                        const int expected_number_of_filters,
+                                        const hsize_t expected_chunk_size) {
+    const hid_t dataset_id =
+        H5Dopen2(group_id, dataset_name.c_str(), h5::h5p_default());
+    CHECK_H5(dataset_id, "Failed to open dataset " << dataset_name);
+    const hid_t property_list = H5Dget_create_plist(dataset_id);
+    CHECK_H5(property_list, "Failed to get property list");
+    CHECK(H5Pget_layout(property_list) == expected_layout);
+    CHECK(H5Pget_nfilters(property_list) == expected_number_of_filters);
+    if (expected_layout == H5D_CHUNKED) {
+      hsize_t chunk_size = 0;
+      CHECK(H5Pget_chunk(property_list, 1, &chunk_size) == 1);
+      CHECK(chunk_size == expected_chunk_size);
+    }
+    CHECK_H5(H5Pclose(property_list), "Failed to close property list");
+    CHECK_H5(H5Dclose(dataset_id), "Failed to close dataset");
+  };
+
+  DataVector data(100);
+  for (size_t i = 0; i < data.size(); ++i) {
+    data[i] = 1.0 / static_cast<double>(i + 1);
+  }
+  const std::vector<double> vector_data(data.begin(), data.end());
+
+  // Defaults: vectors are compressed, DataVectors are contiguous
+  h5::write_data(group_id, vector_data, {vector_data.size()}, "default_vector");
+  check_layout("default_vector", H5D_CHUNKED, 2, 100);
+  h5::write_data(group_id, data, "default_datavector");
+  check_layout("default_datavector", H5D_CONTIGUOUS, 0, 0);
+
+  h5::write_data(group_id, vector_data, {vector_data.size()}, "none", false,
+                 h5::Compression::none());
+  check_layout("none", H5D_CONTIGUOUS, 0, 0);
+  CHECK(h5::read_data<1, std::vector<double>>(group_id, "none") ==
+        vector_data);
+
+  h5::Compression deflate_only{};
+  deflate_only.shuffle = false;
+  deflate_only.deflate_level = 9;
+  deflate_only.chunk_bytes = 128;
+  h5::write_data(group_id, data, "deflate_only", false, deflate_only);
+  check_layout("deflate_only", H5D_CHUNKED, 1, 16);
+  CHECK(h5::read_data<1, DataVector>(group_id, "deflate_only") == data);
+
+  h5::Compression shuffle_only{};
+  shuffle_only.deflate_level = 0;
+  shuffle_only.chunk_bytes = 64;
+  h5::write_data(group_id, std::vector<float>(vector_data.begin(),
+                                              vector_data.end()),
+                 {vector_data.size()}, "shuffle_only", false, shuffle_only);
+  check_layout("shuffle_only", H5D_CHUNKED, 1, 16);
+  CHECK(h5::read_data<1, std::vector<float>>(group_id, "shuffle_only") ==
+        std::vector<float>(vector_data.begin(), vector_data.end()));
+
+  // The error bound is ignored by `write_data`
+  h5::Compression rounded{};
+  rounded.max_relative_error = 1.0e-3;
+  h5::write_data(group_id, vector_data, {vector_data.size()}, "rounded", false,
+                 rounded);
+  CHECK(h5::read_data<1, std::vector<double>>(group_id, "rounded") ==
+        vector_data);
+
+  CHECK_H5(H5Fclose(file_id), "Failed to close file: '" << h5_file_name << "'");
+  if (file_system::check_if_file_exists(h5_file_name)) {
+    file_system::rm(h5_file_name, true);
+  }
+}
+
 // Check that we can insert and open subfiles at the '/' level
 void test_check_if_object_exists() {
   const std::string h5_file_name("Unit.IO.H5.check_if_object_exists.h5");
@@ -281,6 +365,7 @@ void test_list_files() {
 SPECTRE_TEST_CASE("Unit.IO.H5", "[Unit][IO][H5]") {
   test_types_equal();
   test_read_data();
+  test_compression();
   test_check_if_object_exists();
   test_contains_attribute_false();
   test_errors();
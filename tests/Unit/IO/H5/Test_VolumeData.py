@@ -45,6 +45,36 @@ class TestVolumeDataWriting(unittest.TestCase):
         vol_file = self.h5_file.get_vol(path="/element_data")
         self.assertEqual(vol_file.get_header()[0:20], "#\n# File created on ")
 
+    # Test that compressed and rounded data is read back transparently
+    def test_write_compressed(self):
+        self.h5_file.insert_vol(path="/element_data", version=0)
+        self.h5_file.close_current_object()
+        vol_file = self.h5_file.get_vol(path="/element_data")
+        data = np.random.rand(8) + 1.0
+        vol_file.write_volume_data(
+            0,
+            1.5,
+            [
+                ElementVolumeData(
+                    element_name="[B0(L0I0,L0I0,L0I0)]",
+                    components=[TensorComponent("field", DataVector(data))],
+                    extents=3 * [2],
+                    basis=3 * [Basis.Legendre],
+                    quadrature=3 * [Quadrature.Gauss],
+                )
+            ],
+            compression=spectre_h5.Compression(
+                chunk_bytes=32, deflate_level=9, max_relative_error=1.0e-4
+            ),
+        )
+        read_data = np.asarray(
+            vol_file.get_tensor_component(
+                observation_id=0, tensor_component="field"
+            ).data
+        )
+        npt.assert_allclose(read_data, data, rtol=1.0e-4, atol=0.0)
+        self.assertFalse(np.array_equal(read_data, data))
+
 
 class TestVolumeData(unittest.TestCase):
     # Test Fixtures
@@ -0,0 +1,183 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <algorithm>
+#include <cstddef>
+#include <mutex>
+#include <optional>
+#include <string>
+#include <utility>
+#include <variant>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataVector.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/H5/AccessType.hpp"
+#include "IO/H5/File.hpp"
+#include "IO/H5/TensorData.hpp"
+#include "IO/H5/VolumeData.hpp"
+#include "IO/Observer/Actions/FlushVolumeData.hpp"
+#include "IO/Observer/AsyncVolumeWriter.hpp"
+#include "IO/Observer/Initialize.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/Tags.hpp"
+#include "NumericalAlgorithms/Spectral/Basis.hpp"
+#include "NumericalAlgorithms/Spectral/Quadrature.hpp"
+#include "Parallel/NodeLock.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/FileSystem.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+std::vector<ElementVolumeData> volume_data(const double observation_value) {
+  std::vector<ElementVolumeData> result{};
+  for (size_t i = 0; i < 3; ++i) {
+    result.emplace_back(
+        "Element" + std::to_string(i),
+        std::vector<TensorComponent>{
+            {"InertialCoordinates_x", DataVector{0.0, 1.0, 0.0, 1.0}},
+            {"InertialCoordinates_y", DataVector{0.0, 0.0, 1.0, 1.0}},
+            {"Psi", DataVector(4, observation_value + static_cast<double>(i))}},
+        std::vector<size_t>{2, 2},
+        std::vector<Spectral::Basis>(2, Spectral::Basis::Legendre),
+        std::vector<Spectral::Quadrature>(2,
+                                          Spectral::Quadrature::GaussLobatto));
+  }
+  return result;
+}
+
+void check_file(const std::string& file_name, const size_t num_observations) {
+  const h5::H5File<h5::AccessType::ReadOnly> h5_file{file_name};
+  const auto& volume_file = h5_file.get<h5::VolumeData>("/element_data");
+  CHECK(volume_file.list_observation_ids().size() == num_observations);
+  for (size_t id = 0; id < num_observations; ++id) {
+    const double observation_value = 0.5 * static_cast<double>(id);
+    CHECK(volume_file.get_observation_value(id) == observation_value);
+    const DataVector psi = std::get<DataVector>(
+        volume_file.get_tensor_component(id, "Psi").data);
+    DataVector expected_psi(12);
+    for (size_t i = 0; i < 3; ++i) {
+      for (size_t j = 0; j < 4; ++j) {
+        expected_psi[4 * i + j] = observation_value + static_cast<double>(i);
+      }
+    }
+    CHECK(psi == expected_psi);
+  }
+}
+
+template <typename Metavariables>
+struct MockObserverWriter {
+  using chare_type = ActionTesting::MockNodeGroupChare;
+  using component_being_mocked = observers::ObserverWriter<Metavariables>;
+  using metavariables = Metavariables;
+  using array_index = size_t;
+  using simple_tags =
+      typename observers::Actions::InitializeWriter<Metavariables>::simple_tags;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<observers::Actions::InitializeWriter<Metavariables>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<MockObserverWriter<Metavariables>>;
+  using observed_reduction_data_tags = tmpl::list<>;
+};
+
+void test_flush_volume_data() {
+  const std::string file_name{"Unit.IO.Observers.FlushVolumeData.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  using writer_component = MockObserverWriter<Metavariables>;
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_nodegroup_component<writer_component>(
+      make_not_null(&runner));
+  ActionTesting::next_action<writer_component>(make_not_null(&runner), 0);
+  auto& writer = db::get_mutable_reference<observers::Tags::AsyncVolumeWriter>(
+      make_not_null(&ActionTesting::get_databox<writer_component>(
+          make_not_null(&runner), 0)));
+
+  Parallel::NodeLock h5_file_lock{};
+  {
+    // Holding the lock keeps the background thread from writing anything
+    // until the data is flushed
+    const std::lock_guard hold_lock(h5_file_lock);
+    for (size_t id = 0; id < 2; ++id) {
+      const double observation_value = 0.5 * static_cast<double>(id);
+      writer.stage(
+          observers::AsyncVolumeWriter::Observation{
+              file_name, "", "/element_data", id, observation_value,
+              volume_data(observation_value), std::nullopt, std::nullopt},
+          make_not_null(&h5_file_lock), 1000000);
+    }
+    CHECK(writer.staged_bytes() == 2 * 3 * 3 * 4 * sizeof(double));
+  }
+  // The writer is still alive, so the data is only on disk if it was flushed
+  ActionTesting::threaded_action<writer_component,
+                                 observers::ThreadedActions::FlushVolumeData>(
+      make_not_null(&runner), 0);
+  CHECK(writer.staged_bytes() == 0);
+  check_file(file_name, 2);
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.IO.Observers.AsyncVolumeWriter", "[Unit][Observers]") {
+  const std::string file_name{"Unit.IO.Observers.AsyncVolumeWriter.h5"};
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+  Parallel::NodeLock h5_file_lock{};
+  const size_t num_observations = 10;
+  const auto stage_observations =
+      [&file_name, &h5_file_lock](
+          const gsl::not_null<observers::AsyncVolumeWriter*> writer,
+          const size_t first_id, const size_t last_id,
+          const size_t max_staged_bytes) {
+        for (size_t id = first_id; id < last_id; ++id) {
+          const double observation_value = 0.5 * static_cast<double>(id);
+          writer->stage(
+              observers::AsyncVolumeWriter::Observation{
+                  file_name, "", "/element_data", id, observation_value,
+                  volume_data(observation_value), std::nullopt, std::nullopt},
+              make_not_null(&h5_file_lock), max_staged_bytes);
+          CHECK(writer->staged_bytes() <=
+                std::max(max_staged_bytes, 3 * 3 * 4 * sizeof(double)));
+        }
+      };
+  {
+    // A limit below the size of a single observation, so every call to `stage`
+    // waits for the previous observation to be written
+    observers::AsyncVolumeWriter writer{};
+    CHECK(writer.staged_bytes() == 0);
+    stage_observations(make_not_null(&writer), 0, num_observations / 2, 8);
+    writer.wait();
+    CHECK(writer.staged_bytes() == 0);
+    check_file(file_name, num_observations / 2);
+
+    // Serializing waits for the staged data to be written, and the
+    // deserialized writer starts a new thread
+    stage_observations(make_not_null(&writer), num_observations / 2,
+                       num_observations - 1, 1000000);
+    auto deserialized_writer = serialize_and_deserialize(writer);
+    CHECK(writer.staged_bytes() == 0);
+    check_file(file_name, num_observations - 1);
+    // The destructor writes the remaining data
+    stage_observations(make_not_null(&deserialized_writer),
+                       num_observations - 1, num_observations, 1000000);
+  }
+  check_file(file_name, num_observations);
+  if (file_system::check_if_file_exists(file_name)) {
+    file_system::rm(file_name, true);
+  }
+
+  test_flush_volume_data();
+}
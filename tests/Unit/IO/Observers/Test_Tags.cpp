@@ -3,9 +3,11 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <optional>
 #include <string>
 
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "IO/H5/Compression.hpp"
 #include "IO/Observer/Tags.hpp"
 #include "Utilities/TypeTraits.hpp"
 
@@ -33,11 +35,26 @@ SPECTRE_TEST_CASE("Unit.IO.Observers.Tags", "[Unit][Observers]") {
   TestHelpers::db::test_simple_tag<ReductionDataNames<double>>(
       "ReductionDataNames");
   TestHelpers::db::test_simple_tag<H5FileLock>("H5FileLock");
+  TestHelpers::db::test_simple_tag<AsyncVolumeWriter>("AsyncVolumeWriter");
   TestHelpers::db::test_simple_tag<ObservationKey<TestTag>>(
       "ObservationKey(TestTag)");
   TestHelpers::db::test_simple_tag<VolumeFileName>("VolumeFileName");
   TestHelpers::db::test_simple_tag<ReductionFileName>("ReductionFileName");
   TestHelpers::db::test_simple_tag<SurfaceFileName>("SurfaceFileName");
+  TestHelpers::db::test_simple_tag<VolumeDataStagingLimit>(
+      "VolumeDataStagingLimit");
+  TestHelpers::db::test_simple_tag<VolumeDataCompression>(
+      "VolumeDataCompression");
+  {
+    const auto compression =
+        VolumeDataCompression::create_from_options(9, false, 1.0e-6);
+    CHECK(compression.chunk_bytes == h5::Compression{}.chunk_bytes);
+    CHECK(compression.deflate_level == 9);
+    CHECK_FALSE(compression.shuffle);
+    CHECK(compression.max_relative_error == std::optional{1.0e-6});
+    CHECK(VolumeDataCompression::create_from_options(5, true, std::nullopt) ==
+          h5::Compression{});
+  }
   static_assert(
       std::is_same_v<typename ReductionData<double, int, char>::names_tag,
                      ReductionDataNames<double, int, char>>,
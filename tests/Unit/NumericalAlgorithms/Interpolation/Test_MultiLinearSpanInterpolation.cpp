@@ -3,6 +3,7 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <array>
 #include <cstddef>
 
 #include "DataStructures/DataVector.hpp"
@@ -137,6 +138,48 @@ void test() {
     CHECK(std::abs(y_expected[nv] - y_interpolated_gen[nv]) <
           1.e-12 * std::abs(y_expected[nv]));
   }
+
+  // Interpolate the first and last variables to many points at once, with a
+  // number of points that spans several batches and isn't a multiple of the
+  // SIMD width
+  const size_t num_target_points =
+      2 * intrp::UniformMultiLinearSpanInterpolation<Dim, NumVar>::batch_size +
+      3;
+  std::array<DataVector, Dim> target_points{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(target_points, d) = DataVector{num_target_points};
+    for (size_t s = 0; s < num_target_points; ++s) {
+      gsl::at(target_points, d)[s] = dist_func(gen);
+    }
+  }
+  std::array<gsl::span<const double>, Dim> target_points_view{};
+  for (size_t d = 0; d < Dim; ++d) {
+    gsl::at(target_points_view, d) = gsl::span<const double>{
+        gsl::at(target_points, d).data(), num_target_points};
+  }
+  std::array<DataVector, 2> batched_uniform{
+      {DataVector{num_target_points}, DataVector{num_target_points}}};
+  std::array<DataVector, 2> batched_general{
+      {DataVector{num_target_points}, DataVector{num_target_points}}};
+  uniform_intp.template interpolate<0, NumVar - 1>(
+      {{gsl::span<double>{batched_uniform[0].data(), num_target_points},
+        gsl::span<double>{batched_uniform[1].data(), num_target_points}}},
+      target_points_view);
+  general_intp.template interpolate<0, NumVar - 1>(
+      {{gsl::span<double>{batched_general[0].data(), num_target_points},
+        gsl::span<double>{batched_general[1].data(), num_target_points}}},
+      target_points_view);
+  Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+  for (size_t s = 0; s < num_target_points; ++s) {
+    for (size_t d = 0; d < Dim; ++d) {
+      gsl::at(x, d) = gsl::at(target_points, d)[s];
+    }
+    const auto expected = f(x);
+    CHECK(batched_uniform[0][s] == custom_approx(expected[0]));
+    CHECK(batched_uniform[1][s] == custom_approx(expected[NumVar - 1]));
+    CHECK(batched_general[0][s] == custom_approx(expected[0]));
+    CHECK(batched_general[1][s] == custom_approx(expected[NumVar - 1]));
+  }
 }
 }  // namespace
 
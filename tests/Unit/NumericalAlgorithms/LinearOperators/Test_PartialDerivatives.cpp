@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <memory>
 #include <pup.h>
+#include <random>
 #include <string>
 #include <type_traits>
 
@@ -28,7 +29,9 @@
 #include "Domain/CoordinateMaps/ProductMaps.hpp"
 #include "Domain/CoordinateMaps/ProductMaps.tpp"
 #include "Domain/Tags.hpp"
+#include "Framework/TestHelpers.hpp"
 #include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Helpers/DataStructures/MakeWithRandomValues.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.hpp"
 #include "NumericalAlgorithms/LinearOperators/PartialDerivatives.tpp"
 #include "NumericalAlgorithms/Spectral/Basis.hpp"
@@ -490,6 +493,51 @@ void test_partial_derivatives_3d(const Mesh<3>& mesh) {
     }
   }
 }
+
+// Check that all `LogicalDerivativeAlgorithm`s agree. The other functions
+// always use `LogicalDerivativeAlgorithm::Automatic`, so they cover both
+// algorithms depending on the mesh size.
+template <size_t Dim>
+void test_logical_derivative_algorithms(const Mesh<Dim>& mesh) {
+  CAPTURE(mesh);
+  MAKE_GENERATOR(gen);
+  std::uniform_real_distribution<> dist(-1.0, 1.0);
+  const auto u = make_with_random_values<Variables<two_vars<Dim>>>(
+      make_not_null(&gen), make_not_null(&dist), mesh.number_of_grid_points());
+  const auto inv_jacobian =
+      make_with_random_values<InverseJacobian<DataVector, Dim,
+                                              Frame::ElementLogical,
+                                              Frame::Inertial>>(
+          make_not_null(&gen), make_not_null(&dist),
+          mesh.number_of_grid_points());
+  const auto expected_logical_du = logical_partial_derivatives<two_vars<Dim>>(
+      u, mesh, LogicalDerivativeAlgorithm::Blas);
+  for (const auto algorithm : {LogicalDerivativeAlgorithm::FixedSize,
+                               LogicalDerivativeAlgorithm::Automatic}) {
+    const auto logical_du =
+        logical_partial_derivatives<two_vars<Dim>>(u, mesh, algorithm);
+    for (size_t d = 0; d < Dim; ++d) {
+      CHECK_VARIABLES_APPROX(gsl::at(logical_du, d),
+                             gsl::at(expected_logical_du, d));
+    }
+  }
+
+  const auto du = partial_derivatives<two_vars<Dim>>(u, mesh, inv_jacobian);
+  std::decay_t<decltype(du)> expected_du{mesh.number_of_grid_points()};
+  partial_derivatives(make_not_null(&expected_du), expected_logical_du,
+                      inv_jacobian);
+  CHECK_VARIABLES_APPROX(du, expected_du);
+
+  const auto tensor_logical_du =
+      logical_partial_derivative(get<Var1<Dim>>(u), mesh);
+  for (size_t d = 0; d < Dim; ++d) {
+    for (size_t i = 0; i < Dim; ++i) {
+      CHECK_ITERABLE_APPROX(
+          tensor_logical_du.get(d, i),
+          get<Var1<Dim>>(gsl::at(expected_logical_du, d)).get(i));
+    }
+  }
+}
 }  // namespace
 
 // [[Timeout, 20]]
@@ -524,6 +572,22 @@ SPECTRE_TEST_CASE("Unit.Numerical.LinearOperators.LogicalDerivs",
       }
     }
   }
+
+  test_logical_derivative_algorithms(Mesh<1>{
+      5, Spectral::Basis::Legendre, Spectral::Quadrature::GaussLobatto});
+  test_logical_derivative_algorithms(Mesh<2>{
+      {{3, 12}}, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+  test_logical_derivative_algorithms(Mesh<3>{
+      {{4, 6, 5}}, Spectral::Basis::Legendre, Spectral::Quadrature::Gauss});
+  test_logical_derivative_algorithms(
+      Mesh<3>{{{9, 10, 12}},
+              Spectral::Basis::Chebyshev,
+              Spectral::Quadrature::GaussLobatto});
+  // Falls back to BLAS for extents without a fixed-size kernel
+  test_logical_derivative_algorithms(
+      Mesh<3>{{{4, 13, 3}},
+              Spectral::Basis::Legendre,
+              Spectral::Quadrature::GaussLobatto});
 }
 
 // [[Timeout, 20]]
@@ -0,0 +1,190 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/ExitCode.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseControl/PhaseChange.hpp"
+#include "Parallel/PhaseControl/PhaseControlTags.hpp"
+#include "Parallel/PhaseControl/RebalanceElements.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/ResourceInfo.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/LogicalTriggers.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Trigger.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel::Algorithms {
+struct Array;
+struct Group;
+}  // namespace Parallel::Algorithms
+
+namespace {
+struct InitializeTimings {
+  using simple_tags_from_options = tmpl::list<Parallel::Tags::ActionTimings>;
+};
+
+struct InitializeOther {};
+
+template <typename ChareType, typename InitializationAction>
+struct Component {
+  using chare_type = ChareType;
+  using phase_dependent_action_list =
+      tmpl::list<Parallel::PhaseActions<Parallel::Phase::Initialization,
+                                        tmpl::list<InitializationAction>>>;
+};
+
+using timed_array = Component<Parallel::Algorithms::Array, InitializeTimings>;
+using untimed_array = Component<Parallel::Algorithms::Array, InitializeOther>;
+using timed_group = Component<Parallel::Algorithms::Group, InitializeTimings>;
+
+struct ComponentMetavariables {
+  using component_list = tmpl::list<timed_array, untimed_array, timed_group>;
+};
+
+static_assert(
+    std::is_same_v<PhaseControl::RebalanceElements::participating_components<
+                       ComponentMetavariables>,
+                   tmpl::list<timed_array>>);
+
+struct Metavariables {
+  using component_list = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<
+        tmpl::pair<PhaseChange, tmpl::list<PhaseControl::RebalanceElements>>,
+        tmpl::pair<Trigger, tmpl::list<Triggers::Always>>>;
+  };
+};
+
+using PhaseChangeDecisionData = tuples::tagged_tuple_from_typelist<
+    PhaseControl::get_phase_change_tags<Metavariables>>;
+
+PhaseChangeDecisionData decision_data(
+    std::map<size_t, double> cost_per_proc,
+    const std::optional<Parallel::Phase> return_phase) {
+  return {std::move(cost_per_proc), return_phase, true,
+          Parallel::ExitCode::Complete};
+}
+
+void test_combine() {
+  PhaseControl::Tags::MeasuredCostPerProc::combine_method combine{};
+  CHECK(combine({{0, 1.0}, {1, 2.0}}, {{1, 0.5}, {2, 3.0}}) ==
+        std::map<size_t, double>{{0, 1.0}, {1, 2.5}, {2, 3.0}});
+  CHECK(combine({{0, 1.0}, {2, 3.0}}, {{0, 0.5}}) ==
+        std::map<size_t, double>{{0, 1.5}, {2, 3.0}});
+  CHECK(combine({}, {}).empty());
+}
+
+void test_arbitration(const PhaseChange& phase_change) {
+  // Four processors, of which the first is not available for elements
+  Parallel::GlobalCache<Metavariables> cache{{}, {}, {4}};
+  Parallel::ResourceInfo<Metavariables> resource_info{true};
+  resource_info.build_singleton_map(cache);
+  cache.set_resource_info(resource_info);
+  {
+    INFO("Initialize phase change decision data");
+    auto data =
+        decision_data({{1, 1.0}, {2, 2.0}}, Parallel::Phase::Execute);
+    phase_change.initialize_phase_data<Metavariables>(make_not_null(&data));
+    // extra parens in the check prevent Catch from trying to stream the tuple
+    CHECK((data == decision_data({}, std::nullopt)));
+  }
+  {
+    INFO("Balanced");
+    auto data =
+        decision_data({{1, 2.0}, {2, 2.5}, {3, 1.5}}, std::nullopt);
+    const auto decision_result = phase_change.arbitrate_phase_change(
+        make_not_null(&data), Parallel::Phase::Evolve, cache);
+    CHECK((decision_result == std::nullopt));
+    CHECK((data == decision_data({}, std::nullopt)));
+  }
+  {
+    INFO("No measured costs");
+    auto data = decision_data({{1, 0.0}, {2, 0.0}}, std::nullopt);
+    const auto decision_result = phase_change.arbitrate_phase_change(
+        make_not_null(&data), Parallel::Phase::Evolve, cache);
+    CHECK((decision_result == std::nullopt));
+    CHECK((data == decision_data({}, std::nullopt)));
+  }
+  {
+    INFO("Imbalanced");
+    auto data =
+        decision_data({{1, 1.0}, {2, 4.0}, {3, 1.0}}, std::nullopt);
+    const auto decision_result = phase_change.arbitrate_phase_change(
+        make_not_null(&data), Parallel::Phase::Evolve, cache);
+    CHECK((decision_result ==
+           std::make_pair(
+               Parallel::Phase::LoadBalancing,
+               PhaseControl::ArbitrationStrategy::RunPhaseImmediately)));
+    CHECK((data == decision_data({}, Parallel::Phase::Evolve)));
+  }
+  {
+    INFO("Imbalanced because processors have no elements");
+    // All elements are on one processor, so the other available processors
+    // have no cost
+    auto data = decision_data({{1, 3.0}}, std::nullopt);
+    const auto decision_result = phase_change.arbitrate_phase_change(
+        make_not_null(&data), Parallel::Phase::Evolve, cache);
+    CHECK((decision_result ==
+           std::make_pair(
+               Parallel::Phase::LoadBalancing,
+               PhaseControl::ArbitrationStrategy::RunPhaseImmediately)));
+    CHECK((data == decision_data({}, Parallel::Phase::Evolve)));
+  }
+  {
+    INFO("Return after rebalancing");
+    auto data = decision_data({}, Parallel::Phase::Evolve);
+    const auto decision_result = phase_change.arbitrate_phase_change(
+        make_not_null(&data), Parallel::Phase::LoadBalancing, cache);
+    CHECK((decision_result ==
+           std::make_pair(
+               Parallel::Phase::Evolve,
+               PhaseControl::ArbitrationStrategy::PermitAdditionalJumps)));
+    CHECK((data == decision_data({}, std::nullopt)));
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.PhaseControl.RebalanceElements",
+                  "[Unit][Parallel]") {
+  // note that the `contribute_phase_data_impl` function is untested in this
+  // unit test, because we do not have good support for reductions in the
+  // action testing framework.
+  register_factory_classes_with_charm<Metavariables>();
+
+  test_combine();
+
+  // Maximum over mean cost is 1.25 for the balanced case and 2 and 3 for the
+  // imbalanced cases
+  const PhaseControl::RebalanceElements phase_change{1.6};
+  test_arbitration(phase_change);
+  test_arbitration(*serialize_and_deserialize(std::unique_ptr<PhaseChange>(
+      std::make_unique<PhaseControl::RebalanceElements>(1.6))));
+
+  const auto created_phase_changes = TestHelpers::test_option_tag<
+      PhaseControl::OptionTags::PhaseChangeAndTriggers, Metavariables>(
+      " - Trigger: Always\n"
+      "   PhaseChanges:\n"
+      "     - RebalanceElements:\n"
+      "         MaxImbalance: 1.6");
+  REQUIRE(created_phase_changes.size() == 1);
+  REQUIRE(created_phase_changes[0].phase_changes.size() == 1);
+  test_arbitration(*created_phase_changes[0].phase_changes[0]);
+}
@@ -0,0 +1,127 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "Helpers/DataStructures/DataBox/TestHelpers.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+struct FirstAction {};
+struct SecondAction {};
+struct NamedAction {
+  static std::string name() { return "Named"; }
+};
+
+using phase_dependent_action_list = tmpl::list<
+    Parallel::PhaseActions<Parallel::Phase::Initialization,
+                           tmpl::list<FirstAction, SecondAction>>,
+    Parallel::PhaseActions<Parallel::Phase::Evolve,
+                           tmpl::list<NamedAction, FirstAction, SecondAction>>>;
+
+void test_index_and_names() {
+  static_assert(Parallel::action_timing_index(phase_dependent_action_list{}, 0,
+                                              0) == 0);
+  static_assert(Parallel::action_timing_index(phase_dependent_action_list{}, 0,
+                                              1) == 1);
+  static_assert(Parallel::action_timing_index(phase_dependent_action_list{}, 1,
+                                              0) == 2);
+  static_assert(Parallel::action_timing_index(phase_dependent_action_list{}, 1,
+                                              2) == 4);
+  CHECK(Parallel::action_timing_names<phase_dependent_action_list>() ==
+        std::vector<std::string>{
+            "Initialization/0:FirstAction", "Initialization/1:SecondAction",
+            "Evolve/0:Named", "Evolve/1:FirstAction", "Evolve/2:SecondAction"});
+}
+
+void test_timings() {
+  Parallel::ActionTimings timings{true};
+  CHECK(timings.enabled());
+  CHECK_FALSE(Parallel::ActionTimings{false}.enabled());
+  CHECK_FALSE(Parallel::ActionTimings{}.enabled());
+  CHECK(timings.number_of_actions() == 0);
+
+  timings.set_action_names({"A", "B"});
+  CHECK(timings.number_of_actions() == 2);
+  CHECK(timings.action_names() == std::vector<std::string>{"A", "B"});
+  CHECK(timings.seconds() == std::vector<double>{0.0, 0.0});
+  CHECK(timings.calls() == std::vector<size_t>{0, 0});
+
+  timings.record(1, 0.5);
+  timings.record(1, 0.25);
+  timings.record(0, 2.0);
+  CHECK(timings.seconds() == std::vector<double>{2.0, 0.75});
+  CHECK(timings.calls() == std::vector<size_t>{1, 2});
+  CHECK(timings.measured_cost() == 2.75);
+  CHECK(timings != Parallel::ActionTimings{true});
+  test_serialization(timings);
+
+  // Resetting the measured cost keeps the accumulated timings
+  auto reset_timings = timings;
+  reset_timings.reset_measured_cost();
+  CHECK(reset_timings.measured_cost() == 0.0);
+  CHECK(reset_timings.seconds() == timings.seconds());
+  CHECK(reset_timings != timings);
+  reset_timings.record(0, 0.5);
+  CHECK(reset_timings.measured_cost() == 0.5);
+
+  // Setting the names resets the timings
+  timings.set_action_names({"A", "B", "C"});
+  CHECK(timings.seconds() == std::vector<double>{0.0, 0.0, 0.0});
+  CHECK(timings.calls() == std::vector<size_t>{0, 0, 0});
+  CHECK(timings.measured_cost() == 0.0);
+}
+
+void test_invoke_and_time_action(const bool enabled) {
+  auto box = db::create<tmpl::list<Parallel::Tags::ActionTimings>>(
+      Parallel::ActionTimings{enabled});
+  size_t number_of_invocations = 0;
+  const auto invoke_action = [&number_of_invocations]() {
+    ++number_of_invocations;
+  };
+  Parallel::invoke_and_time_action<phase_dependent_action_list, 1, 2>(
+      make_not_null(&box), invoke_action);
+  Parallel::invoke_and_time_action<phase_dependent_action_list, 1, 2>(
+      make_not_null(&box), invoke_action);
+  Parallel::invoke_and_time_action<phase_dependent_action_list, 0, 0>(
+      make_not_null(&box), invoke_action);
+  CHECK(number_of_invocations == 3);
+
+  const auto& timings = db::get<Parallel::Tags::ActionTimings>(box);
+  if (enabled) {
+    CHECK(timings.action_names() ==
+          Parallel::action_timing_names<phase_dependent_action_list>());
+    CHECK(timings.calls() == std::vector<size_t>{1, 0, 0, 0, 2});
+    CHECK(timings.seconds()[0] >= 0.0);
+    CHECK(timings.seconds()[1] == 0.0);
+    CHECK(timings.seconds()[4] >= 0.0);
+  } else {
+    CHECK(timings.number_of_actions() == 0);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.Parallel.ActionTimings", "[Unit][Parallel]") {
+  test_index_and_names();
+  test_timings();
+  test_invoke_and_time_action(true);
+  test_invoke_and_time_action(false);
+
+  TestHelpers::db::test_simple_tag<Parallel::Tags::ActionTimings>(
+      "ActionTimings");
+  CHECK(TestHelpers::test_option_tag<Parallel::OptionTags::TimeActions>(
+      "true"));
+  CHECK(Parallel::Tags::ActionTimings::create_from_options(true) ==
+        Parallel::ActionTimings{true});
+}
@@ -0,0 +1,146 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <array>
+#include <cstddef>
+#include <map>
+#include <optional>
+#include <pup.h>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "Domain/Structure/ElementId.hpp"
+#include "Domain/Structure/SegmentId.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/GlobalCache.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/ResourceInfo.hpp"
+#include "ParallelAlgorithms/Actions/MigrateElementsByMeasuredCost.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace {
+template <typename Metavariables>
+struct ElementArray {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = ElementId<1>;
+  using const_global_cache_tags = tmpl::list<>;
+  using simple_tags = tmpl::list<Parallel::Tags::ActionTimings>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+template <typename Metavariables>
+struct BalancingSingleton {
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockSingletonChare;
+  using array_index = int;
+  using const_global_cache_tags = tmpl::list<>;
+  using simple_tags = tmpl::list<>;
+  using phase_dependent_action_list = tmpl::list<Parallel::PhaseActions<
+      Parallel::Phase::Initialization,
+      tmpl::list<ActionTesting::InitializeDataBox<simple_tags>>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementArray<Metavariables>,
+                                    BalancingSingleton<Metavariables>>;
+  // NOLINTNEXTLINE(google-runtime-references)
+  void pup(PUP::er& /*p*/) {}
+};
+
+using element_array = ElementArray<Metavariables>;
+using balancing_singleton = BalancingSingleton<Metavariables>;
+using ReceiveCosts =
+    Parallel::Actions::detail::ReceiveMeasuredElementCosts<element_array>;
+
+Parallel::ActionTimings timings_with_cost(const double cost) {
+  Parallel::ActionTimings timings{true};
+  timings.set_action_names({"Action"});
+  timings.record(0, cost);
+  return timings;
+}
+
+void test() {
+  // One element in each of three blocks
+  const std::array element_ids{ElementId<1>{0, std::array{SegmentId{0, 0}}},
+                               ElementId<1>{1, std::array{SegmentId{0, 0}}},
+                               ElementId<1>{2, std::array{SegmentId{0, 0}}}};
+
+  // Four processors, of which the first is not available for elements
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}, {}, {4}};
+  ActionTesting::emplace_component<balancing_singleton>(&runner, 0);
+  for (const auto& element_id : element_ids) {
+    ActionTesting::emplace_component_and_initialize<element_array>(
+        &runner, element_id, {timings_with_cost(2.0)});
+  }
+  auto& cache = ActionTesting::cache<balancing_singleton>(runner, 0);
+  Parallel::ResourceInfo<Metavariables> resource_info{true};
+  resource_info.build_singleton_map(cache);
+  cache.set_resource_info(resource_info);
+  REQUIRE(cache.get_resource_info().procs_to_ignore() ==
+          std::unordered_set<size_t>{0});
+
+  const std::map<ElementId<1>, double> estimated_costs{
+      {element_ids[0], 1.0}, {element_ids[1], 1.0}, {element_ids[2], 1.0}};
+
+  {
+    INFO("Measured cost is reset");
+    for (const auto& element_id : element_ids) {
+      CHECK(Parallel::Actions::detail::take_measured_cost(
+                make_not_null(&ActionTesting::get_databox<element_array>(
+                    make_not_null(&runner), element_id))) == 2.0);
+      const auto& timings = ActionTesting::get_databox_tag<
+          element_array, Parallel::Tags::ActionTimings>(runner, element_id);
+      CHECK(timings.measured_cost() == 0.0);
+      // Only the measured cost is reset, not the recorded timings
+      CHECK(timings.seconds() == std::vector<double>{2.0});
+    }
+  }
+  {
+    INFO("No measured costs");
+    ActionTesting::simple_action<balancing_singleton, ReceiveCosts>(
+        make_not_null(&runner), 0,
+        std::map<ElementId<1>, std::pair<double, size_t>>{
+            {element_ids[0], {0.0, 1}},
+            {element_ids[1], {0.0, 1}},
+            {element_ids[2], {0.0, 1}}},
+        estimated_costs);
+    for (const auto& element_id : element_ids) {
+      CHECK(ActionTesting::migrated_to_proc<element_array>(
+                runner, element_id) == std::nullopt);
+    }
+  }
+  {
+    INFO("Migrate elements");
+    // The elements have equal costs, so each available processor gets one
+    // element. The second element is the only one that has to move.
+    ActionTesting::simple_action<balancing_singleton, ReceiveCosts>(
+        make_not_null(&runner), 0,
+        std::map<ElementId<1>, std::pair<double, size_t>>{
+            {element_ids[0], {2.0, 1}},
+            {element_ids[1], {2.0, 1}},
+            {element_ids[2], {2.0, 3}}},
+        estimated_costs);
+    CHECK(ActionTesting::migrated_to_proc<element_array>(
+              runner, element_ids[0]) == std::nullopt);
+    CHECK(ActionTesting::migrated_to_proc<element_array>(
+              runner, element_ids[1]) == std::optional{2});
+    CHECK(ActionTesting::migrated_to_proc<element_array>(
+              runner, element_ids[2]) == std::nullopt);
+  }
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.MigrateElementsByMeasuredCost",
+                  "[Unit][ParallelAlgorithms]") {
+  test();
+}
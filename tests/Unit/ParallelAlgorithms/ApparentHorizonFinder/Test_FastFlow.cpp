@@ -41,7 +41,8 @@ namespace {
 FastFlow::Status do_iteration(
     const gsl::not_null<ylm::Strahlkorper<Frame::Inertial>*> strahlkorper,
     const gsl::not_null<FastFlow*> flow,
-    const gr::Solutions::KerrSchild& solution) {
+    const gr::Solutions::KerrSchild& solution,
+    FastFlow::IterInfo* const last_iter_info = nullptr) {
   FastFlow::Status status = FastFlow::Status::SuccessfulIteration;
 
   while (status == FastFlow::Status::SuccessfulIteration) {
@@ -80,6 +81,9 @@ FastFlow::Status do_iteration(
             gr::christoffel_first_kind(deriv_spatial_metric),
             inverse_spatial_metric));
     status = status_and_info.first;
+    if (last_iter_info != nullptr) {
+      *last_iter_info = status_and_info.second;
+    }
   }
   return status;
 }
@@ -179,6 +183,49 @@ void test_too_many_iterations_error() {
   CHECK(status == FastFlow::Status::MaxIts);
 }
 
+void test_initial_guess_extrapolation() {
+  FastFlow flow(FastFlow::FlowType::Fast, 1.0, 0.5, 1e-12, 1e-10, 1.2, 5, 100);
+  const gr::Solutions::KerrSchild solution(1.0, {{0., 0., 0.}}, {{0., 0., 0.}});
+  FastFlow::IterInfo info{};
+
+  // Finds that are not warm-started set the baseline
+  ylm::Strahlkorper<Frame::Inertial> strahlkorper(5, 5, 3.0, {{0, 0, 0}});
+  CHECK(converged(do_iteration(&strahlkorper, &flow, solution, &info)));
+  CHECK(info.initial_guess_extrapolation_order == 0);
+  CHECK(info.iterations_saved == 0.0);
+  const auto first_baseline = static_cast<double>(info.iteration);
+
+  // Start closer to the horizon, as a good extrapolation would
+  flow.reset_for_next_find();
+  flow.set_initial_guess_extrapolation_order(2);
+  strahlkorper = ylm::Strahlkorper<Frame::Inertial>(5, 5, 2.01, {{0, 0, 0}});
+  CHECK(converged(do_iteration(&strahlkorper, &flow, solution, &info)));
+  CHECK(info.initial_guess_extrapolation_order == 2);
+  CHECK(info.iterations_saved ==
+        first_baseline - static_cast<double>(info.iteration));
+  CHECK(info.iterations_saved > 0.0);
+  test_serialization(flow);
+
+  // The order is reset for the next find, which adds to the baseline
+  flow.reset_for_next_find();
+  strahlkorper = ylm::Strahlkorper<Frame::Inertial>(5, 5, 2.5, {{0, 0, 0}});
+  CHECK(converged(do_iteration(&strahlkorper, &flow, solution, &info)));
+  CHECK(info.initial_guess_extrapolation_order == 0);
+  CHECK(info.iterations_saved == 0.0);
+  const auto second_baseline = static_cast<double>(info.iteration);
+
+  // The savings are measured against the mean of the baseline finds
+  flow.reset_for_next_find();
+  flow.set_initial_guess_extrapolation_order(1);
+  strahlkorper = ylm::Strahlkorper<Frame::Inertial>(5, 5, 2.01, {{0, 0, 0}});
+  CHECK(converged(do_iteration(&strahlkorper, &flow, solution, &info)));
+  CHECK(info.initial_guess_extrapolation_order == 1);
+  CHECK(info.iterations_saved ==
+        approx(0.5 * (first_baseline + second_baseline) -
+               static_cast<double>(info.iteration)));
+  test_serialization(flow);
+}
+
 void test_schwarzschild(FastFlow::Flow::type type_of_flow,
                         const size_t max_iterations) {
   ylm::Strahlkorper<Frame::Inertial> strahlkorper(5, 5, 3.0, {{0, 0, 0}});
@@ -309,6 +356,7 @@ SPECTRE_TEST_CASE("Unit.ApparentHorizonFinder.FastFlowMisc",
   test_copy_and_move();
   test_serialize();
   test_ostream();
+  test_initial_guess_extrapolation();
 
   CHECK_THROWS_WITH(
       TestHelpers::test_creation<FastFlow>("Flow: Fast\n"
@@ -0,0 +1,261 @@
+// Distributed under the MIT License.
+// See LICENSE.txt for details.
+
+#include "Framework/TestingFramework.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <optional>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "DataStructures/DataBox/DataBox.hpp"
+#include "DataStructures/DataBox/ObservationBox.hpp"
+#include "Framework/ActionTesting.hpp"
+#include "Framework/TestCreation.hpp"
+#include "Framework/TestHelpers.hpp"
+#include "IO/Observer/Actions/RegisterEvents.hpp"
+#include "IO/Observer/ObservationId.hpp"
+#include "IO/Observer/ObserverComponent.hpp"
+#include "IO/Observer/TypeOfObservation.hpp"
+#include "Options/Protocols/FactoryCreation.hpp"
+#include "Parallel/ActionTimings.hpp"
+#include "Parallel/ArrayComponentId.hpp"
+#include "Parallel/Phase.hpp"
+#include "Parallel/PhaseDependentActionList.hpp"
+#include "Parallel/Reduction.hpp"
+#include "Parallel/Tags/Metavariables.hpp"
+#include "ParallelAlgorithms/Events/ObserveActionTimings.hpp"
+#include "ParallelAlgorithms/EventsAndTriggers/Event.hpp"
+#include "Utilities/Gsl.hpp"
+#include "Utilities/ProtocolHelpers.hpp"
+#include "Utilities/Serialization/RegisterDerivedClassesWithCharm.hpp"
+#include "Utilities/TMPL.hpp"
+
+namespace Parallel {
+template <typename Metavariables>
+class GlobalCache;
+}  // namespace Parallel
+namespace observers::Actions {
+struct ContributeReductionData;
+}  // namespace observers::Actions
+
+namespace {
+struct FirstAction {};
+struct SecondAction {};
+
+struct MockContributeReductionData {
+  using ReductionData =
+      tmpl::wrap<tmpl::front<Events::ObserveActionTimings::
+                                 observed_reduction_data_tags>,
+                 Parallel::ReductionData>;
+  struct Results {
+    observers::ObservationId observation_id;
+    std::string subfile_name;
+    std::vector<std::string> reduction_names;
+    ReductionData reduction_data;
+  };
+
+  // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+  static std::optional<Results> results;
+
+  template <typename ParallelComponent, typename... DbTags,
+            typename Metavariables, typename ArrayIndex>
+  static void apply(db::DataBox<tmpl::list<DbTags...>>& /*box*/,
+                    Parallel::GlobalCache<Metavariables>& /*cache*/,
+                    const ArrayIndex& /*array_index*/,
+                    const observers::ObservationId& observation_id,
+                    Parallel::ArrayComponentId /*sender_array_id*/,
+                    const std::string& subfile_name,
+                    const std::vector<std::string>& reduction_names,
+                    ReductionData&& reduction_data) {
+    if (results) {
+      CHECK(results->observation_id == observation_id);
+      CHECK(results->subfile_name == subfile_name);
+      CHECK(results->reduction_names == reduction_names);
+      results->reduction_data.combine(std::move(reduction_data));
+    } else {
+      results.emplace();
+      *results = {observation_id, subfile_name, reduction_names,
+                  std::move(reduction_data)};
+    }
+  }
+};
+
+std::optional<MockContributeReductionData::Results>
+    // NOLINTNEXTLINE(cppcoreguidelines-avoid-non-const-global-variables)
+    MockContributeReductionData::results{};
+
+template <typename Metavariables>
+struct ElementComponent {
+  using component_being_mocked = void;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockArrayChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization,
+                             tmpl::list<FirstAction>>,
+      Parallel::PhaseActions<Parallel::Phase::Evolve,
+                             tmpl::list<FirstAction, SecondAction>>>;
+};
+
+template <typename Metavariables>
+struct MockObserverComponent {
+  using component_being_mocked = observers::Observer<Metavariables>;
+  using replace_these_simple_actions =
+      tmpl::list<observers::Actions::ContributeReductionData>;
+  using with_these_simple_actions = tmpl::list<MockContributeReductionData>;
+
+  using metavariables = Metavariables;
+  using chare_type = ActionTesting::MockGroupChare;
+  using array_index = int;
+  using phase_dependent_action_list = tmpl::list<
+      Parallel::PhaseActions<Parallel::Phase::Initialization, tmpl::list<>>>;
+};
+
+struct Metavariables {
+  using component_list = tmpl::list<ElementComponent<Metavariables>,
+                                    MockObserverComponent<Metavariables>>;
+  using const_global_cache_tags = tmpl::list<>;
+
+  struct factory_creation
+      : tt::ConformsTo<Options::protocols::FactoryCreation> {
+    using factory_classes = tmpl::map<tmpl::pair<
+        Event, tmpl::list<Events::ObserveActionTimings>>>;
+  };
+};
+
+template <typename Observer>
+void test_observe(const Observer& observer, const bool enabled) {
+  using element_component = ElementComponent<Metavariables>;
+  using observer_component = MockObserverComponent<Metavariables>;
+
+  auto& results = MockContributeReductionData::results;
+  results.reset();
+
+  ActionTesting::MockRuntimeSystem<Metavariables> runner{{}};
+  ActionTesting::emplace_group_component<observer_component>(&runner);
+
+  using tag_list = tmpl::list<Parallel::Tags::MetavariablesImpl<Metavariables>,
+                              Parallel::Tags::ActionTimings>;
+  std::vector<db::compute_databox_type<tag_list>> element_boxes;
+
+  const double observation_time = 2.0;
+  const auto create_element = [&](const std::vector<double>& seconds,
+                                  const std::vector<size_t>& calls) {
+    Parallel::ActionTimings timings{enabled};
+    if (not seconds.empty()) {
+      using phase_dependent_action_list =
+          element_component::phase_dependent_action_list;
+      timings.set_action_names(
+          Parallel::action_timing_names<phase_dependent_action_list>());
+      for (size_t i = 0; i < seconds.size(); ++i) {
+        for (size_t call = 0; call < calls[i]; ++call) {
+          timings.record(i, seconds[i] / static_cast<double>(calls[i]));
+        }
+      }
+    }
+    auto box = db::create<tag_list>(Metavariables{}, std::move(timings));
+
+    const auto ids_to_register =
+        observers::get_registration_observation_type_and_key(observer, box);
+    CHECK(ids_to_register->first == observers::TypeOfObservation::Reduction);
+    CHECK(ids_to_register->second == observers::ObservationKey("/subfile.dat"));
+
+    element_boxes.push_back(std::move(box));
+
+    ActionTesting::emplace_component<element_component>(
+        &runner, element_boxes.size() - 1);
+  };
+
+  create_element({1.0, 2.0, 4.0}, {1, 2, 4});
+  create_element({2.0, 8.0, 0.0}, {1, 4, 0});
+  // An element that hasn't recorded any timings yet
+  create_element({}, {});
+
+  for (size_t index = 0; index < element_boxes.size(); ++index) {
+    CHECK(static_cast<const Event&>(observer).is_ready(
+        element_boxes[index],
+        ActionTesting::cache<element_component>(runner, index),
+        static_cast<element_component::array_index>(index),
+        std::add_pointer_t<element_component>{}));
+    auto obs_box = make_observation_box<db::AddComputeTags<>>(
+        make_not_null(&element_boxes[index]));
+    observer.run(make_not_null(&obs_box),
+                 ActionTesting::cache<element_component>(runner, index),
+                 static_cast<element_component::array_index>(index),
+                 std::add_pointer_t<element_component>{},
+                 {"TimeName", observation_time});
+  }
+
+  if (not enabled) {
+    CHECK(runner.template is_simple_action_queue_empty<observer_component>(
+        0));
+    CHECK_FALSE(results.has_value());
+    return;
+  }
+
+  // Process the data
+  for (size_t i = 0; i < element_boxes.size(); ++i) {
+    REQUIRE(
+        not runner.template is_simple_action_queue_empty<observer_component>(
+            0));
+    runner.template invoke_queued_simple_action<observer_component>(0);
+  }
+  CHECK(runner.template is_simple_action_queue_empty<observer_component>(0));
+
+  REQUIRE(results);
+  auto& reduction_data = results->reduction_data;
+  reduction_data.finalize();
+
+  CHECK(results->observation_id.value() == observation_time);
+  CHECK(results->subfile_name == "/subfile");
+  CHECK(results->reduction_names ==
+        std::vector<std::string>{
+            "TimeName",
+            "Number of elements",
+            "Initialization/0:FirstAction Total",
+            "Evolve/0:FirstAction Total",
+            "Evolve/1:SecondAction Total",
+            "Initialization/0:FirstAction Max",
+            "Evolve/0:FirstAction Max",
+            "Evolve/1:SecondAction Max",
+            "Initialization/0:FirstAction Calls",
+            "Evolve/0:FirstAction Calls",
+            "Evolve/1:SecondAction Calls"});
+  CHECK(std::get<0>(reduction_data.data()) == observation_time);
+  CHECK(std::get<1>(reduction_data.data()) == 3);
+  CHECK(std::get<2>(reduction_data.data()) ==
+        std::vector<double>{3.0, 10.0, 4.0});
+  CHECK(std::get<3>(reduction_data.data()) ==
+        std::vector<double>{2.0, 8.0, 4.0});
+  CHECK(std::get<4>(reduction_data.data()) ==
+        std::vector<double>{2.0, 6.0, 4.0});
+}
+}  // namespace
+
+SPECTRE_TEST_CASE("Unit.ParallelAlgorithms.Events.ObserveActionTimings",
+                  "[Unit][ParallelAlgorithms]") {
+  register_factory_classes_with_charm<Metavariables>();
+
+  for (const bool enabled : {true, false}) {
+    {
+      const Events::ObserveActionTimings observer("subfile");
+      CHECK(not observer.needs_evolved_variables());
+      test_observe(observer, enabled);
+      test_observe(serialize_and_deserialize(observer), enabled);
+    }
+    {
+      const auto event =
+          TestHelpers::test_creation<std::unique_ptr<Event>, Metavariables>(
+              "ObserveActionTimings:\n"
+              "  SubfileName: subfile");
+      test_observe(*event, enabled);
+      test_observe(*serialize_and_deserialize(event), enabled);
+    }
+  }
+}
@@ -308,6 +308,23 @@ void test() {
             typename metavars::InterpolationTargetA>(
             target_box, ActionTesting::cache<target_component>(runner, 0),
             first_temporal_id);
+    // The spatial index in the DataBox is built once and gives the same
+    // result.
+    for (size_t i = 0; i < 2; ++i) {
+      CHECK(intrp::InterpolationTarget_detail::block_logical_coords<
+                typename metavars::InterpolationTargetA>(
+                make_not_null(&target_box),
+                ActionTesting::cache<target_component>(runner, 0),
+                first_temporal_id) == block_logical_coords);
+      const auto& spatial_index =
+          db::get<intrp::Tags::BlockSpatialIndex<3>>(target_box);
+      CHECK(spatial_index.number_of_blocks() ==
+            get<domain::Tags::Domain<3>>(
+                ActionTesting::cache<target_component>(runner, 0))
+                .blocks()
+                .size());
+      CHECK(spatial_index.time() == first_temporal_id.substep_time());
+    }
   } else {
     block_logical_coords =
         intrp::InterpolationTarget_detail::block_logical_coords<
@@ -3,6 +3,8 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cmath>
+#include <cstddef>
 #include <limits>
 #include <pup.h>
 #include <random>
@@ -262,6 +264,71 @@ SPECTRE_TEST_CASE("Unit.PointwiseFunctions.EquationsOfState.Tabulated3D",
 
   test_against_reference_values(eos);
 
+  // The DataVector overloads convert and interpolate the points in batches, so
+  // compare them to the double overloads for a number of points that isn't a
+  // multiple of the batch size or the SIMD width
+  {
+    INFO("Batched evaluation");
+    constexpr size_t number_of_points = 131;
+    std::uniform_real_distribution<double> dist_fraction(0.05, 0.95);
+    Scalar<DataVector> rest_mass_density{number_of_points};
+    Scalar<DataVector> temperature{number_of_points};
+    Scalar<DataVector> electron_fraction{number_of_points};
+    for (size_t s = 0; s < number_of_points; ++s) {
+      get(rest_mass_density)[s] =
+          eos.rest_mass_density_lower_bound() *
+          std::pow(eos.rest_mass_density_upper_bound() /
+                       eos.rest_mass_density_lower_bound(),
+                   dist_fraction(gen));
+      get(temperature)[s] = eos.temperature_lower_bound() *
+                            std::pow(eos.temperature_upper_bound() /
+                                         eos.temperature_lower_bound(),
+                                     dist_fraction(gen));
+      get(electron_fraction)[s] =
+          eos.electron_fraction_lower_bound() +
+          (eos.electron_fraction_upper_bound() -
+           eos.electron_fraction_lower_bound()) *
+              dist_fraction(gen);
+    }
+    const auto pressure = eos.pressure_from_density_and_temperature(
+        rest_mass_density, temperature, electron_fraction);
+    const auto specific_internal_energy =
+        eos.specific_internal_energy_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    const auto sound_speed_squared =
+        eos.sound_speed_squared_from_density_and_temperature(
+            rest_mass_density, temperature, electron_fraction);
+    const auto recovered_temperature = eos.temperature_from_density_and_energy(
+        rest_mass_density, specific_internal_energy, electron_fraction);
+
+    Approx custom_approx = Approx::custom().epsilon(1.e-12).scale(1.0);
+    for (size_t s = 0; s < number_of_points; ++s) {
+      CAPTURE(s);
+      const Scalar<double> point_rest_mass_density{get(rest_mass_density)[s]};
+      const Scalar<double> point_temperature{get(temperature)[s]};
+      const Scalar<double> point_electron_fraction{get(electron_fraction)[s]};
+      CHECK(get(pressure)[s] ==
+            custom_approx(get(eos.pressure_from_density_and_temperature(
+                point_rest_mass_density, point_temperature,
+                point_electron_fraction))));
+      CHECK(get(specific_internal_energy)[s] ==
+            custom_approx(
+                get(eos.specific_internal_energy_from_density_and_temperature(
+                    point_rest_mass_density, point_temperature,
+                    point_electron_fraction))));
+      CHECK(get(sound_speed_squared)[s] ==
+            custom_approx(
+                get(eos.sound_speed_squared_from_density_and_temperature(
+                    point_rest_mass_density, point_temperature,
+                    point_electron_fraction))));
+      CHECK(get(recovered_temperature)[s] ==
+            custom_approx(get(eos.temperature_from_density_and_energy(
+                point_rest_mass_density,
+                Scalar<double>{get(specific_internal_energy)[s]},
+                point_electron_fraction))));
+    }
+  }
+
   // Test serialization
 
   register_derived_classes_with_charm<EoS::EquationOfState<true, 3>>();
@@ -8,6 +8,7 @@
 #include <cstddef>
 #include <limits>
 #include <map>
+#include <optional>
 #include <string>
 #include <type_traits>
 #include <unordered_set>
@@ -711,6 +712,41 @@ void test_for_each() {
   check_not_null<false, true, false>(history.remote(), remote_size);
   check_reference<false, false>(const_history.remote(), remote_size);
 }
+void test_take_removed_data() {
+  INFO("take_removed_data");
+
+  BoundaryHistoryType history{};
+  CHECK_FALSE(history.local().take_removed_data().has_value());
+
+  history.local().insert(make_time_id(0.), 1, "A");
+  history.local().insert(make_time_id(1.), 1, "B");
+  history.local().insert(make_time_id(1., 1), 1, "C");
+
+  history.local().pop_front();
+  CHECK(history.local().take_removed_data() == std::optional<std::string>{"A"});
+  // The data can only be taken once
+  CHECK_FALSE(history.local().take_removed_data().has_value());
+
+  history.local().clear_substeps(0);
+  CHECK(history.local().take_removed_data() == std::optional<std::string>{"C"});
+  // No substeps were removed
+  history.local().clear_substeps(0);
+  CHECK_FALSE(history.local().take_removed_data().has_value());
+
+  // Only the most recently removed data is kept
+  history.local().insert(make_time_id(2.), 1, "D");
+  history.local().insert(make_time_id(3.), 1, "E");
+  history.local().clear();
+  CHECK(history.local().take_removed_data() == std::optional<std::string>{"E"});
+
+  // The removed data is not serialized
+  history.local().insert(make_time_id(4.), 1, "F");
+  history.local().insert(make_time_id(5.), 1, "G");
+  history.local().pop_front();
+  auto deserialized_history = serialize_and_deserialize(history);
+  CHECK_FALSE(deserialized_history.local().take_removed_data().has_value());
+  CHECK(history.local().take_removed_data() == std::optional<std::string>{"F"});
+}
 }  // namespace
 
 SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
@@ -719,4 +755,5 @@ SPECTRE_TEST_CASE("Unit.Time.BoundaryHistory", "[Unit][Time]") {
   test_substeps<false>();
   test_substeps<true>();
   test_for_each();
+  test_take_removed_data();
 }
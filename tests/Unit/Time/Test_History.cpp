@@ -3,7 +3,10 @@
 
 #include "Framework/TestingFramework.hpp"
 
+#include <cstddef>
+#include <cstdint>
 #include <optional>
+#include <set>
 #include <type_traits>
 
 #include "DataStructures/DataVector.hpp"
@@ -12,9 +15,12 @@
 #include "Framework/TestHelpers.hpp"
 #include "Time/History.hpp"
 #include "Time/Slab.hpp"
+#include "Time/Time.hpp"
 #include "Time/TimeStepId.hpp"
+#include "Utilities/Algorithm.hpp"
 #include "Utilities/ErrorHandling/Assert.hpp"
 #include "Utilities/GetOutput.hpp"
+#include "Utilities/Gsl.hpp"
 
 namespace {
 constexpr size_t num_points = 3;
@@ -618,6 +624,79 @@ void test_history() {
   }
 }
 
+void test_steady_state_allocations() {
+  // Once the history has reached its steady-state size, all records
+  // should be stored in memory recycled from removed records.  The
+  // inserters are passed a default-constructed (empty) object if no
+  // cached allocation is available, and the buffers previously used
+  // by the history are kept alive by the cache, so a recycled buffer
+  // has the right size and is one the history has used before.
+  using Vars = Variables<tmpl::list<VarTag>>;
+  using DerivVars = TimeSteppers::History<Vars>::DerivVars;
+  const size_t order = 3;
+  const size_t number_of_substeps = 2;
+  const Slab slab(0.0, 1.0);
+  const TimeDelta step_size = slab.duration() / 16;
+
+  TimeSteppers::History<Vars> history(order);
+  std::set<const double*> previous_buffers{};
+  const auto record_buffers = [&previous_buffers, &history]() {
+    const auto record_record_buffers = [&previous_buffers](const auto& record) {
+      previous_buffers.insert(record.derivative.data());
+      if (record.value.has_value()) {
+        previous_buffers.insert(record.value->data());
+      }
+    };
+    alg::for_each(history, record_record_buffers);
+    alg::for_each(history.substeps(), record_record_buffers);
+  };
+
+  Time time = slab.start();
+  for (size_t step = 0; step < 10; ++step, time += step_size) {
+    CAPTURE(step);
+    // The first steps fill the history and the allocation caches.
+    const bool check_recycled = step >= order;
+    const auto check_buffer = [&check_recycled,
+                               &previous_buffers](const auto& buffer) {
+      if (check_recycled) {
+        CHECK(buffer.number_of_grid_points() == num_points);
+        CHECK(previous_buffers.count(buffer.data()) == 1);
+      }
+    };
+    const auto insert = [&check_buffer, &history](const TimeStepId& id,
+                                                  const double value) {
+      history.insert_in_place(
+          id,
+          [&check_buffer, &value](const gsl::not_null<Vars*> v) {
+            check_buffer(*v);
+            v->initialize(num_points, value);
+          },
+          [&check_buffer, &value](const gsl::not_null<DerivVars*> d) {
+            check_buffer(*d);
+            d->initialize(num_points, -value);
+          });
+    };
+
+    const auto value = static_cast<double>(step);
+    insert(TimeStepId(true, 0, time), value);
+    for (uint64_t substep = 1; substep <= number_of_substeps; ++substep) {
+      insert(TimeStepId(true, 0, time, substep, step_size,
+                        (time + step_size / 2).value()),
+             value + 0.5);
+    }
+    record_buffers();
+
+    // What a multistep method with substeps would do.
+    history.clear_substeps();
+    while (history.size() >= order) {
+      history.pop_front();
+    }
+    if (history.size() > 1) {
+      history.discard_value(history[history.size() - 2].time_step_id);
+    }
+  }
+}
+
 void test_history_assertions() {
 #ifdef SPECTRE_DEBUG
   const Slab slab(0.0, 1.0);
@@ -904,6 +983,8 @@ SPECTRE_TEST_CASE("Unit.Time.History", "[Unit][Time]") {
   test_history<Variables<tmpl::list<VarTag>>,
                Variables<tmpl::list<Tags::dt<VarTag>>>>();
 
+  test_steady_state_allocations();
+
   test_history_assertions();
 
   test_history_output();
@@ -11,6 +11,7 @@
 #include <deque>
 #include <initializer_list>
 
+#include "DataStructures/DataVector.hpp"
 #include "DataStructures/MathWrapper.hpp"
 #include "Framework/TestCreation.hpp"
 #include "Framework/TestHelpers.hpp"
@@ -344,6 +345,84 @@ void check_lts_vts() {
   }
 }
 
+void test_shared_boundary_terms() {
+  // The coefficients are shared between histories with the same
+  // times, so check that histories with different data and of
+  // different types still give the correct results.  The vectors are
+  // longer than the blocks the terms are summed in.
+  const Slab slab(0., 1.);
+  const Slab init_slab = slab.advance_towards(-slab.duration());
+  const std::array<TimeDelta, 2> dt{{slab.duration() / 4,
+                                     slab.duration() / 8}};
+  const size_t order = 4;
+  const TimeSteppers::AdamsBashforth ab4(order);
+  const size_t number_of_points = 300;
+
+  const auto make_time_id = [](const Time& t) {
+    return TimeStepId(true, 0, t);
+  };
+  const auto local_vector = [&](const double value) {
+    DataVector result(number_of_points);
+    for (size_t i = 0; i < number_of_points; ++i) {
+      result[i] = static_cast<double>(i + 1) * value;
+    }
+    return result;
+  };
+
+  TimeSteppers::BoundaryHistory<double, double, double> scalar_history{};
+  TimeSteppers::BoundaryHistory<DataVector, DataVector, DataVector>
+      vector_history{};
+  const auto insert_local = [&](const Time& time, const bool initial) {
+    const double value = quartic_side1(time.value());
+    if (initial) {
+      scalar_history.local().insert_initial(make_time_id(time), order, value);
+      vector_history.local().insert_initial(make_time_id(time), order,
+                                            local_vector(value));
+    } else {
+      scalar_history.local().insert(make_time_id(time), order, value);
+      vector_history.local().insert(make_time_id(time), order,
+                                    local_vector(value));
+    }
+  };
+  const auto insert_remote = [&](const Time& time, const bool initial) {
+    const double value = quartic_side2(time.value());
+    if (initial) {
+      scalar_history.remote().insert_initial(make_time_id(time), order, value);
+      vector_history.remote().insert_initial(
+          make_time_id(time), order, DataVector(number_of_points, value));
+    } else {
+      scalar_history.remote().insert(make_time_id(time), order, value);
+      vector_history.remote().insert(make_time_id(time), order,
+                                     DataVector(number_of_points, value));
+    }
+  };
+
+  for (int32_t step = 1; step <= 3; ++step) {
+    insert_local(slab.start() - step * dt[0].with_slab(init_slab), true);
+    insert_remote(slab.start() - step * dt[1].with_slab(init_slab), true);
+  }
+  insert_local(slab.start(), false);
+  insert_remote(slab.start(), false);
+  insert_remote(slab.start() + dt[1], false);
+
+  double scalar_result = quartic_answer(slab.start().value());
+  DataVector vector_result = local_vector(scalar_result);
+  ab4.add_boundary_delta(&scalar_result, make_not_null(&scalar_history),
+                         dt[0], [](const double local, const double remote) {
+                           return local * remote;
+                         });
+  ab4.add_boundary_delta(
+      &vector_result, make_not_null(&vector_history), dt[0],
+      [](const DataVector& local, const DataVector& remote) {
+        return DataVector(local * remote);
+      });
+  const double expected = quartic_answer((slab.start() + dt[0]).value());
+  CHECK(scalar_result == approx(expected));
+  for (size_t i = 0; i < number_of_points; ++i) {
+    CHECK(vector_result[i] == approx(static_cast<double>(i + 1) * expected));
+  }
+}
+
 void test_neighbor_data_required() {
   // Test is order-independent
   const TimeSteppers::AdamsBashforth stepper(4);
@@ -405,6 +484,8 @@ SPECTRE_TEST_CASE("Unit.Time.TimeSteppers.AdamsBashforth.Boundary",
   // Local stepping with varying time steps
   check_lts_vts();
 
+  test_shared_boundary_terms();
+
   // Dense output
   for (size_t order = 1; order < 9; ++order) {
     INFO(order);